@@ -27,6 +27,7 @@ set(OMR_JITBUILDER ON CACHE BOOL "")
 set(OMR_GC_SEGREGATED_HEAP ON CACHE BOOL "")
 set(OMR_GC_MODRON_SCAVENGER ON CACHE BOOL "")
 set(OMR_GC_MODRON_CONCURRENT_MARK ON CACHE BOOL "")
+set(OMR_GC_MODRON_COMPACTION ON CACHE BOOL "")
 set(OMR_GC_VLHGC ON CACHE BOOL "")
 set(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD ON CACHE BOOL "")
 set(OMR_SEPARATE_DEBUG_INFO ON CACHE BOOL "")
@@ -36,5 +37,9 @@ set(OMR_THR_CUSTOM_SPIN_OPTIONS ON CACHE BOOL "")
 set(OMR_THR_FORK_SUPPORT ON CACHE BOOL "")
 set(OMR_THR_SPIN_WAKE_CONTROL ON CACHE BOOL "")
 set(OMR_THR_THREE_TIER_LOCKING ON CACHE BOOL "")
+# Futex parking of blocked monitor threads is only available on Linux
+if(CMAKE_HOST_SYSTEM_NAME STREQUAL "Linux")
+	set(OMR_THR_FUTEX_MONITORS ON CACHE BOOL "")
+endif()
 
 set(OMR_PORT_ASYNC_HANDLER ON CACHE BOOL "")
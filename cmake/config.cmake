@@ -201,6 +201,18 @@ endif()
 #TODO set to disabled. Stuff fails to compile when its on
 set(OMR_THR_TRACING OFF CACHE BOOL "TODO: Document")
 set(OMR_THR_MCS_LOCKS OFF CACHE BOOL "Enable the usage of the MCS lock in the OMR thread monitor.")
+if(OMR_OS_LINUX AND OMR_THR_THREE_TIER_LOCKING AND NOT OMR_THR_MCS_LOCKS)
+	set(OMR_THR_FUTEX_MONITORS_DEFAULT ON)
+else()
+	set(OMR_THR_FUTEX_MONITORS_DEFAULT OFF)
+endif()
+set(OMR_THR_FUTEX_MONITORS ${OMR_THR_FUTEX_MONITORS_DEFAULT} CACHE BOOL "Park threads blocked on three tier monitors on a futex.")
+if(OMR_THR_FUTEX_MONITORS)
+	omr_assert(FATAL_ERROR
+		TEST OMR_OS_LINUX AND OMR_THR_THREE_TIER_LOCKING AND NOT OMR_THR_MCS_LOCKS
+		MESSAGE "OMR_THR_FUTEX_MONITORS requires Linux and OMR_THR_THREE_TIER_LOCKING, and is not supported with OMR_THR_MCS_LOCKS"
+	)
+endif()
 
 #TODO this should maybe be a OMRTHREAD_LIB string variable?
 set(OMRTHREAD_WIN32_DEFAULT OFF)
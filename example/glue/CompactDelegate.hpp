@@ -74,11 +74,17 @@ public:
 		return true;
 	}
 
+	/**
+	 * Check that every reference held by a marked object is to a marked object, before the heap is compacted
+	 */
 	void
-	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
+	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap);
 
+	/**
+	 * Update the example VM roots, thread saved objects and object table to the new locations of their objects
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
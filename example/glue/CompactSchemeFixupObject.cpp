@@ -24,20 +24,33 @@
 
 #include "CompactSchemeFixupObject.hpp"
 #include "EnvironmentStandard.hpp"
+#include "ModronAssertions.h"
+#include "ObjectIterator.hpp"
+#include "SlotObject.hpp"
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
 MM_CompactSchemeFixupObject::fixupObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
-#error provide an implementation to fix objects during a compact
+	GC_ObjectIterator objectIterator(_omrVM, objectPtr);
+	GC_SlotObject *slotObject = NULL;
+
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		if (NULL != slotObject->readReferenceFromSlot()) {
+			_compactScheme->fixupObjectSlot(slotObject);
+		}
+	}
 }
 
 
 void
 MM_CompactSchemeFixupObject::verifyForwardingPtr(omrobjectptr_t objectPtr, omrobjectptr_t forwardingPtr)
 {
-#error provide an implementation to verify objects after a compact is complete
+	/* objects only ever move down, to an object aligned address */
+	Assert_MM_true(NULL != forwardingPtr);
+	Assert_MM_true(forwardingPtr <= objectPtr);
+	Assert_MM_true(0 == ((uintptr_t)forwardingPtr & (OMR_MINIMUM_OBJECT_ALIGNMENT - 1)));
 }
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -28,7 +28,7 @@
 #include "omrgcconsts.h"
 #include "omrport.h"
 
-#include "ConcurrentSafepointCallback.hpp"
+#include "ConcurrentSafepointCallbackImpl.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 
@@ -97,7 +97,7 @@ public:
 	MMINLINE MM_ConcurrentSafepointCallback*
 	createSafepointCallback(MM_EnvironmentBase *env)
 	{
-		return MM_ConcurrentSafepointCallback::newInstance(env);
+		return MM_ConcurrentSafepointCallbackImpl::newInstance(env);
 	}
 
 	/**
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "ConcurrentSafepointCallbackImpl.hpp"
+
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+MM_ConcurrentSafepointCallbackImpl *
+MM_ConcurrentSafepointCallbackImpl::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSafepointCallbackImpl *callback;
+
+	callback = (MM_ConcurrentSafepointCallbackImpl *)env->getForge()->allocate(sizeof(MM_ConcurrentSafepointCallbackImpl), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != callback) {
+		new(callback) MM_ConcurrentSafepointCallbackImpl(env);
+	}
+	return callback;
+}
+
+void
+#if defined(AIXPPC) || defined(LINUXPPC)
+MM_ConcurrentSafepointCallbackImpl::registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData, bool cancelAfterGC)
+#else
+MM_ConcurrentSafepointCallbackImpl::registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData)
+#endif /* defined(AIXPPC) || defined(LINUXPPC) */
+{
+	_handler = handler;
+	_userData = userData;
+}
+
+void
+MM_ConcurrentSafepointCallbackImpl::requestCallback(MM_EnvironmentBase *env)
+{
+	if (NULL != _handler) {
+		_handler(env->getOmrVMThread(), _userData);
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(CONCURRENTSAFEPOINTCALLBACKIMPL_HPP_)
+#define CONCURRENTSAFEPOINTCALLBACKIMPL_HPP_
+
+#include "omrcfg.h"
+
+#include "ConcurrentSafepointCallback.hpp"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+/**
+ * Safepoint callback of the example VM. Its threads hold no object references the collector
+ * does not know about while they allocate, so a thread which requests a callback is at a safe
+ * point as far as exclusive VM access goes, and the callback is run right away.
+ */
+class MM_ConcurrentSafepointCallbackImpl : public MM_ConcurrentSafepointCallback
+{
+	/*
+	 * Function members
+	 */
+public:
+#if defined(AIXPPC) || defined(LINUXPPC)
+	virtual void registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData, bool cancelAfterGC = false);
+#else
+	virtual void registerCallback(MM_EnvironmentBase *env, SafepointCallbackHandler handler, void *userData);
+#endif /* defined(AIXPPC) || defined(LINUXPPC) */
+
+	virtual void requestCallback(MM_EnvironmentBase *env);
+
+	static MM_ConcurrentSafepointCallbackImpl *newInstance(MM_EnvironmentBase *env);
+
+	MM_ConcurrentSafepointCallbackImpl(MM_EnvironmentBase *env)
+		: MM_ConcurrentSafepointCallback(env)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#endif /* CONCURRENTSAFEPOINTCALLBACKIMPL_HPP_ */
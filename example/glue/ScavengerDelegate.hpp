@@ -127,10 +127,14 @@ public:
 	 * allocSpace is guaranteed to be large enough to hold an instance of the largest GC_ObjectScanner subclass
 	 * represented in the GC_ObjectScannerState structure.
 	 *
+	 * With hierarchical scan ordering and hierarchicalDepthCopy, a scanner is also requested with copyAhead set to
+	 * copy the children of an object right after it. The object is scanned again later, so that scanner must
+	 * not have side effects (eg, discovery of reference objects) and should not return slots holding weak referents.
+	 *
 	 * @param[in] env The environment for the calling thread.
 	 * @param[in] objectPtr The object to be scanned
 	 * @param[in] allocSpace Space for in-place instantiation of scanner
-	 * @param[in] flags See GC_ObjectScanner::InstanceFlags. One of scanRoots or scanHeap will be set , but not both.
+	 * @param[in] flags See GC_ObjectScanner::InstanceFlags. One of scanRoots or scanHeap will be set , but not both (copyAhead only with scanHeap).
 	 * @return Pointer to object scanner, or NULL if object not to be scanned (eg, leaf object).
 	 * @see GC_ObjectScanner
 	 */
@@ -30,6 +30,7 @@ include $(CONFIG_INCL_DIR)/configure_common.mk
 
 CONFIGURE_ARGS += \
   --enable-OMR_THR_THREE_TIER_LOCKING \
+  --enable-OMR_THR_FUTEX_MONITORS \
   --enable-OMR_THR_YIELD_ALG \
   --enable-OMR_THR_SPIN_WAKE_CONTROL
 
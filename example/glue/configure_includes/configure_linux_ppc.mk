@@ -57,6 +57,7 @@ endif
 
 CONFIGURE_ARGS += \
   --enable-OMR_THR_THREE_TIER_LOCKING \
+  --enable-OMR_THR_FUTEX_MONITORS \
   --enable-OMR_THR_YIELD_ALG \
   --enable-OMR_THR_SPIN_WAKE_CONTROL
 
@@ -36,6 +36,7 @@ CONFIGURE_ARGS += \
   --enable-OMR_THREAD \
   --enable-OMR_OMRSIG \
   --enable-OMR_THR_THREE_TIER_LOCKING \
+  --enable-OMR_THR_FUTEX_MONITORS \
   --enable-OMR_THR_YIELD_ALG \
   --enable-OMR_THR_SPIN_WAKE_CONTROL \
 
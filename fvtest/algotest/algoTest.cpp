@@ -221,6 +221,26 @@ TEST_P(HashtableTest, NoForce)
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
 
+TEST_P(HashtableTest, ForceConcurrent)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+	params.collisionResistant = FALSE;
+	params.concurrent = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(HashtableTest, NoForceConcurrent)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+	params.collisionResistant = FALSE;
+	params.concurrent = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HashtableTest, ::testing::ValuesIn(hastableParams));
 
 class CollisionResilientHashtableTest: public ::testing::TestWithParam< ::testing::tuple<HashtableInputData, uint32_t> >
@@ -247,6 +267,28 @@ TEST_P(CollisionResilientHashtableTest, NoForce)
 	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
 }
 
+TEST_P(CollisionResilientHashtableTest, ForceConcurrent)
+{
+	HashtableInputData params = ::testing::get<0>(GetParam());
+	params.forceCollisions = TRUE;
+	params.collisionResistant = TRUE;
+	params.concurrent = TRUE;
+	params.listToTreeThreshold = ::testing::get<1>(GetParam());
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(CollisionResilientHashtableTest, NoForceConcurrent)
+{
+	HashtableInputData params = ::testing::get<0>(GetParam());
+	params.forceCollisions = FALSE;
+	params.collisionResistant = TRUE;
+	params.concurrent = TRUE;
+	params.listToTreeThreshold = ::testing::get<1>(GetParam());
+
+	ASSERT_EQ(0, buildAndVerifyHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
 INSTANTIATE_TEST_CASE_P(OmrAlgoTest, CollisionResilientHashtableTest,
 	::testing::Combine(
 		::testing::ValuesIn(hastableParams),
@@ -0,0 +1,303 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testEnvironment.hpp"
+#include "hashtable_api.h"
+#include "thread_api.h"
+
+extern PortEnvironment *omrTestEnv;
+
+#define BENCHMARK_MAX_THREADS 64
+#define BENCHMARK_MILLIS 100
+#define BENCHMARK_SHARED_KEYS 4096
+#define BENCHMARK_LOOKUPS_PER_ADD 8
+#define BENCHMARK_MAX_ADDS_PER_THREAD 16384
+
+/* state shared by the threads of a benchmark run */
+typedef struct HashtableBenchmarkInfo {
+	J9HashTable *table;
+	omrthread_monitor_t tableMonitor; /* held around every operation if the table is not concurrent, NULL otherwise */
+	omrthread_monitor_t synchronization;
+	uintptr_t threadCount;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+	volatile BOOLEAN go;
+	volatile BOOLEAN stop;
+	uintptr_t operations[BENCHMARK_MAX_THREADS];
+	uintptr_t adds[BENCHMARK_MAX_THREADS];
+	uintptr_t failures[BENCHMARK_MAX_THREADS];
+} HashtableBenchmarkInfo;
+
+typedef struct HashtableBenchmarkThreadArg {
+	HashtableBenchmarkInfo *info;
+	uintptr_t index;
+} HashtableBenchmarkThreadArg;
+
+static uintptr_t
+benchmarkHashFn(void *entry, void *userData)
+{
+	return (*(uintptr_t *)entry) * 31;
+}
+
+static uintptr_t
+benchmarkEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(uintptr_t *)leftEntry == *(uintptr_t *)rightEntry;
+}
+
+/* keys added by a thread are distinct from the shared keys and from the keys of the other threads */
+static uintptr_t
+threadKey(HashtableBenchmarkInfo *info, uintptr_t index, uintptr_t add)
+{
+	return BENCHMARK_SHARED_KEYS + 1 + (add * info->threadCount) + index;
+}
+
+static void *
+benchmarkFind(HashtableBenchmarkInfo *info, uintptr_t key)
+{
+	void *result = NULL;
+	if (NULL != info->tableMonitor) {
+		omrthread_monitor_enter(info->tableMonitor);
+		result = hashTableFind(info->table, &key);
+		omrthread_monitor_exit(info->tableMonitor);
+	} else {
+		result = hashTableFind(info->table, &key);
+	}
+	return result;
+}
+
+static void *
+benchmarkAdd(HashtableBenchmarkInfo *info, uintptr_t key)
+{
+	void *result = NULL;
+	if (NULL != info->tableMonitor) {
+		omrthread_monitor_enter(info->tableMonitor);
+		result = hashTableAdd(info->table, &key);
+		omrthread_monitor_exit(info->tableMonitor);
+	} else {
+		result = hashTableAdd(info->table, &key);
+	}
+	return result;
+}
+
+static uint32_t
+benchmarkRemove(HashtableBenchmarkInfo *info, uintptr_t key)
+{
+	uint32_t result = 0;
+	if (NULL != info->tableMonitor) {
+		omrthread_monitor_enter(info->tableMonitor);
+		result = hashTableRemove(info->table, &key);
+		omrthread_monitor_exit(info->tableMonitor);
+	} else {
+		result = hashTableRemove(info->table, &key);
+	}
+	return result;
+}
+
+/**
+ * Look up shared keys, and add and remove keys of its own, until told to stop. Every other key
+ * added is removed again, so the table grows while it is being read. Counts the lookups of keys
+ * which should be in the table and are not, and of removed keys which are.
+ * @param arg the HashtableBenchmarkThreadArg of the thread
+ */
+static intptr_t J9THREAD_PROC
+benchmarkThread(HashtableBenchmarkThreadArg *arg)
+{
+	HashtableBenchmarkInfo *info = arg->info;
+	uintptr_t operations = 0;
+	uintptr_t adds = 0;
+	uintptr_t failures = 0;
+	uintptr_t random = arg->index + 1;
+
+	omrthread_monitor_enter(info->synchronization);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	while (!info->go) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	while (!info->stop) {
+		uintptr_t i = 0;
+
+		for (i = 0; i < BENCHMARK_LOOKUPS_PER_ADD; i++) {
+			uintptr_t key = 0;
+			uintptr_t *found = NULL;
+			random = (random * 1103515245) + 12345;
+			key = ((random >> 8) % BENCHMARK_SHARED_KEYS) + 1;
+			found = (uintptr_t *)benchmarkFind(info, key);
+			if ((NULL == found) || (key != *found)) {
+				failures += 1;
+			}
+		}
+		operations += BENCHMARK_LOOKUPS_PER_ADD;
+
+		if (adds < BENCHMARK_MAX_ADDS_PER_THREAD) {
+			uintptr_t key = threadKey(info, arg->index, adds);
+			uintptr_t *found = NULL;
+
+			if (NULL == benchmarkAdd(info, key)) {
+				failures += 1;
+			}
+			found = (uintptr_t *)benchmarkFind(info, key);
+			if ((NULL == found) || (key != *found)) {
+				failures += 1;
+			}
+			operations += 2;
+			if (1 == (adds & 1)) {
+				if (0 != benchmarkRemove(info, key)) {
+					failures += 1;
+				}
+				if (NULL != benchmarkFind(info, key)) {
+					failures += 1;
+				}
+				operations += 2;
+			}
+			adds += 1;
+		}
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->operations[arg->index] = operations;
+	info->adds[arg->index] = adds;
+	info->failures[arg->index] = failures;
+	info->finished += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+	return 0;
+}
+
+/**
+ * Run threadCount threads on a table created with flags for BENCHMARK_MILLIS, then check the
+ * contents of the table.
+ * @return the number of operations per millisecond, or 0 if a check failed
+ */
+static uintptr_t
+measureHashtableThroughput(uint32_t flags, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	HashtableBenchmarkInfo *info = (HashtableBenchmarkInfo *)omrmem_allocate_memory(sizeof(HashtableBenchmarkInfo), OMRMEM_CATEGORY_VM);
+	HashtableBenchmarkThreadArg args[BENCHMARK_MAX_THREADS];
+	uintptr_t expectedCount = BENCHMARK_SHARED_KEYS;
+	uintptr_t total = 0;
+	uintptr_t failures = 0;
+	uintptr_t i = 0;
+	uint64_t startNanos = 0;
+	uint64_t elapsedNanos = 0;
+
+	memset(info, 0, sizeof(HashtableBenchmarkInfo));
+	info->threadCount = threadCount;
+	info->table = hashTableNew(OMRPORTLIB, OMR_GET_CALLSITE(), 0, sizeof(uintptr_t), 0, flags, OMRMEM_CATEGORY_VM, benchmarkHashFn, benchmarkEqualFn, NULL, NULL);
+	if (NULL == info->table) {
+		omrmem_free_memory(info);
+		return 0;
+	}
+	if (J9HASH_TABLE_CONCURRENT != (flags & J9HASH_TABLE_CONCURRENT)) {
+		omrthread_monitor_init_with_name(&info->tableMonitor, 0, "hash table benchmark table monitor");
+	}
+	omrthread_monitor_init_with_name(&info->synchronization, 0, "hash table benchmark monitor");
+
+	for (i = 1; i <= BENCHMARK_SHARED_KEYS; i++) {
+		if (NULL == hashTableAdd(info->table, &i)) {
+			failures += 1;
+		}
+	}
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		args[i].info = info;
+		args[i].index = i;
+		omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, (omrthread_entrypoint_t)benchmarkThread, &args[i]);
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->started < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	info->go = TRUE;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+
+	startNanos = omrtime_nano_time();
+	omrthread_sleep(BENCHMARK_MILLIS);
+	info->stop = TRUE;
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->finished < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+	elapsedNanos = omrtime_nano_time() - startNanos;
+
+	/* every even numbered key added by a thread stays in the table */
+	for (i = 0; i < threadCount; i++) {
+		uintptr_t add = 0;
+		total += info->operations[i];
+		failures += info->failures[i];
+		for (add = 0; add < info->adds[i]; add++) {
+			uintptr_t key = threadKey(info, i, add);
+			BOOLEAN expected = (0 == (add & 1));
+			if (expected != (NULL != hashTableFind(info->table, &key))) {
+				failures += 1;
+			}
+			if (expected) {
+				expectedCount += 1;
+			}
+		}
+	}
+	if (expectedCount != hashTableGetCount(info->table)) {
+		failures += 1;
+	}
+
+	omrthread_monitor_destroy(info->synchronization);
+	if (NULL != info->tableMonitor) {
+		omrthread_monitor_destroy(info->tableMonitor);
+	}
+	hashTableFree(info->table);
+	omrmem_free_memory(info);
+
+	if (0 != failures) {
+		return 0;
+	}
+	return (uintptr_t)(((uint64_t)total * 1000000) / OMR_MAX(elapsedNanos, 1));
+}
+
+/**
+ * Compare the throughput of a table held under a monitor and of a J9HASH_TABLE_CONCURRENT table
+ * with 1 to BENCHMARK_MAX_THREADS threads, mostly looking up entries while the table grows.
+ */
+TEST(OmrAlgoTest, HashtableConcurrentBenchmark)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t threadCount = 0;
+
+	omrtty_printf("%8s %20s %20s\n", "threads", "monitor (ops/ms)", "concurrent (ops/ms)");
+	for (threadCount = 1; threadCount <= BENCHMARK_MAX_THREADS; threadCount *= 2) {
+		uintptr_t monitorThroughput = measureHashtableThroughput(0, threadCount);
+		uintptr_t concurrentThroughput = measureHashtableThroughput(J9HASH_TABLE_CONCURRENT, threadCount);
+		omrtty_printf("%8zu %20zu %20zu\n", threadCount, monitorThroughput, concurrentThroughput);
+		ASSERT_TRUE(0 != monitorThroughput);
+		ASSERT_TRUE(0 != concurrentThroughput);
+	}
+}
@@ -203,6 +203,10 @@ allocateHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
 	uint32_t flags = 0;
 	void *userData = (void *)(uintptr_t)inputData->forceCollisions;
 
+	if (TRUE == inputData->concurrent) {
+		flags |= J9HASH_TABLE_CONCURRENT;
+	}
+
 	if (TRUE == inputData->collisionResistant) {
 		hashtable = collisionResilientHashTableNew(portLib,
 				tableName,
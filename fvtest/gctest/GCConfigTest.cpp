@@ -29,6 +29,9 @@
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
+#include "verboseGCEventLogDecoder.hpp"
+
+#include <math.h>
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -43,21 +46,50 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_scalarscan_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_pretouch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_searchcursors_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compact_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_compact_sliding_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_hugepages_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardqueue_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardqueue_overflow_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_pausetarget_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptive_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_hierarchical_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rsoverflow_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_prezero_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_sampling_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_eventlog_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_treebarrier_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_young_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+								, "perftest/gctest/configuration/compact_GC_config.xml"
+								, "perftest/gctest/configuration/compact_sliding_GC_config.xml"
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -87,6 +119,14 @@ GCConfigTest::SetUp()
 		FAIL() << "Failed to instantiate collector interface.";
 	}
 
+	/* Count the allocation samples, if the configuration enables them */
+	if (0 != env->getExtensions()->allocationSamplingInterval) {
+		J9HookInterface **omrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+		if (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, OMR_GET_CALLSITE(), (void *)this)) {
+			FAIL() << "Failed to register the allocation sample hook.";
+		}
+	}
+
 	/* load config file */
 #if defined(OMRGCTEST_PRINTFILE)
 	printFile(GetParam());
@@ -114,7 +154,33 @@ GCConfigTest::SetUp()
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
 	gcTestEnv->log(LEVEL_VERBOSE, "Verbose GC log name: %s; numOfFiles: %d; numOfCycles: %d.\n", verboseFile, numOfFiles, numOfCycles);
 	verboseManager->enableVerboseGC();
-	verboseManager->setInitializedTime(omrtime_hires_clock());
+
+	/* The example VM does not report that the GC is initialized, so report it here for the initialized stanza */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	TRIGGER_J9HOOK_MM_OMR_INITIALIZED(
+			extensions->omrHookInterface,
+			exampleVM->_omrVMThread,
+			omrtime_hires_clock(),
+			optionNode.attribute("GCPolicy").value(),
+			0,
+			extensions->memoryMax,
+			extensions->initialMemorySize,
+			omrsysinfo_get_physical_memory(),
+			omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE),
+			extensions->gcThreadCount,
+			omrsysinfo_get_CPU_architecture(),
+			omrsysinfo_get_OS_type(),
+			omrsysinfo_get_OS_version(),
+			0,
+			0, 0, 0, 0, 0,
+			extensions->heap->getPageSize(),
+			"",
+			extensions->requestedPageSize,
+			"",
+			0,
+			extensions->regionSize,
+			0,
+			0);
 
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
@@ -181,6 +247,11 @@ GCConfigTest::TearDown()
 	omrmem_free_memory((void *)verboseFile);
 	verboseFile = NULL;
 
+	if ((NULL != env) && (0 != env->getExtensions()->allocationSamplingInterval)) {
+		J9HookInterface **omrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE, allocationSampleHook, (void *)this);
+	}
+
 	if (NULL != cli) {
 		cli->kill(env);
 	}
@@ -299,6 +370,7 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 ObjectEntry *
 GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 
 	ObjectEntry objEntry;
@@ -309,7 +381,11 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	uint64_t allocStartTime = omrtime_hires_clock();
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
+	if (NULL != objEntry.objPtr) {
+		recordAllocLatency(allocStartTime);
+	}
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
@@ -322,6 +398,11 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	if (NULL != objEntry.objPtr) {
 		uintptr_t consumedSize = env->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(objEntry.objPtr);
 		uintptr_t adjustedSize = env->getExtensions()->objectModel.adjustSizeInBytes(size);
+		allocatedBytes += consumedSize;
+		if (0 != env->getExtensions()->allocationSamplingInterval) {
+			/* an object holds the next sampled byte with this probability, counting starts again after it */
+			expectedAllocationSamples += 1.0 - exp(-(double)consumedSize / (double)env->getExtensions()->allocationSamplingInterval);
+		}
 		if (consumedSize == adjustedSize) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Allocate object name: %s(%p[0x%llx])\n", objEntry.name, objEntry.objPtr, consumedSize);
 		} else {
@@ -335,6 +416,168 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	return newEntry;
 }
 
+void
+GCConfigTest::recordAllocLatency(uint64_t startTime)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uint64_t latency = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+	uintptr_t bucket = 0;
+	while ((latency > 1) && (bucket < (sizeof(allocLatencyHistogram) / sizeof(allocLatencyHistogram[0])) - 1)) {
+		latency >>= 1;
+		bucket += 1;
+	}
+	allocLatencyHistogram[bucket] += 1;
+	allocLatencyCount += 1;
+}
+
+uint64_t
+GCConfigTest::allocLatencyPercentile(uintptr_t percentile)
+{
+	/* the upper bound of the bucket holding the percentile */
+	uintptr_t rank = ((allocLatencyCount * percentile) + 99) / 100;
+	uintptr_t seen = 0;
+	uintptr_t bucket = 0;
+	for (; bucket < (sizeof(allocLatencyHistogram) / sizeof(allocLatencyHistogram[0])) - 1; bucket++) {
+		seen += allocLatencyHistogram[bucket];
+		if (seen >= rank) {
+			break;
+		}
+	}
+	return (uint64_t)2 << bucket;
+}
+
+void
+GCConfigTest::reportAllocLatency()
+{
+	if (0 != allocLatencyCount) {
+		gcTestEnv->log("Allocation latency (%zu allocations without GC): p50 < %llu ns, p90 < %llu ns, p99 < %llu ns, max < %llu ns\n",
+				allocLatencyCount, (unsigned long long)allocLatencyPercentile(50), (unsigned long long)allocLatencyPercentile(90),
+				(unsigned long long)allocLatencyPercentile(99), (unsigned long long)allocLatencyPercentile(100));
+	}
+}
+
+void
+GCConfigTest::allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSampleEvent *event = (MM_ObjectAllocationSampleEvent *)eventData;
+	GCConfigTest *test = (GCConfigTest *)userData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(event->currentThread->_vm);
+
+	test->allocationSampleCount += 1;
+	if ((NULL == event->object) || (event->size != extensions->objectModel.getConsumedSizeInBytesWithHeader(event->object))
+		|| (event->samplingInterval != extensions->allocationSamplingInterval)
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid allocation sample: object %p, size 0x%llx, samplingInterval %llu.\n",
+				__FILE__, __LINE__, event->object, (unsigned long long)event->size, (unsigned long long)event->samplingInterval);
+		test->allocationSampleErrors += 1;
+	}
+}
+
+int32_t
+GCConfigTest::verifyVerboseEventLog(pugi::xml_node node)
+{
+	/* the log holds all the records once it is closed; the records of later events would be lost */
+	verboseManager->disableVerboseGC();
+	verboseManager->closeStreams(env);
+
+	VerboseGCEventLogSummary summary;
+	if (0 != readVerboseGCEventLog(verboseFile, gcTestEnv->portLib, false, &summary)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode verbose GC event log %s.\n", __FILE__, __LINE__, verboseFile);
+		return 1;
+	}
+	gcTestEnv->log("Verbose GC event log %s: %llu records, %llu dropped, %llu unknown, %llu scavenges, %llu globals\n",
+			verboseFile, (unsigned long long)summary.records, (unsigned long long)summary.droppedRecords,
+			(unsigned long long)summary.unknownRecords, (unsigned long long)summary.scavenges, (unsigned long long)summary.globals);
+	for (uint32_t type = VERBOSE_EVENT_NONE + 1; type < VERBOSE_EVENT_TYPE_COUNT; type++) {
+		gcTestEnv->log(LEVEL_VERBOSE, "\t%s: %llu\n", getVerboseGCEventTypeName(type), (unsigned long long)summary.recordsOfType[type]);
+	}
+
+	int32_t rt = 0;
+	uint64_t minRecords = node.attribute("minRecords").as_uint(1);
+	if (summary.records < minRecords) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %llu records, at least %llu expected.\n", __FILE__, __LINE__,
+				(unsigned long long)summary.records, (unsigned long long)minRecords);
+		rt = 1;
+	}
+	if (0 != summary.unknownRecords) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %llu records of an unknown type.\n", __FILE__, __LINE__, (unsigned long long)summary.unknownRecords);
+		rt = 1;
+	}
+	pugi::xml_attribute droppedRecords = node.attribute("droppedRecords");
+	if (droppedRecords && ((uint64_t)droppedRecords.as_uint() != summary.droppedRecords)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %llu records dropped, %u expected.\n", __FILE__, __LINE__,
+				(unsigned long long)summary.droppedRecords, droppedRecords.as_uint());
+		rt = 1;
+	}
+
+	/* each of the types listed is in the log */
+	const char *types = node.attribute("types").value();
+	while ('\0' != *types) {
+		const char *typeEnd = strchr(types, ',');
+		size_t typeLength = (NULL == typeEnd) ? strlen(types) : (size_t)(typeEnd - types);
+		uint32_t type = VERBOSE_EVENT_NONE + 1;
+		for (; type < VERBOSE_EVENT_TYPE_COUNT; type++) {
+			const char *name = getVerboseGCEventTypeName(type);
+			if ((typeLength == strlen(name)) && (0 == strncmp(types, name, typeLength))) {
+				break;
+			}
+		}
+		if (VERBOSE_EVENT_TYPE_COUNT == type) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: unknown event type \"%.*s\".\n", __FILE__, __LINE__, (int)typeLength, types);
+			rt = 1;
+		} else if (0 == summary.recordsOfType[type]) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d No %s record in the log.\n", __FILE__, __LINE__, getVerboseGCEventTypeName(type));
+			rt = 1;
+		}
+		types += (NULL == typeEnd) ? typeLength : (typeLength + 1);
+	}
+
+	/* with no record dropped, every event which starts in the log ends in it */
+	if (0 == summary.droppedRecords) {
+		const uint32_t pairs[][2] = {
+			{ VERBOSE_EVENT_CYCLE_START, VERBOSE_EVENT_CYCLE_END },
+			{ VERBOSE_EVENT_INCREMENT_START, VERBOSE_EVENT_INCREMENT_END },
+			{ VERBOSE_EVENT_EXCLUSIVE_START, VERBOSE_EVENT_EXCLUSIVE_END },
+			{ VERBOSE_EVENT_SYSTEM_GC_START, VERBOSE_EVENT_SYSTEM_GC_END },
+			{ VERBOSE_EVENT_ALLOCATION_FAILURE_START, VERBOSE_EVENT_ALLOCATION_FAILURE_END }
+		};
+		for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+			uint64_t starts = summary.recordsOfType[pairs[i][0]];
+			uint64_t ends = summary.recordsOfType[pairs[i][1]];
+			if (starts != ends) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d %llu %s records but %llu %s records.\n", __FILE__, __LINE__,
+						(unsigned long long)starts, getVerboseGCEventTypeName(pairs[i][0]),
+						(unsigned long long)ends, getVerboseGCEventTypeName(pairs[i][1]));
+				rt = 1;
+			}
+		}
+	}
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyAllocationSamples(pugi::xml_node node)
+{
+	double tolerance = node.attribute("tolerance").as_double();
+	double expected = expectedAllocationSamples;
+	gcTestEnv->log("Allocation samples: %zu for %zu bytes allocated, %.1f expected sampling every %zu bytes\n",
+			allocationSampleCount, allocatedBytes, expected, env->getExtensions()->allocationSamplingInterval);
+
+	int32_t rt = 0;
+	if (0 != allocationSampleErrors) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %zu invalid allocation samples.\n", __FILE__, __LINE__, allocationSampleErrors);
+		rt = 1;
+	} else if ((0 == allocationSampleCount)
+		|| ((double)allocationSampleCount < (expected * (1.0 - tolerance)))
+		|| ((double)allocationSampleCount > (expected * (1.0 + tolerance)))
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sample count %zu is not within %.0f%% of %.1f.\n",
+				__FILE__, __LINE__, allocationSampleCount, tolerance * 100.0, expected);
+		rt = 1;
+	}
+	return rt;
+}
+
 ObjectEntry *
 GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size)
 {
@@ -1037,6 +1280,7 @@ TEST_P(GCConfigTest, test)
 				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
+			reportAllocLatency();
 		} else if (0 == strcmp(configChild.name(), "verification")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++Verification++++++++++++++++++++++++++\n");
 			/* verboseGC verification */
@@ -1044,8 +1288,22 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
-			rt = verifyVerboseGC(verboseGCs);
-			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			if (!verboseGCs.empty()) {
+				rt = verifyVerboseGC(verboseGCs);
+				ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			}
+			/* binary verbose GC event log verification */
+			pugi::xml_node verboseEventLog = configChild.child("verboseEventLog");
+			if (verboseEventLog) {
+				rt = verifyVerboseEventLog(verboseEventLog);
+				ASSERT_EQ(0, rt) << "Failed in verbose GC event log verification.";
+			}
+			/* allocation sample count verification */
+			pugi::xml_node allocationSamples = configChild.child("allocationSamples");
+			if (allocationSamples) {
+				rt = verifyAllocationSamples(allocationSamples);
+				ASSERT_EQ(0, rt) << "Failed in allocation sample verification.";
+			}
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
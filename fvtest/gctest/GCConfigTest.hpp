@@ -87,6 +87,16 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	/* allocation latency, bucket i counts the allocations which took at least 2^i and less than 2^(i+1) nanoseconds */
+	uintptr_t allocLatencyHistogram[64];
+	uintptr_t allocLatencyCount;
+
+	/* allocation samples reported through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE when allocationSamplingInterval is set */
+	uintptr_t allocatedBytes;
+	double expectedAllocationSamples;
+	uintptr_t allocationSampleCount;
+	uintptr_t allocationSampleErrors;
+
 	/*
 	 * Function members
 	 */
@@ -95,6 +105,12 @@ protected:
 	int32_t parseAttribute(AttributeElem **root, const char *attrStr);
 	OMRGCObjectType parseObjectType(pugi::xml_node node);
 	ObjectEntry *allocateHelper(const char *objName, uintptr_t size);
+	void recordAllocLatency(uint64_t startTime);
+	uint64_t allocLatencyPercentile(uintptr_t percentile);
+	void reportAllocLatency();
+	static void allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	int32_t verifyAllocationSamples(pugi::xml_node node);
+	int32_t verifyVerboseEventLog(pugi::xml_node node);
 	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size);
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
 	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
@@ -159,7 +175,13 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocLatencyCount(0)
+		, allocatedBytes(0)
+		, expectedAllocationSamples(0.0)
+		, allocationSampleCount(0)
+		, allocationSampleErrors(0)
 	{
+		memset(allocLatencyHistogram, 0, sizeof(allocLatencyHistogram));
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
 		gp.frequency = "none";
@@ -24,6 +24,23 @@
 #include <string.h>
 #include "pugixml.hpp"
 
+static bool
+parseMetadataPagePolicy(const char *value, MM_GCExtensionsBase::MetadataPagePolicy *pagePolicy)
+{
+	bool result = true;
+	if (0 == j9_cmdla_stricmp(value, "default")) {
+		*pagePolicy = MM_GCExtensionsBase::METADATA_PAGE_POLICY_DEFAULT;
+	} else if (0 == j9_cmdla_stricmp(value, "huge")) {
+		*pagePolicy = MM_GCExtensionsBase::METADATA_PAGE_POLICY_HUGE;
+	} else if (0 == j9_cmdla_stricmp(value, "transparent")) {
+		*pagePolicy = MM_GCExtensionsBase::METADATA_PAGE_POLICY_TRANSPARENT;
+	} else {
+		gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized page policy (expected default, huge or transparent): %s\n", value);
+		result = false;
+	}
+	return result;
+}
+
 bool
 MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensions)
 {
@@ -83,7 +100,56 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "workPacketStealing")) {
+					extensions->workPacketStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "splitFreeListSplitAmount")) {
+					extensions->splitFreeListSplitAmount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "splitFreeListSearchCursors")) {
+					extensions->splitFreeListSearchCursors = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "gcSyncTreeBarrier")) {
+					extensions->gcSyncTreeBarrier = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcSyncBarrierSpinCount")) {
+					extensions->gcSyncBarrierSpinCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "syncPointStats")) {
+					extensions->syncPointStatsEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTaskThreading")) {
+					extensions->adaptiveTaskThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveTaskThreadingTargetThreadTime")) {
+					extensions->adaptiveTaskThreadingTargetThreadTime = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "vectorHeapMapScan")) {
+					extensions->vectorHeapMapScan = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSweepSegregated")) {
+					extensions->concurrentSweepSegregated = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentSweepSegregatedThreads")) {
+					extensions->concurrentSweepSegregatedThreads = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedYoungCollection")) {
+					extensions->segregatedYoungCollection = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedYoungCollectionsPerFullCollection")) {
+					extensions->segregatedYoungCollectionsPerFullCollection = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "segregatedRegionRefillBatchSize")) {
+					extensions->segregatedRegionRefillBatchSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "pretouchHeapOnExpand")) {
+					extensions->pretouchHeapOnExpand = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "pretouchHeapInParallel")) {
+					extensions->pretouchHeapInParallel = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "pretouchHeapInBackground")) {
+					extensions->pretouchHeapInBackground = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "verboseEventLog")) {
+					extensions->verboseEventLog = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verboseEventLogRecords")) {
+					extensions->verboseEventLogRecords = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapMapPagePolicy")) {
+					result = parseMetadataPagePolicy(attr.value(), &extensions->heapMapPagePolicy);
+				} else if (0 == strcmp(attr.name(), "cardTablePagePolicy")) {
+					result = parseMetadataPagePolicy(attr.value(), &extensions->cardTablePagePolicy);
+				} else if (0 == strcmp(attr.name(), "compactTablePagePolicy")) {
+					result = parseMetadataPagePolicy(attr.value(), &extensions->compactTablePagePolicy);
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +157,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,12 +173,51 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentCardCleaningQueue")) {
+					extensions->concurrentCardCleaningQueue = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentCardCleaningQueueSize")) {
+					extensions->concurrentCardCleaningQueueSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "finalCardCleaningPauseTarget")) {
+					/* in milliseconds, which may be fractional */
+					extensions->finalCardCleaningPauseTarget = (uintptr_t)(atof(attr.value()) * 1000.0);
+				} else if (0 == strcmp(attr.name(), "concurrentBackground")) {
+					extensions->concurrentBackground = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNUMAPartitioning")) {
+					extensions->scavengerNUMAPartitioning = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "hierarchicalDepthCopy")) {
+					extensions->hierarchicalDepthCopy = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "alwaysDepthCopyFirstOffset")) {
+					extensions->alwaysDepthCopyFirstOffset = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "depthCopyMax")) {
+					extensions->depthCopyMax = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetOverflowMap")) {
+					extensions->scavengerRememberedSetOverflowMap = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaximumSize")) {
+					extensions->fvtest_rememberedSetMaximumSize = atoi(attr.value());
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "preZeroNurseryInBackground")) {
+					extensions->preZeroNurseryInBackground = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					bool compact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->compactOnGlobalGC = compact ? 1 : 0;
+					extensions->noCompactOnGlobalGC = compact ? 0 : 1;
+				} else if (0 == strcmp(attr.name(), "compactSliding")) {
+					extensions->compactSliding = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -117,6 +228,17 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
 #endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+			if (extensions->segregatedYoungCollection && !_useSegregatedGC) {
+				gcTestEnv->log(LEVEL_ERROR, "Failed: segregatedYoungCollection requires the segregated heap\n");
+				result = false;
+			}
+#else /* defined(OMR_GC_SEGREGATED_HEAP) */
+			if (extensions->segregatedYoungCollection) {
+				gcTestEnv->log(LEVEL_ERROR, "Failed: segregatedYoungCollection requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+				result = false;
+			}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 		}
 	}
 	return result;
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "AdaptiveTaskThreading.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "StartupManagerTestExample.hpp"
+#include "Task.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define MAXIMUM_THREADS 8
+#define TARGET_THREAD_TIME 1000
+/* Work done per microsecond of thread time by the task, whatever its thread count */
+#define THROUGHPUT 4
+
+/* A task which only reports the work it was given */
+class TestTask : public MM_Task
+{
+public:
+	uintptr_t _work;
+
+	virtual void run(MM_EnvironmentBase *env) {}
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_DISPATCHER_IDLE; }
+	virtual uintptr_t getCompletedWork() { return _work; }
+
+	TestTask(MM_EnvironmentBase *env)
+		: MM_Task(env, NULL)
+		, _work(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+class TestAdaptiveTaskThreading : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_AdaptiveTaskThreading *adaptiveTaskThreading;
+	uintptr_t targetThreadTime;
+	float weight;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		adaptiveTaskThreading = NULL;
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		targetThreadTime = extensions->adaptiveTaskThreadingTargetThreadTime;
+		weight = extensions->adaptiveTaskThreadingWeight;
+		extensions->adaptiveTaskThreadingTargetThreadTime = TARGET_THREAD_TIME;
+		extensions->adaptiveTaskThreadingWeight = 0.5f;
+
+		adaptiveTaskThreading = MM_AdaptiveTaskThreading::newInstance(env);
+		ASSERT_TRUE(NULL != adaptiveTaskThreading);
+	}
+
+	virtual void TearDown()
+	{
+		if (NULL != adaptiveTaskThreading) {
+			adaptiveTaskThreading->kill(env);
+			adaptiveTaskThreading = NULL;
+		}
+		if (NULL != exampleVM->_omrVMThread) {
+			MM_GCExtensionsBase *extensions = env->getExtensions();
+			extensions->adaptiveTaskThreadingTargetThreadTime = targetThreadTime;
+			extensions->adaptiveTaskThreadingWeight = weight;
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	/* Run the task with the recommended thread count, scaling perfectly, and return the count */
+	uintptr_t run(TestTask *task, uintptr_t work)
+	{
+		uintptr_t threadCount = adaptiveTaskThreading->getRecommendedThreadCount(env, task, MAXIMUM_THREADS);
+		task->_work = work;
+		adaptiveTaskThreading->taskCompleted(env, task, threadCount, (work / THROUGHPUT) / threadCount);
+		return threadCount;
+	}
+};
+
+TEST_F(TestAdaptiveTaskThreading, ThreadCountFollowsWork)
+{
+	TestTask task(env);
+	uintptr_t heavyWork = MAXIMUM_THREADS * TARGET_THREAD_TIME * THROUGHPUT;
+	uintptr_t lightWork = (TARGET_THREAD_TIME * THROUGHPUT) / 2;
+
+	/* a task with no history gets the maximum, and keeps it while its work needs it */
+	ASSERT_EQ((uintptr_t)MAXIMUM_THREADS, run(&task, heavyWork));
+	ASSERT_EQ((uintptr_t)MAXIMUM_THREADS, run(&task, heavyWork));
+
+	/* the count shrinks as the expected work does, down to one thread */
+	uintptr_t threadCount = MAXIMUM_THREADS;
+	for (uintptr_t i = 0; i < 16; i++) {
+		uintptr_t nextThreadCount = run(&task, lightWork);
+		ASSERT_LE(nextThreadCount, threadCount) << "run " << i;
+		threadCount = nextThreadCount;
+	}
+	ASSERT_EQ((uintptr_t)1, threadCount);
+
+	/* and grows back up to the maximum when the work does */
+	for (uintptr_t i = 0; i < 16; i++) {
+		uintptr_t nextThreadCount = run(&task, heavyWork);
+		ASSERT_GE(nextThreadCount, threadCount) << "run " << i;
+		threadCount = nextThreadCount;
+	}
+	ASSERT_EQ((uintptr_t)MAXIMUM_THREADS, threadCount);
+
+	/* more work than the maximum can take in the target time still gets the maximum only */
+	ASSERT_EQ((uintptr_t)MAXIMUM_THREADS, run(&task, heavyWork * 4));
+	ASSERT_EQ((uintptr_t)MAXIMUM_THREADS, run(&task, heavyWork * 4));
+
+	/* the entry reports the thread time each of the last two counts was picked for */
+	MM_AdaptiveTaskThreading::Entry *entry = adaptiveTaskThreading->getEntry(0);
+	ASSERT_TRUE(NULL != entry);
+	EXPECT_EQ((uintptr_t)MAXIMUM_THREADS, entry->_recommendedThreadCount);
+	EXPECT_EQ((uintptr_t)MAXIMUM_THREADS, entry->_previousRecommendedThreadCount);
+	EXPECT_LT(entry->_previousPredictedThreadTime, entry->_predictedThreadTime);
+}
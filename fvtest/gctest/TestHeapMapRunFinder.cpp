@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "HeapMapRunFinder.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Long enough for several 256 bit steps of the vector kernels plus a partial one */
+#define MAP_SLOTS 21
+
+/* Single bits at the start and end of a slot, and a full slot */
+static const uintptr_t markPatterns[] = {1, (uintptr_t)1 << ((sizeof(uintptr_t) * 8) - 1), ~(uintptr_t)0};
+
+class TestHeapMapRunFinder : public ::testing::Test
+{
+protected:
+    MM_HeapMapRunFinder scalar;
+    MM_HeapMapRunFinder vector;
+    uintptr_t map[MAP_SLOTS];
+
+    virtual void SetUp()
+    {
+        scalar.initialize(gcTestEnv->getPortLibrary(), false);
+        vector.initialize(gcTestEnv->getPortLibrary(), true);
+        ASSERT_EQ(MM_HeapMapRunFinder::kernel_scalar, scalar.getKernel());
+        gcTestEnv->log("Vector kernel: %s\n", vector.getKernelName());
+    }
+
+    /* Compare both finders with the expected slot for every range of the map */
+    void checkAllRanges()
+    {
+        for (uintptr_t first = 0; first <= MAP_SLOTS; first++) {
+            for (uintptr_t last = first; last <= MAP_SLOTS; last++) {
+                uintptr_t *current = map + first;
+                uintptr_t *top = map + last;
+
+                uintptr_t *expectedNonEmpty = current;
+                while ((expectedNonEmpty < top) && (0 == *expectedNonEmpty)) {
+                    expectedNonEmpty += 1;
+                }
+                uintptr_t *expectedEmpty = current;
+                while ((expectedEmpty < top) && (0 != *expectedEmpty)) {
+                    expectedEmpty += 1;
+                }
+
+                ASSERT_EQ(expectedNonEmpty, scalar.findNonEmptySlot(current, top)) << "range [" << first << ", " << last << ")";
+                ASSERT_EQ(expectedNonEmpty, vector.findNonEmptySlot(current, top)) << "range [" << first << ", " << last << ")";
+                ASSERT_EQ(expectedEmpty, scalar.findEmptySlot(current, top)) << "range [" << first << ", " << last << ")";
+                ASSERT_EQ(expectedEmpty, vector.findEmptySlot(current, top)) << "range [" << first << ", " << last << ")";
+            }
+        }
+    }
+};
+
+TEST_F(TestHeapMapRunFinder, EmptyAndFullMaps)
+{
+    memset(map, 0, sizeof(map));
+    checkAllRanges();
+
+    for (size_t pattern = 0; pattern < sizeof(markPatterns) / sizeof(markPatterns[0]); pattern++) {
+        for (uintptr_t i = 0; i < MAP_SLOTS; i++) {
+            map[i] = markPatterns[pattern];
+        }
+        checkAllRanges();
+    }
+}
+
+TEST_F(TestHeapMapRunFinder, SingleMarkedSlot)
+{
+    for (size_t pattern = 0; pattern < sizeof(markPatterns) / sizeof(markPatterns[0]); pattern++) {
+        for (uintptr_t marked = 0; marked < MAP_SLOTS; marked++) {
+            memset(map, 0, sizeof(map));
+            map[marked] = markPatterns[pattern];
+            checkAllRanges();
+        }
+    }
+}
+
+TEST_F(TestHeapMapRunFinder, SingleEmptySlot)
+{
+    for (size_t pattern = 0; pattern < sizeof(markPatterns) / sizeof(markPatterns[0]); pattern++) {
+        for (uintptr_t empty = 0; empty < MAP_SLOTS; empty++) {
+            for (uintptr_t i = 0; i < MAP_SLOTS; i++) {
+                map[i] = markPatterns[pattern];
+            }
+            map[empty] = 0;
+            checkAllRanges();
+        }
+    }
+}
+
+TEST_F(TestHeapMapRunFinder, MixedRuns)
+{
+    /* deterministic runs of random length, alternating between empty and marked slots */
+    uint32_t seed = 0x2545F491;
+    for (uintptr_t iteration = 0; iteration < 64; iteration++) {
+        bool marked = (0 != (iteration & 1));
+        uintptr_t i = 0;
+        while (i < MAP_SLOTS) {
+            seed = (seed * 1103515245) + 12345;
+            uintptr_t runLength = 1 + ((seed >> 16) % 6);
+            for (; (0 < runLength) && (i < MAP_SLOTS); runLength--, i++) {
+                map[i] = marked ? markPatterns[(seed >> 8) % 3] : 0;
+            }
+            marked = !marked;
+        }
+        checkAllRanges();
+    }
+}
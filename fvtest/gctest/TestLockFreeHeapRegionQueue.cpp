@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define REGION_COUNT 64
+#define STRESS_THREADS 4
+#define STRESS_ITERATIONS 20000
+/* Each stress thread holds at most 4 regions, so a queue of this many is never empty */
+#define STRESS_REGION_COUNT ((STRESS_THREADS * 4) + 1)
+
+/* A region manager over a table of descriptors owned by the test, the queue only maps between descriptors and table indices */
+class TestRegionManager : public MM_HeapRegionManager
+{
+public:
+	TestRegionManager(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *table, uintptr_t count)
+		: MM_HeapRegionManager(env, 0, sizeof(MM_HeapRegionDescriptorSegregated), NULL, NULL)
+	{
+		_regionTable = table;
+		_tableRegionCount = count;
+	}
+};
+
+struct StressData {
+	MM_LockFreeHeapRegionQueue *shared;
+	TestRegionManager *regionManager;
+	uintptr_t seed;
+	volatile uintptr_t *failures;
+};
+
+class TestLockFreeHeapRegionQueue : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_HeapRegionDescriptorSegregated *table;
+	TestRegionManager *regionManager;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		env = NULL;
+		table = NULL;
+		regionManager = NULL;
+
+		/* The region descriptors are built from a GC environment */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/sample_GC_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		table = (MM_HeapRegionDescriptorSegregated *)env->getForge()->allocate(sizeof(MM_HeapRegionDescriptorSegregated) * REGION_COUNT, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != table);
+		for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+			new (&table[i]) MM_HeapRegionDescriptorSegregated(env, NULL, NULL);
+		}
+		regionManager = (TestRegionManager *)env->getForge()->allocate(sizeof(TestRegionManager), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		ASSERT_TRUE(NULL != regionManager);
+		new (regionManager) TestRegionManager(env, table, REGION_COUNT);
+	}
+
+	virtual void TearDown()
+	{
+		/* The table belongs to the test, so the region manager is not torn down */
+		if (NULL != regionManager) {
+			env->getForge()->free(regionManager);
+		}
+		if (NULL != table) {
+			env->getForge()->free(table);
+		}
+		if (NULL != exampleVM->_omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	/* Dequeue every region of the queue, checking that each of them is seen once and that the count is right */
+	void drainAndCheck(MM_LockFreeHeapRegionQueue *queue, uintptr_t expectedCount)
+	{
+		bool seen[REGION_COUNT];
+		memset(seen, 0, sizeof(seen));
+		ASSERT_EQ(expectedCount, queue->getTotalRegions());
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		uintptr_t count = 0;
+		while (NULL != (region = queue->dequeue())) {
+			uintptr_t index = regionManager->mapDescriptorToRegionTableIndex(region);
+			ASSERT_LT(index, (uintptr_t)REGION_COUNT);
+			ASSERT_FALSE(seen[index]) << "region " << index << " dequeued twice";
+			ASSERT_TRUE(NULL == region->getNext());
+			seen[index] = true;
+			count += 1;
+		}
+		ASSERT_EQ(expectedCount, count);
+		ASSERT_TRUE(queue->isEmpty());
+		ASSERT_EQ((uintptr_t)0, queue->getTotalRegions());
+	}
+};
+
+TEST_F(TestLockFreeHeapRegionQueue, EnqueueDequeue)
+{
+	MM_LockFreeHeapRegionQueue queue(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	ASSERT_TRUE(queue.isEmpty());
+	ASSERT_TRUE(NULL == queue.dequeue());
+
+	for (uintptr_t i = 0; i < 4; i++) {
+		queue.enqueue(&table[i]);
+	}
+	ASSERT_FALSE(queue.isEmpty());
+	ASSERT_EQ((uintptr_t)4, queue.getTotalRegions());
+
+	/* Regions come back last in, first out */
+	for (intptr_t i = 3; i >= 0; i--) {
+		MM_HeapRegionDescriptorSegregated *region = queue.dequeue();
+		ASSERT_EQ(&table[i], region);
+		ASSERT_TRUE(NULL == region->getNext());
+	}
+	ASSERT_TRUE(queue.isEmpty());
+	ASSERT_TRUE(NULL == queue.dequeueIfNonEmpty());
+}
+
+TEST_F(TestLockFreeHeapRegionQueue, BatchDequeue)
+{
+	MM_LockFreeHeapRegionQueue source(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	MM_LockFreeHeapRegionQueue target(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	for (uintptr_t i = 0; i < 10; i++) {
+		source.enqueue(&table[i]);
+	}
+
+	ASSERT_EQ((uintptr_t)4, source.dequeue(&target, 4));
+	ASSERT_EQ((uintptr_t)6, source.getTotalRegions());
+	ASSERT_EQ((uintptr_t)4, target.getTotalRegions());
+
+	/* A batch larger than the queue takes what is there */
+	ASSERT_EQ((uintptr_t)6, source.dequeue(&target, 100));
+	ASSERT_TRUE(source.isEmpty());
+	ASSERT_EQ((uintptr_t)0, source.dequeue(&target, 4));
+
+	drainAndCheck(&target, 10);
+}
+
+TEST_F(TestLockFreeHeapRegionQueue, EnqueueQueue)
+{
+	MM_LockFreeHeapRegionQueue source(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	MM_LockFreeHeapRegionQueue target(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	for (uintptr_t i = 0; i < 5; i++) {
+		source.enqueue(&table[i]);
+	}
+	for (uintptr_t i = 5; i < 8; i++) {
+		target.enqueue(&table[i]);
+	}
+
+	target.enqueue(&source);
+	ASSERT_TRUE(source.isEmpty());
+	ASSERT_EQ((uintptr_t)0, source.getTotalRegions());
+
+	/* Moving an empty queue is a no-op */
+	target.enqueue(&source);
+	drainAndCheck(&target, 8);
+}
+
+TEST_F(TestLockFreeHeapRegionQueue, Remove)
+{
+	MM_LockFreeHeapRegionQueue queue(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	for (uintptr_t i = 0; i < 6; i++) {
+		queue.enqueue(&table[i]);
+	}
+
+	/* the top, the bottom and a region in between, leaving the others in order */
+	ASSERT_TRUE(queue.remove(&table[5]));
+	ASSERT_TRUE(queue.remove(&table[0]));
+	ASSERT_TRUE(queue.remove(&table[2]));
+	ASSERT_TRUE(NULL == table[2].getNext());
+	ASSERT_FALSE(queue.remove(&table[2]));
+	ASSERT_FALSE(queue.remove(&table[10]));
+	ASSERT_EQ((uintptr_t)3, queue.getTotalRegions());
+
+	ASSERT_EQ(&table[4], queue.dequeue());
+	ASSERT_EQ(&table[3], queue.dequeue());
+	ASSERT_TRUE(queue.remove(&table[1]));
+	ASSERT_TRUE(queue.isEmpty());
+	ASSERT_EQ((uintptr_t)0, queue.getTotalRegions());
+	ASSERT_FALSE(queue.remove(&table[1]));
+}
+
+TEST_F(TestLockFreeHeapRegionQueue, FreeListDetach)
+{
+	MM_LockFreeFreeHeapRegionList list(regionManager, MM_HeapRegionList::HRL_KIND_FREE);
+	for (uintptr_t i = 0; i < 4; i++) {
+		table[i].setRangeCount(1);
+		list.push(&table[i]);
+	}
+
+	list.detach(&table[1]);
+	list.detach(&table[3]);
+	ASSERT_EQ((uintptr_t)2, list.getTotalRegions());
+	ASSERT_EQ(&table[2], list.pop());
+	ASSERT_EQ(&table[0], list.pop());
+	ASSERT_TRUE(list.isEmpty());
+	ASSERT_TRUE(NULL == list.pop());
+}
+
+static int J9THREAD_PROC
+stressThread(void *arg)
+{
+	StressData *data = (StressData *)arg;
+	MM_LockFreeHeapRegionQueue local(data->regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	uintptr_t seed = data->seed;
+
+	for (uintptr_t i = 0; i < STRESS_ITERATIONS; i++) {
+		seed = (seed * 1103515245) + 12345;
+		uintptr_t count = 1 + ((seed >> 16) % 4);
+		uintptr_t moved = data->shared->dequeue(&local, count);
+		/* the shared queue always holds a region, even while another thread is between publishing its push and counting it */
+		if ((0 == moved) || (moved > count) || (moved != local.getTotalRegions())) {
+			MM_AtomicOperations::add(data->failures, 1);
+		}
+		/* Give the regions back either one at a time or all at once */
+		if (0 == ((seed >> 8) & 1)) {
+			MM_HeapRegionDescriptorSegregated *region = NULL;
+			while (NULL != (region = local.dequeue())) {
+				data->shared->enqueue(region);
+			}
+		} else {
+			data->shared->enqueue(&local);
+		}
+		if (0 == (i % 64)) {
+			omrthread_yield();
+		}
+	}
+	return 0;
+}
+
+TEST_F(TestLockFreeHeapRegionQueue, ConcurrentBatches)
+{
+	MM_LockFreeHeapRegionQueue shared(regionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	for (uintptr_t i = 0; i < STRESS_REGION_COUNT; i++) {
+		shared.enqueue(&table[i]);
+	}
+
+	volatile uintptr_t failures = 0;
+	StressData data[STRESS_THREADS];
+	omrthread_t threads[STRESS_THREADS];
+	omrthread_attr_t attr = NULL;
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	for (uintptr_t i = 0; i < STRESS_THREADS; i++) {
+		data[i].shared = &shared;
+		data[i].regionManager = regionManager;
+		data[i].seed = i + 1;
+		data[i].failures = &failures;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, stressThread, &data[i]));
+	}
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	for (uintptr_t i = 0; i < STRESS_THREADS; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+
+	ASSERT_EQ((uintptr_t)0, failures);
+	/* No region may be lost or duplicated by the racing batches */
+	drainAndCheck(&shared, STRESS_REGION_COUNT);
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "NurseryPreZeroer.hpp"
+#include "Object.hpp"
+#include "ObjectAllocationInterface.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "Scavenger.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define OBJECT_SIZE 256
+/* More objects than fit in the nursery, so allocating them all goes through a scavenge */
+#define NURSERY_OBJECT_COUNT (4 * 1024 * 1024 / OBJECT_SIZE)
+
+class TestNurseryPreZeroer : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_NurseryPreZeroer *preZeroer;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		env = NULL;
+		extensions = NULL;
+		preZeroer = NULL;
+
+		/* batch cleared TLHs, with survivor space zeroed in the background between scavenges */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/scavenger_GC_prezero_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+		ASSERT_TRUE(extensions->preZeroNurseryInBackground && (0 != extensions->batchClearTLH));
+		preZeroer = extensions->scavenger->getNurseryPreZeroer();
+		ASSERT_TRUE(NULL != preZeroer);
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+	}
+
+	virtual void TearDown()
+	{
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		if (NULL != exampleVM->_omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	Object *allocateObject(bool noGc)
+	{
+		uint8_t allocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *allocationModel = new(allocationModelSpace)
+				MM_ObjectAllocationModel(env, OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, noGc));
+		return (Object *)OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel);
+	}
+
+	/* Allocate garbage until a scavenge is done */
+	void allocateThroughScavenge()
+	{
+		uintptr_t gcCount = extensions->scavengerStats._gcCount;
+		for (uintptr_t i = 0; (i < NURSERY_OBJECT_COUNT) && (gcCount == extensions->scavengerStats._gcCount); i++) {
+			ASSERT_TRUE(NULL != allocateObject(false)) << "object " << i;
+		}
+		ASSERT_NE(gcCount, extensions->scavengerStats._gcCount);
+	}
+};
+
+TEST_F(TestNurseryPreZeroer, PreZeroedTLHsAreZero)
+{
+	/* the first scavenge starts zeroing the survivor space of the next one; wait for the background thread to zero all of it */
+	allocateThroughScavenge();
+	ASSERT_TRUE(preZeroer->waitUntilZeroed());
+
+	/* survivor space, empty since everything allocated is garbage, is now allocate space */
+	allocateThroughScavenge();
+	uintptr_t low = extensions->preZeroedNurseryLow;
+	uintptr_t high = extensions->preZeroedNurseryHigh;
+	gcTestEnv->log("Pre-zeroed nursery: [%p, %p), %zu bytes\n", (void *)low, (void *)high, high - low);
+	ASSERT_LT(low, high);
+
+	/* objects allocated from batch cleared TLHs are not cleared, so they show what the TLH held */
+	MM_AllocationStats *allocationStats = env->_objectAllocationInterface->getAllocationStats();
+	uintptr_t preZeroedBytes = allocationStats->_tlhAllocatedPreZeroed;
+	uintptr_t objectsChecked = 0;
+	for (uintptr_t i = 0; i < NURSERY_OBJECT_COUNT; i++) {
+		Object *object = allocateObject(true);
+		if (NULL == object) {
+			break;
+		}
+		if (((uintptr_t)object >= low) && (((uintptr_t)object + OBJECT_SIZE) <= high)) {
+			uint8_t *slots = (uint8_t *)object->slots();
+			for (size_t offset = 0; offset < object->sizeOfSlotsInBytes(); offset++) {
+				ASSERT_EQ(0, slots[offset]) << "object " << (void *)object << " offset " << offset;
+			}
+			objectsChecked += 1;
+		}
+	}
+	gcTestEnv->log("Objects checked: %zu\n", objectsChecked);
+	ASSERT_LT((uintptr_t)0, objectsChecked);
+
+	/* the TLHs holding them were refreshed from the pre-zeroed range without being cleared */
+	preZeroedBytes = allocationStats->_tlhAllocatedPreZeroed - preZeroedBytes;
+	gcTestEnv->log("Pre-zeroed TLH bytes: %zu\n", preZeroedBytes);
+	ASSERT_LE(objectsChecked * OBJECT_SIZE, preZeroedBytes);
+	ASSERT_GE(high - low, preZeroedBytes);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_STANDARD)
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkMap.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <stdio.h>
+
+/* Enough objects for the heap to be split into several sections of PARALLEL_WALK_SECTION_SIZE_MINIMUM */
+#define OBJECT_COUNT 8192
+#define OBJECT_SIZE 512
+#define ROOT_NAME_LENGTH 16
+/* Number of live objects at the bottom of the heap left unmarked for the parallel walk */
+#define UNMARKED_COUNT 4
+
+struct WalkData {
+	omrobjectptr_t *visited;
+	volatile uintptr_t visitedCount;
+	uintptr_t capacity;
+	omrobjectptr_t slowTop; /* objects below are walked slowly, so their walker falls behind and the others steal from it */
+};
+
+static void
+recordObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	WalkData *data = (WalkData *)userData;
+	uintptr_t index = MM_AtomicOperations::add(&data->visitedCount, 1) - 1;
+	if (index < data->capacity) {
+		data->visited[index] = object;
+	}
+	if ((object < data->slowTop) && (0 == (index % 64))) {
+		omrthread_sleep(1);
+	}
+}
+
+class TestParallelHeapWalker : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	char *rootNames;
+	omrobjectptr_t *roots;
+	uintptr_t rootCount;
+
+	virtual void SetUp()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		exampleVM = &gcTestEnv->exampleVM;
+		env = NULL;
+		rootNames = NULL;
+		roots = NULL;
+		rootCount = 0;
+
+		/* The work stealing configuration walks with four GC threads */
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_workstealing_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+		rootNames = (char *)omrmem_allocate_memory(OBJECT_COUNT * ROOT_NAME_LENGTH, OMRMEM_CATEGORY_MM);
+		roots = (omrobjectptr_t *)omrmem_allocate_memory(OBJECT_COUNT * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+		ASSERT_TRUE((NULL != rootNames) && (NULL != roots));
+	}
+
+	virtual void TearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		omrmem_free_memory(rootNames);
+		omrmem_free_memory(roots);
+		if (NULL != exampleVM->_omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	/* Allocate the objects, rooting three of every four so the others are collected */
+	void allocateObjects()
+	{
+		uint8_t allocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		for (uintptr_t i = 0; i < OBJECT_COUNT; i++) {
+			MM_ObjectAllocationModel *allocationModel = new(allocationModelSpace)
+					MM_ObjectAllocationModel(env, OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+			omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel);
+			ASSERT_TRUE(NULL != object) << "object " << i;
+			if (0 != (i % 4)) {
+				RootEntry rootEntry;
+				rootEntry.name = rootNames + (rootCount * ROOT_NAME_LENGTH);
+				snprintf((char *)rootEntry.name, ROOT_NAME_LENGTH, "root%zu", (size_t)rootCount);
+				rootEntry.rootPtr = object;
+				ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+				rootCount += 1;
+			}
+		}
+	}
+
+	/* Collect the objects of a walk, sorted by address */
+	void walk(MM_ParallelHeapWalker *heapWalker, bool parallel, omrobjectptr_t slowTop, omrobjectptr_t *visited, uintptr_t capacity, uintptr_t *count)
+	{
+		WalkData data;
+		data.visited = visited;
+		data.visitedCount = 0;
+		data.capacity = capacity;
+		data.slowTop = slowTop;
+		heapWalker->allObjectsDo(env, recordObject, &data, 0, parallel, false);
+		ASSERT_LE(data.visitedCount, capacity);
+		std::sort(visited, visited + data.visitedCount);
+		*count = data.visitedCount;
+	}
+};
+
+TEST_F(TestParallelHeapWalker, WalkBySectionsVisitsEveryObjectOnce)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getHeapWalker();
+
+	allocateObjects();
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_NOT_AGGRESSIVE));
+
+	/* the roots are found by the walk where the collector left them */
+	J9HashTableState state;
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	uintptr_t liveCount = 0;
+	while (NULL != rootEntry) {
+		roots[liveCount] = rootEntry->rootPtr;
+		liveCount += 1;
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+	ASSERT_EQ(rootCount, liveCount);
+	std::sort(roots, roots + liveCount);
+
+	uintptr_t capacity = OBJECT_COUNT * 2;
+	omrobjectptr_t *serial = (omrobjectptr_t *)omrmem_allocate_memory(capacity * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	omrobjectptr_t *parallel = (omrobjectptr_t *)omrmem_allocate_memory(capacity * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE((NULL != serial) && (NULL != parallel));
+
+	uintptr_t serialCount = 0;
+	walk(heapWalker, false, NULL, serial, capacity, &serialCount);
+
+	/* The mark map is only valid inside a collection; the marks of the live objects are still there, so walk
+	 * as a collection would. The walker of the first quarter of the live objects is slowed down. The first
+	 * objects of the heap are unmarked, as dead objects at the start of a region would be, and must still be walked.
+	 */
+	uintptr_t parallelCount = 0;
+	MM_MarkMap *markMap = heapWalker->getMarkMap();
+	for (uintptr_t i = 0; i < UNMARKED_COUNT; i++) {
+		markMap->clearBit(roots[i]);
+	}
+	markMap->setMarkMapValid(true);
+	walk(heapWalker, true, roots[liveCount / 4], parallel, capacity, &parallelCount);
+	markMap->setMarkMapValid(false);
+	for (uintptr_t i = 0; i < UNMARKED_COUNT; i++) {
+		markMap->setBit(roots[i]);
+	}
+
+	gcTestEnv->log("Objects: %zu walked serially, %zu in parallel; sections: %zu, %zu stolen\n",
+			serialCount, parallelCount, heapWalker->getSectionCount(), heapWalker->getSectionsStolen());
+	EXPECT_LT((uintptr_t)1, heapWalker->getSectionCount());
+
+	/* the parallel walk visits exactly the objects of the serial walk, dead ones included, each once */
+	ASSERT_EQ(serialCount, parallelCount);
+	for (uintptr_t i = 0; i < parallelCount; i++) {
+		ASSERT_EQ(serial[i], parallel[i]) << "object " << i << " of the walks";
+	}
+
+	/* every live object is walked */
+	ASSERT_TRUE(std::includes(parallel, parallel + parallelCount, roots, roots + liveCount));
+
+	omrmem_free_memory(serial);
+	omrmem_free_memory(parallel);
+}
+
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryPoolSegregated.hpp"
+#include "MemorySubSpace.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "RegionPoolSegregated.hpp"
+#include "SegregatedGC.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "SweepSchemeSegregated.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+/* Enough garbage in two size classes to fill a few regions of each */
+#define OBJECT_COUNT 4096
+#define SMALL_OBJECT_SIZE 64
+#define LARGER_OBJECT_SIZE 448
+
+/*
+ * Runs the segregated collector over a segregated heap, with a concurrent sweep left queued by every collection.
+ */
+class TestSegregatedConcurrentSweep : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_SegregatedGC *collector;
+	MM_SweepSchemeSegregated *sweepScheme;
+	MM_MemoryPoolSegregated *memoryPool;
+	MM_RegionPoolSegregated *regionPool;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		env = NULL;
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/segregated_GC_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+		collector = (MM_SegregatedGC *)extensions->getGlobalCollector();
+		sweepScheme = collector->getSweepScheme();
+		memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+		regionPool = memoryPool->getRegionPool();
+		ASSERT_TRUE(extensions->concurrentSweepSegregated);
+	}
+
+	virtual void TearDown()
+	{
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		if (NULL != exampleVM->_omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	/* Allocate objects which nothing refers to, without collecting */
+	uintptr_t allocateGarbage()
+	{
+		uintptr_t allocated = 0;
+		for (uintptr_t i = 0; i < OBJECT_COUNT; i++) {
+			uintptr_t size = (0 == (i % 4)) ? LARGER_OBJECT_SIZE : SMALL_OBJECT_SIZE;
+			uint8_t allocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+			MM_ObjectAllocationModel *allocationModel = new(allocationModelSpace)
+					MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			if (NULL != OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel)) {
+				allocated += 1;
+			}
+		}
+		return allocated;
+	}
+
+	uintptr_t countSingleFreeRegions()
+	{
+		uintptr_t single = 0;
+		uintptr_t multi = 0;
+		uintptr_t coalesce = 0;
+		regionPool->countFreeRegions(&single, &multi, &coalesce);
+		return single;
+	}
+};
+
+TEST_F(TestSegregatedConcurrentSweep, CollectionLeavesSmallRegionsForTheNextCollectionToComplete)
+{
+	extensions->concurrentSweepSegregatedThreads = 0;
+
+	ASSERT_EQ((uintptr_t)OBJECT_COUNT, allocateGarbage());
+	ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_NOT_AGGRESSIVE));
+
+	/* the small regions are still queued, so the garbage in them is still in use */
+	ASSERT_TRUE(sweepScheme->isConcurrentSweepInProgress());
+	uintptr_t queuedRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+	ASSERT_LT((uintptr_t)1, queuedRegions);
+	uintptr_t bytesInUseBeforeSweep = memoryPool->getBytesInUse();
+
+	/* a mutator sweeps some of them on demand */
+	env->acquireVMAccess();
+	EXPECT_EQ((uintptr_t)1, sweepScheme->sweepQueuedSmallRegions(env, 1));
+	env->releaseVMAccess();
+	EXPECT_EQ(queuedRegions - 1, regionPool->getCurrentTotalCountOfSweepRegions());
+
+	/* the sweep is not finished while regions are queued, and the next collection sweeps the rest first */
+	env->acquireExclusiveVMAccess();
+	EXPECT_FALSE(sweepScheme->finishDrainedConcurrentSweep(env));
+	EXPECT_TRUE(sweepScheme->completeConcurrentSweep(env));
+	env->releaseExclusiveVMAccess();
+
+	EXPECT_FALSE(sweepScheme->isConcurrentSweepInProgress());
+	EXPECT_EQ((uintptr_t)0, regionPool->getCurrentTotalCountOfSweepRegions());
+	EXPECT_GT(bytesInUseBeforeSweep, memoryPool->getBytesInUse());
+	/* the regions emptied by the sweep were coalesced once it finished */
+	EXPECT_EQ((uintptr_t)0, countSingleFreeRegions());
+}
+
+TEST_F(TestSegregatedConcurrentSweep, HelpersSweepAndFinishTheSweep)
+{
+	extensions->concurrentSweepSegregatedThreads = 2;
+
+	for (uintptr_t collection = 0; collection < 2; collection++) {
+		ASSERT_EQ((uintptr_t)OBJECT_COUNT, allocateGarbage()) << "collection " << collection;
+		uintptr_t bytesInUseBeforeCollection = memoryPool->getBytesInUse();
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_NOT_AGGRESSIVE));
+
+		/* the background sweep threads sweep every region the collection left, then finish the sweep */
+		collector->waitForSweepHelpers(env);
+		EXPECT_FALSE(sweepScheme->isConcurrentSweepInProgress()) << "collection " << collection;
+		EXPECT_EQ((uintptr_t)0, regionPool->getCurrentTotalCountOfSweepRegions()) << "collection " << collection;
+		EXPECT_GT(bytesInUseBeforeCollection, memoryPool->getBytesInUse()) << "collection " << collection;
+		/* the sweep was post processed after the regions the helpers emptied were returned */
+		EXPECT_EQ((uintptr_t)0, countSingleFreeRegions()) << "collection " << collection;
+	}
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MarkMap.hpp"
+#include "Object.hpp"
+#include "ObjectAllocationModel.hpp"
+#include "omrExampleVM.hpp"
+#include "omrgc.h"
+#include "SegregatedGC.hpp"
+#include "SlotObject.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define OBJECT_SIZE 64
+
+/*
+ * The barrier and the young mark of the segregated collector only depend on its mark map and on the remembered
+ * set, so they are run by a segregated collector set up over the heap of the flat configuration, where objects
+ * can be made old or young at will. segregated_GC_young_config.xml runs young collections end to end.
+ */
+class TestSegregatedYoungCollection : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_GCExtensionsBase *extensions;
+	MM_SegregatedGC *collector;
+	MM_MarkMap *markMap;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		env = NULL;
+		extensions = NULL;
+		collector = NULL;
+		markMap = NULL;
+
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/global_GC_config.xml");
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+		extensions = env->getExtensions();
+
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+		ASSERT_TRUE((NULL != exampleVM->rootTable) && (NULL != exampleVM->objectTable));
+
+		collector = MM_SegregatedGC::newInstance(env);
+		ASSERT_TRUE(NULL != collector);
+		MM_Heap *heap = extensions->heap;
+		uintptr_t heapSize = (uintptr_t)heap->getHeapTop() - (uintptr_t)heap->getHeapBase();
+		ASSERT_TRUE(collector->heapAddRange(env, NULL, heapSize, heap->getHeapBase(), heap->getHeapTop()));
+		markMap = collector->getMarkingScheme()->getMarkMap();
+	}
+
+	virtual void TearDown()
+	{
+		if (NULL != collector) {
+			MM_Heap *heap = extensions->heap;
+			uintptr_t heapSize = (uintptr_t)heap->getHeapTop() - (uintptr_t)heap->getHeapBase();
+			collector->heapRemoveRange(env, NULL, heapSize, heap->getHeapBase(), heap->getHeapTop(), NULL, NULL);
+			collector->kill(env);
+			collector = NULL;
+		}
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		if (NULL != exampleVM->objectTable) {
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		if (NULL != exampleVM->_omrVMThread) {
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+			ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+			exampleVM->_omrVMThread = NULL;
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+
+	/* Allocate an object with all its slots NULL, old (marked by the previous collection) or young */
+	omrobjectptr_t allocateObject(bool old)
+	{
+		uint8_t allocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+		MM_ObjectAllocationModel *allocationModel = new(allocationModelSpace)
+				MM_ObjectAllocationModel(env, OBJECT_SIZE, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+		omrobjectptr_t object = OMR_GC_AllocateObject(exampleVM->_omrVMThread, allocationModel);
+		if (NULL != object) {
+			for (uintptr_t i = 0; i < object->slotCount(); i++) {
+				GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)(object->slots() + i));
+				slotObject.writeReferenceToSlot(NULL);
+			}
+			if (old) {
+				markMap->setBit(object);
+			}
+		}
+		return object;
+	}
+
+	/* Store child into a slot of parent and run the barrier of young collections */
+	void store(omrobjectptr_t parent, uintptr_t slot, omrobjectptr_t child)
+	{
+		GC_SlotObject slotObject(exampleVM->_omrVM, (fomrobject_t *)(parent->slots() + slot));
+		slotObject.writeReferenceToSlot(child);
+		collector->generationalWriteBarrier(env, parent, child);
+	}
+};
+
+TEST_F(TestSegregatedYoungCollection, BarrierRemembersOldObjectsReferringToYoungOnes)
+{
+	omrobjectptr_t old = allocateObject(true);
+	omrobjectptr_t otherOld = allocateObject(true);
+	omrobjectptr_t young = allocateObject(false);
+	omrobjectptr_t otherYoung = allocateObject(false);
+	ASSERT_TRUE((NULL != old) && (NULL != otherOld) && (NULL != young) && (NULL != otherYoung));
+
+	/* references into young objects, to old objects and NULL are not remembered */
+	store(young, 0, otherYoung);
+	store(young, 1, old);
+	store(otherOld, 0, old);
+	store(old, 0, NULL);
+	EXPECT_FALSE(extensions->objectModel.isRemembered(young));
+	EXPECT_FALSE(extensions->objectModel.isRemembered(otherOld));
+	EXPECT_FALSE(extensions->objectModel.isRemembered(old));
+	EXPECT_EQ((uintptr_t)0, env->_segregatedRememberedSet.count);
+
+	/* an old object is remembered once, however many young objects are stored into it */
+	store(old, 0, young);
+	store(old, 1, otherYoung);
+	EXPECT_TRUE(extensions->objectModel.isRemembered(old));
+	EXPECT_EQ((uintptr_t)1, env->_segregatedRememberedSet.count);
+
+	collector->flushRememberedSetFragments(env);
+	EXPECT_EQ((uintptr_t)1, extensions->rememberedSet.countElements());
+}
+
+TEST_F(TestSegregatedYoungCollection, YoungMarkTracesFromRootsAndRememberedSet)
+{
+	omrobjectptr_t old = allocateObject(true);
+	omrobjectptr_t oldGarbage = allocateObject(true);
+	omrobjectptr_t remembered = allocateObject(false);
+	omrobjectptr_t rememberedChild = allocateObject(false);
+	omrobjectptr_t root = allocateObject(false);
+	omrobjectptr_t rootChild = allocateObject(false);
+	omrobjectptr_t garbage = allocateObject(false);
+	ASSERT_TRUE((NULL != old) && (NULL != oldGarbage) && (NULL != remembered) && (NULL != rememberedChild)
+			&& (NULL != root) && (NULL != rootChild) && (NULL != garbage));
+
+	/* young objects are only reachable through an old object, through a root, or not at all */
+	store(old, 0, remembered);
+	store(remembered, 0, rememberedChild);
+	store(root, 0, rootChild);
+	store(garbage, 0, rootChild);
+	RootEntry rootEntry;
+	rootEntry.name = "root";
+	rootEntry.rootPtr = root;
+	ASSERT_TRUE(NULL != hashTableAdd(exampleVM->rootTable, &rootEntry));
+
+	collector->flushRememberedSetFragments(env);
+	ASSERT_EQ((uintptr_t)1, extensions->rememberedSet.countElements());
+
+	MM_CycleState cycleState;
+	env->_cycleState = &cycleState;
+	collector->markYoungObjects(env);
+	env->_cycleState = NULL;
+
+	/* the young objects reachable are marked, old objects keep their marks, the others are left to the sweep */
+	EXPECT_TRUE(markMap->isBitSet(remembered));
+	EXPECT_TRUE(markMap->isBitSet(rememberedChild));
+	EXPECT_TRUE(markMap->isBitSet(root));
+	EXPECT_TRUE(markMap->isBitSet(rootChild));
+	EXPECT_FALSE(markMap->isBitSet(garbage));
+	EXPECT_TRUE(markMap->isBitSet(old));
+	EXPECT_TRUE(markMap->isBitSet(oldGarbage));
+
+	/* everything the remembered objects refer to is old now, so they are forgotten */
+	EXPECT_FALSE(extensions->objectModel.isRemembered(old));
+	EXPECT_EQ((uintptr_t)0, extensions->rememberedSet.countElements());
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,288 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "MemoryPoolSplitAddressOrderedListBase.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+/* Each entry slot is followed by a slot for the remainder of an allocation from it, at a higher address */
+#define ENTRY_SLOTS 512
+#define MINIMUM_ENTRY_SIZE 16
+#define OPERATIONS 50000
+/* A fragmented list has a large entry after each run of this many small ones */
+#define SMALL_ENTRY_RUN 31
+#define LARGE_ENTRY_SIZE (64 * 1024)
+
+/*
+ * Drives the search cursors of a free list the way MM_MemoryPoolSplitAddressOrderedList does, and checks
+ * every search against a plain first fit walk of the whole list. The entry sizes are logical, the entries
+ * only need to be address ordered.
+ */
+class TestSplitFreeListSearchCursors : public ::testing::Test
+{
+protected:
+	J9ModronFreeList freeList;
+	MM_HeapLinkedFreeHeader slots[ENTRY_SLOTS * 2];
+	bool used[ENTRY_SLOTS * 2];
+	uint32_t seed;
+	uintptr_t firstFitSteps; /**< Entries walked past by first fit searches */
+	uintptr_t cursorSteps; /**< Entries walked past by cursor searches */
+
+	virtual void SetUp()
+	{
+		memset(used, 0, sizeof(used));
+		freeList._freeList = NULL;
+		freeList.clearSearchCursors();
+		seed = 0x2545F491;
+		firstFitSteps = 0;
+		cursorSteps = 0;
+	}
+
+	uintptr_t nextRandom(uintptr_t bound)
+	{
+		seed = (seed * 1103515245) + 12345;
+		return (seed >> 8) % bound;
+	}
+
+	uintptr_t randomSize()
+	{
+		/* mostly small entries, some large ones */
+		return MINIMUM_ENTRY_SIZE + nextRandom((uintptr_t)1 << (4 + nextRandom(12)));
+	}
+
+	/* Rebuild the links from the used slots, in address order */
+	void relink()
+	{
+		MM_HeapLinkedFreeHeader *previous = NULL;
+		freeList._freeList = NULL;
+		for (uintptr_t i = 0; i < (ENTRY_SLOTS * 2); i++) {
+			if (used[i]) {
+				slots[i].setNext(NULL, false);
+				if (NULL == previous) {
+					freeList._freeList = &slots[i];
+				} else {
+					previous->setNext(&slots[i], false);
+				}
+				previous = &slots[i];
+			}
+		}
+	}
+
+	void addEntry(uintptr_t slot, uintptr_t size)
+	{
+		slots[slot].setSize(size);
+		used[slot] = true;
+		relink();
+	}
+
+	MM_HeapLinkedFreeHeader *firstFit(uintptr_t size, MM_HeapLinkedFreeHeader **previous)
+	{
+		*previous = NULL;
+		MM_HeapLinkedFreeHeader *current = freeList._freeList;
+		while ((NULL != current) && (current->getSize() < size)) {
+			firstFitSteps += 1;
+			*previous = current;
+			current = current->getNext(false);
+		}
+		return current;
+	}
+
+	/* The search of MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromSearchCursors */
+	MM_HeapLinkedFreeHeader *cursorSearch(uintptr_t size, MM_HeapLinkedFreeHeader **previous)
+	{
+		uintptr_t lookupClass = J9ModronFreeList::sizeClassIndex(size);
+		uintptr_t largestWalkedSize = 0;
+		uintptr_t startClass = 0;
+
+		*previous = NULL;
+		if (freeList.isSizeClassEmpty(lookupClass)) {
+			return NULL;
+		}
+
+		MM_HeapLinkedFreeHeader *current = freeList._freeList;
+		MM_HeapLinkedFreeHeader *start = freeList.findSearchCursor(lookupClass, &startClass);
+		if (NULL != start) {
+			*previous = start;
+			current = start->getNext(false);
+		}
+		while ((NULL != current) && (current->getSize() < size)) {
+			cursorSteps += 1;
+			if (largestWalkedSize < current->getSize()) {
+				largestWalkedSize = current->getSize();
+			}
+			*previous = current;
+			current = current->getNext(false);
+		}
+		freeList.recordSearch(startClass, largestWalkedSize, *previous, NULL != current);
+		return current;
+	}
+
+	/* Take size bytes from the low end of entry, as an allocation does */
+	void allocateFrom(MM_HeapLinkedFreeHeader *entry, uintptr_t size)
+	{
+		uintptr_t slot = entry - slots;
+		uintptr_t remainder = entry->getSize() - size;
+		used[slot] = false;
+		if ((0 == (slot & 1)) && (remainder >= MINIMUM_ENTRY_SIZE)) {
+			slots[slot + 1].setSize(remainder);
+			used[slot + 1] = true;
+			relink();
+			freeList.updateSearchCursors(entry, &slots[slot + 1]);
+		} else {
+			relink();
+			freeList.removeFromSearchCursors(entry);
+		}
+	}
+};
+
+TEST_F(TestSplitFreeListSearchCursors, EmptyList)
+{
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	ASSERT_TRUE(NULL == cursorSearch(MINIMUM_ENTRY_SIZE, &previous));
+	ASSERT_TRUE(freeList.isSizeClassEmpty(J9ModronFreeList::sizeClassIndex(MINIMUM_ENTRY_SIZE)));
+
+	/* Adding an entry makes the cursors forget the list was empty */
+	addEntry(0, 64);
+	freeList.clearSearchCursors();
+	ASSERT_EQ(&slots[0], cursorSearch(64, &previous));
+	ASSERT_TRUE(NULL == previous);
+}
+
+TEST_F(TestSplitFreeListSearchCursors, CursorSkipsSmallEntries)
+{
+	for (uintptr_t i = 0; i < 8; i++) {
+		addEntry(i * 2, 32);
+	}
+	addEntry(16, 4096);
+
+	MM_HeapLinkedFreeHeader *previous = NULL;
+	ASSERT_EQ(&slots[16], cursorSearch(1024, &previous));
+	ASSERT_EQ(&slots[14], previous);
+
+	/* The next search of the same size class starts right before the entry found */
+	uintptr_t startClass = 0;
+	ASSERT_EQ(&slots[14], freeList.findSearchCursor(J9ModronFreeList::sizeClassIndex(1024), &startClass));
+
+	/* A larger request finds nothing and marks its size class empty, smaller classes are unaffected */
+	ASSERT_TRUE(NULL == cursorSearch(8192, &previous));
+	ASSERT_TRUE(freeList.isSizeClassEmpty(J9ModronFreeList::sizeClassIndex(8192)));
+	ASSERT_FALSE(freeList.isSizeClassEmpty(J9ModronFreeList::sizeClassIndex(1024)));
+}
+
+TEST_F(TestSplitFreeListSearchCursors, MatchesFirstFit)
+{
+	for (uintptr_t i = 0; i < ENTRY_SLOTS; i += 2) {
+		addEntry(i * 2, randomSize());
+	}
+
+	uintptr_t cursorStarts = 0;
+	for (uintptr_t operation = 0; operation < OPERATIONS; operation++) {
+		uintptr_t action = nextRandom(16);
+		if (0 == action) {
+			/* an entry is freed into an unused slot pair */
+			uintptr_t slot = nextRandom(ENTRY_SLOTS) * 2;
+			if (!used[slot] && !used[slot + 1]) {
+				addEntry(slot, randomSize());
+				freeList.clearSearchCursors();
+			}
+		} else if (1 == action) {
+			/* an entry grows, as when it is merged with its neighbour */
+			if (NULL != freeList._freeList) {
+				freeList._freeList->setSize(freeList._freeList->getSize() + randomSize());
+				freeList.clearSearchCursors();
+			}
+		} else {
+			uintptr_t size = randomSize();
+			uintptr_t startClass = 0;
+			if (NULL != freeList.findSearchCursor(J9ModronFreeList::sizeClassIndex(size), &startClass)) {
+				cursorStarts += 1;
+			}
+
+			MM_HeapLinkedFreeHeader *expectedPrevious = NULL;
+			MM_HeapLinkedFreeHeader *expected = firstFit(size, &expectedPrevious);
+			MM_HeapLinkedFreeHeader *previous = NULL;
+			MM_HeapLinkedFreeHeader *found = cursorSearch(size, &previous);
+			ASSERT_EQ(expected, found) << "operation " << operation << " size " << size;
+			if (NULL != found) {
+				ASSERT_EQ(expectedPrevious, previous) << "operation " << operation << " size " << size;
+				allocateFrom(found, size);
+			}
+		}
+	}
+
+	/* The cursors must actually have been used for the comparison to mean anything */
+	ASSERT_LT((uintptr_t)0, cursorStarts);
+	gcTestEnv->log("%zu of %u searches started from a cursor\n", cursorStarts, OPERATIONS);
+}
+
+TEST_F(TestSplitFreeListSearchCursors, SearchCostOfFragmentedList)
+{
+	uintptr_t entries = 0;
+	uintptr_t largeEntries = 0;
+	for (uintptr_t i = 0; i < ENTRY_SLOTS; i++) {
+		if (SMALL_ENTRY_RUN == (i % (SMALL_ENTRY_RUN + 1))) {
+			addEntry(i * 2, LARGE_ENTRY_SIZE);
+			largeEntries += 1;
+		} else {
+			addEntry(i * 2, MINIMUM_ENTRY_SIZE + nextRandom(48));
+		}
+		entries += 1;
+	}
+
+	/* Large requests, each large entry serving two, between small ones taken from the head of the list */
+	uintptr_t largeSearches = 0;
+	uintptr_t largeFirstFitSteps = 0;
+	uintptr_t largeCursorSteps = 0;
+	for (uintptr_t search = 0; search < (largeEntries * 2); search++) {
+		for (uintptr_t small = 0; small < 4; small++) {
+			MM_HeapLinkedFreeHeader *previous = NULL;
+			MM_HeapLinkedFreeHeader *found = cursorSearch(MINIMUM_ENTRY_SIZE, &previous);
+			ASSERT_TRUE(NULL != found);
+			allocateFrom(found, MINIMUM_ENTRY_SIZE);
+		}
+
+		uintptr_t size = 1024 + nextRandom(1024);
+		uintptr_t firstFitStepsBefore = firstFitSteps;
+		uintptr_t cursorStepsBefore = cursorSteps;
+		MM_HeapLinkedFreeHeader *expectedPrevious = NULL;
+		MM_HeapLinkedFreeHeader *expected = firstFit(size, &expectedPrevious);
+		MM_HeapLinkedFreeHeader *previous = NULL;
+		MM_HeapLinkedFreeHeader *found = cursorSearch(size, &previous);
+		ASSERT_EQ(expected, found) << "search " << search;
+		ASSERT_TRUE(NULL != found) << "search " << search;
+		largeFirstFitSteps += firstFitSteps - firstFitStepsBefore;
+		largeCursorSteps += cursorSteps - cursorStepsBefore;
+		largeSearches += 1;
+		allocateFrom(found, size);
+	}
+
+	/*
+	 * Between two clears the cursor of a size class only moves forward, so its searches walk past each entry
+	 * at most once: a large search costs a run of small entries, not the list in front of it. Size bins would
+	 * find the entry without a walk, first fit walks everything before it again each time.
+	 */
+	gcTestEnv->log("%zu large searches of %zu entries walked past %zu entries with cursors, %zu with first fit\n",
+			largeSearches, entries, largeCursorSteps, largeFirstFitSteps);
+	ASSERT_LE(largeCursorSteps, entries);
+	ASSERT_LE(largeCursorSteps * 8, largeFirstFitSteps);
+}
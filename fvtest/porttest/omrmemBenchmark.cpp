@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup PortTest
+ * @brief Measure the throughput of port library memory allocation.
+ *
+ * Compares sharded and exact memory category counters (see omrmemcategories.c) with 1 to
+ * BENCHMARK_MAX_THREADS threads allocating and freeing small blocks.
+ */
+#include <string.h>
+
+#include "testHelpers.hpp"
+#include "omrport.h"
+#include "omrthread.h"
+
+extern PortTestEnvironment *portTestEnv;
+
+#define BENCHMARK_MAX_THREADS 64
+#define BENCHMARK_MILLIS 100
+#define BENCHMARK_BLOCKS 16 /* blocks held by each thread at once */
+
+/* state shared by the allocating threads of a benchmark run */
+typedef struct AllocationBenchmarkInfo {
+	struct OMRPortLibrary *portLibrary;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+	volatile BOOLEAN go;
+	volatile BOOLEAN stop;
+	uintptr_t allocations[BENCHMARK_MAX_THREADS];
+} AllocationBenchmarkInfo;
+
+typedef struct AllocationThreadArg {
+	AllocationBenchmarkInfo *info;
+	uintptr_t index;
+} AllocationThreadArg;
+
+/**
+ * Allocate and free blocks of varying small sizes until told to stop, counting the allocations
+ * @param arg the AllocationThreadArg of the thread
+ */
+static int J9THREAD_PROC
+allocationThread(void *arg)
+{
+	AllocationBenchmarkInfo *info = ((AllocationThreadArg *)arg)->info;
+	uintptr_t index = ((AllocationThreadArg *)arg)->index;
+	OMRPORT_ACCESS_FROM_OMRPORT(info->portLibrary);
+	void *blocks[BENCHMARK_BLOCKS];
+	uintptr_t allocations = 0;
+	uintptr_t i = 0;
+
+	memset(blocks, 0, sizeof(blocks));
+
+	omrthread_monitor_enter(info->synchronization);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	while (!info->go) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	while (!info->stop) {
+		uintptr_t slot = allocations % BENCHMARK_BLOCKS;
+		omrmem_free_memory(blocks[slot]);
+		blocks[slot] = omrmem_allocate_memory(16 + (allocations % 8) * 16, OMRMEM_CATEGORY_PORT_LIBRARY);
+		allocations += 1;
+	}
+	for (i = 0; i < BENCHMARK_BLOCKS; i++) {
+		omrmem_free_memory(blocks[i]);
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->allocations[index] = allocations;
+	info->finished += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+	return 0;
+}
+
+/**
+ * Run threadCount allocating threads for BENCHMARK_MILLIS
+ * @return the number of allocations per millisecond
+ */
+static uintptr_t
+measureAllocationThroughput(struct OMRPortLibrary *portLibrary, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	AllocationBenchmarkInfo *info = (AllocationBenchmarkInfo *)omrmem_allocate_memory(sizeof(AllocationBenchmarkInfo), OMRMEM_CATEGORY_PORT_LIBRARY);
+	AllocationThreadArg args[BENCHMARK_MAX_THREADS];
+	uintptr_t total = 0;
+	uintptr_t i = 0;
+	uint64_t startNanos = 0;
+	uint64_t elapsedNanos = 0;
+
+	memset(info, 0, sizeof(AllocationBenchmarkInfo));
+	info->portLibrary = portLibrary;
+	omrthread_monitor_init_with_name(&info->synchronization, 0, "allocation benchmark monitor");
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		args[i].info = info;
+		args[i].index = i;
+		omrthread_create(&thread, 128 * 1024, J9THREAD_PRIORITY_NORMAL, 0, allocationThread, &args[i]);
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->started < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	info->go = TRUE;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+
+	startNanos = omrtime_nano_time();
+	omrthread_sleep(BENCHMARK_MILLIS);
+	info->stop = TRUE;
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->finished < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+	elapsedNanos = omrtime_nano_time() - startNanos;
+
+	for (i = 0; i < threadCount; i++) {
+		total += info->allocations[i];
+	}
+
+	omrthread_monitor_destroy(info->synchronization);
+	omrmem_free_memory(info);
+
+	return (uintptr_t)(((uint64_t)total * 1000000) / OMR_MAX(elapsedNanos, 1));
+}
+
+/**
+ * Compare the allocation throughput with sharded and exact memory category counters, and check
+ * that the live counts of the category the threads allocated from are back where they started.
+ */
+TEST(PortMemBenchmark, AllocationThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t finalBlocks = 0;
+	uintptr_t finalBytes = 0;
+	uintptr_t threadCount = 0;
+
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &initialBlocks, &initialBytes);
+
+	omrtty_printf("%8s %22s %22s\n", "threads", "sharded (allocs/ms)", "exact (allocs/ms)");
+	for (threadCount = 1; threadCount <= BENCHMARK_MAX_THREADS; threadCount *= 2) {
+		uintptr_t shardedThroughput = 0;
+		uintptr_t exactThroughput = 0;
+
+		ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS, 0));
+		shardedThroughput = measureAllocationThroughput(OMRPORTLIB, threadCount);
+		ASSERT_EQ(0, omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS, 1));
+		exactThroughput = measureAllocationThroughput(OMRPORTLIB, threadCount);
+		omrport_control(OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS, 0);
+
+		omrtty_printf("%8zu %22zu %22zu\n", threadCount, shardedThroughput, exactThroughput);
+		ASSERT_NE((uintptr_t)0, shardedThroughput);
+		ASSERT_NE((uintptr_t)0, exactThroughput);
+	}
+
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &finalBlocks, &finalBytes);
+	ASSERT_EQ(initialBlocks, finalBlocks);
+	ASSERT_EQ(initialBytes, finalBytes);
+}
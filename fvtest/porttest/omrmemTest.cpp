@@ -1464,6 +1464,301 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+#define SMALL_BLOCK_TEST_COUNT 160
+/* blocks of up to this size always fit a size class, whatever the size of the tags */
+#define SMALL_BLOCK_SERVED_SIZE 512
+/* blocks of more than this size never do */
+#define SMALL_BLOCK_UNSERVED_SIZE 1024
+
+/*
+ * Check that the small block allocator served a block if it is small enough, and did not if it is too large.
+ * Returns FALSE if it did not.
+ */
+static BOOLEAN
+checkSmallBlock(struct OMRPortLibrary *portLibrary, const char *testName, uint8_t *block, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	int32_t served = omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATED, (uintptr_t)block);
+
+	if ((size <= SMALL_BLOCK_SERVED_SIZE) && (1 != served)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "block of %zu bytes was not served by the small block allocator\n", size);
+		return FALSE;
+	}
+	if ((size > SMALL_BLOCK_UNSERVED_SIZE) && (0 != served)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "block of %zu bytes was served by the small block allocator\n", size);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ * Tests the small block allocator enabled with OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR: blocks of every
+ * small size and some larger ones can be written, reallocated and freed, including blocks allocated before
+ * the allocator was enabled and freed after it was disabled, and the memory categories balance.
+ */
+TEST(PortMemTest, mem_test10_small_blocks)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_small_blocks";
+	uint8_t *blocks[SMALL_BLOCK_TEST_COUNT];
+	uintptr_t sizes[SMALL_BLOCK_TEST_COUNT];
+	uint8_t *allocatedBeforeEnable = NULL;
+	uint8_t *freedAfterDisable = NULL;
+	BOOLEAN enabled = FALSE;
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t finalBlocks = 0;
+	uintptr_t finalBytes = 0;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(blocks, 0, sizeof(blocks));
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &initialBlocks, &initialBytes);
+
+	allocatedBeforeEnable = (uint8_t *)omrmem_allocate_memory(64, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == allocatedBeforeEnable) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory(64) returned NULL\n");
+		goto exit;
+	}
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not enable the small block allocator\n");
+		goto exit;
+	}
+	enabled = TRUE;
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATED, (uintptr_t)allocatedBeforeEnable)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "block allocated before the allocator was enabled is a small block\n");
+	}
+
+	for (i = 0; i < SMALL_BLOCK_TEST_COUNT; i++) {
+		sizes[i] = i * 7;
+		blocks[i] = (uint8_t *)omrmem_allocate_memory(sizes[i], OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == blocks[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory(%zu) returned NULL\n", sizes[i]);
+			goto exit;
+		}
+		checkSmallBlock(OMRPORTLIB, testName, blocks[i], sizes[i]);
+		memset(blocks[i], (int)i, sizes[i]);
+	}
+
+	/* grow every other block, some of them past the largest small block */
+	for (i = 0; i < SMALL_BLOCK_TEST_COUNT; i += 2) {
+		uintptr_t newSize = sizes[i] * 2 + 16;
+		uint8_t *newBlock = (uint8_t *)omrmem_reallocate_memory(blocks[i], newSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == newBlock) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_reallocate_memory(%zu) returned NULL\n", newSize);
+			goto exit;
+		}
+		for (j = 0; j < sizes[i]; j++) {
+			if ((uint8_t)i != newBlock[j]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "reallocated block %zu lost its contents at %zu\n", i, j);
+				break;
+			}
+		}
+		blocks[i] = newBlock;
+		sizes[i] = newSize;
+		checkSmallBlock(OMRPORTLIB, testName, blocks[i], sizes[i]);
+		memset(blocks[i], (int)i, sizes[i]);
+	}
+
+	for (i = 0; i < SMALL_BLOCK_TEST_COUNT; i++) {
+		for (j = 0; j < sizes[i]; j++) {
+			if ((uint8_t)i != blocks[i][j]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "block %zu was overwritten at %zu\n", i, j);
+				break;
+			}
+		}
+		omrmem_free_memory(blocks[i]);
+		blocks[i] = NULL;
+	}
+
+	omrmem_free_memory(allocatedBeforeEnable);
+	allocatedBeforeEnable = NULL;
+	freedAfterDisable = (uint8_t *)omrmem_allocate_memory(64, OMRMEM_CATEGORY_PORT_LIBRARY);
+	checkSmallBlock(OMRPORTLIB, testName, freedAfterDisable, 64);
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, 0)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not disable the small block allocator\n");
+	}
+	enabled = FALSE;
+	omrmem_free_memory(freedAfterDisable);
+
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &finalBlocks, &finalBytes);
+	if ((initialBlocks != finalBlocks) || (initialBytes != finalBytes)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "port library category went from %zu blocks, %zu bytes to %zu blocks, %zu bytes\n",
+			initialBlocks, initialBytes, finalBlocks, finalBytes);
+	}
+
+exit:
+	/* after a failure, free what is left and leave the allocator disabled for the other tests */
+	for (i = 0; i < SMALL_BLOCK_TEST_COUNT; i++) {
+		omrmem_free_memory(blocks[i]);
+	}
+	omrmem_free_memory(allocatedBeforeEnable);
+	if (enabled) {
+		omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, 0);
+	}
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#define SMALL_BLOCK_THREAD_COUNT 32
+#define SMALL_BLOCK_THREAD_SIZE 200
+
+typedef struct SmallBlockThreadData {
+	struct OMRPortLibrary *portLibrary;
+	const char *testName;
+	uint8_t *blocks[SMALL_BLOCK_THREAD_COUNT];
+	uint8_t *freedBlocks[SMALL_BLOCK_THREAD_COUNT];
+} SmallBlockThreadData;
+
+/* Allocate the blocks and fill them */
+static int J9THREAD_PROC
+allocateSmallBlocks(void *arg)
+{
+	SmallBlockThreadData *data = (SmallBlockThreadData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t i = 0;
+
+	for (i = 0; i < SMALL_BLOCK_THREAD_COUNT; i++) {
+		data->blocks[i] = (uint8_t *)omrmem_allocate_memory(SMALL_BLOCK_THREAD_SIZE, OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL != data->blocks[i]) {
+			memset(data->blocks[i], (int)i, SMALL_BLOCK_THREAD_SIZE);
+		}
+	}
+	return 0;
+}
+
+/* Check and free the blocks another thread allocated, keeping them in this thread's cache until it exits */
+static int J9THREAD_PROC
+freeSmallBlocks(void *arg)
+{
+	SmallBlockThreadData *data = (SmallBlockThreadData *)arg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	const char *testName = data->testName;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	for (i = 0; i < SMALL_BLOCK_THREAD_COUNT; i++) {
+		for (j = 0; j < SMALL_BLOCK_THREAD_SIZE; j++) {
+			if ((uint8_t)i != data->blocks[i][j]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "block %zu was overwritten at %zu\n", i, j);
+				break;
+			}
+		}
+		omrmem_free_memory(data->blocks[i]);
+		data->freedBlocks[i] = data->blocks[i];
+		data->blocks[i] = NULL;
+	}
+	return 0;
+}
+
+/* Run the function on a new thread, and wait for the thread, and its TLS finalizers, to finish */
+static BOOLEAN
+runSmallBlockThread(SmallBlockThreadData *data, omrthread_entrypoint_t entrypoint)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	const char *testName = data->testName;
+	omrthread_attr_t attr = NULL;
+	omrthread_t thread = NULL;
+	BOOLEAN rc = FALSE;
+
+	if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrthread_attr_init failed\n");
+		return FALSE;
+	}
+	if ((J9THREAD_SUCCESS == omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+		&& (J9THREAD_SUCCESS == omrthread_create_ex(&thread, &attr, 0, entrypoint, data))
+	) {
+		rc = (J9THREAD_SUCCESS == omrthread_join(thread));
+	}
+	if (!rc) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not run a thread\n");
+	}
+	omrthread_attr_destroy(&attr);
+	return rc;
+}
+
+/*
+ * Tests the small block allocator across threads: blocks allocated by one thread are freed by another, into
+ * its cache, and the cache is flushed when that thread exits, so the next thread to allocate gets them back.
+ */
+TEST(PortMemTest, mem_test11_small_blocks_threads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test11_small_blocks_threads";
+	SmallBlockThreadData data;
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t finalBlocks = 0;
+	uintptr_t finalBytes = 0;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	memset(&data, 0, sizeof(data));
+	data.portLibrary = OMRPORTLIB;
+	data.testName = testName;
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &initialBlocks, &initialBytes);
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, 1)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not enable the small block allocator\n");
+		goto exit;
+	}
+
+	/* allocate on one thread, free on another */
+	if (!runSmallBlockThread(&data, allocateSmallBlocks)) {
+		goto exit;
+	}
+	for (i = 0; i < SMALL_BLOCK_THREAD_COUNT; i++) {
+		if (NULL == data.blocks[i]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrmem_allocate_memory(%zu) returned NULL\n", (uintptr_t)SMALL_BLOCK_THREAD_SIZE);
+			goto exit;
+		}
+		if (!checkSmallBlock(OMRPORTLIB, testName, data.blocks[i], SMALL_BLOCK_THREAD_SIZE)) {
+			goto exit;
+		}
+	}
+	if (!runSmallBlockThread(&data, freeSmallBlocks)) {
+		goto exit;
+	}
+
+	getPortLibraryMemoryCategoryData(OMRPORTLIB, &finalBlocks, &finalBytes);
+	if ((initialBlocks != finalBlocks) || (initialBytes != finalBytes)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "port library category went from %zu blocks, %zu bytes to %zu blocks, %zu bytes\n",
+			initialBlocks, initialBytes, finalBlocks, finalBytes);
+	}
+
+	/*
+	 * The freeing thread's cache kept the blocks, and its exit returned them to the central free lists, so a new
+	 * thread, whose cache is empty, refills its cache with them.
+	 */
+	if (!runSmallBlockThread(&data, allocateSmallBlocks)) {
+		goto exit;
+	}
+	for (i = 0; i < SMALL_BLOCK_THREAD_COUNT; i++) {
+		for (j = 0; j < SMALL_BLOCK_THREAD_COUNT; j++) {
+			if (data.blocks[i] == data.freedBlocks[j]) {
+				break;
+			}
+		}
+		if (SMALL_BLOCK_THREAD_COUNT == j) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "block %zu was not one of the blocks flushed when the freeing thread exited\n", i);
+			break;
+		}
+	}
+
+exit:
+	for (i = 0; i < SMALL_BLOCK_THREAD_COUNT; i++) {
+		omrmem_free_memory(data.blocks[i]);
+	}
+	omrport_control(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, 0);
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
 freeMemPointers(struct OMRPortLibrary *portLibrary, void **memPtrs, uintptr_t length)
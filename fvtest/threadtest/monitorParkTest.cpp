@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "omrTest.h"
+#include "omrthread.h"
+
+#if defined(OMR_THR_THREE_TIER_LOCKING)
+
+/*
+ * Blocking on three tier monitors, which parks on the monitor's futex with OMR_THR_FUTEX_MONITORS.
+ * The monitors' spin counts are lowered so contended enters stop spinning and block almost at once.
+ */
+
+#define CONTENDING_THREADS 4
+#define ENTERS_PER_THREAD 10000
+#define POLL_DELAY 10
+
+typedef struct park_testdata_t {
+	omrthread_monitor_t monitor;
+	omrthread_monitor_t exitSync;
+	volatile uintptr_t counter;
+	volatile uintptr_t waiting;
+	volatile uintptr_t done;
+	volatile intptr_t rc;
+	volatile uintptr_t flags;
+} park_testdata_t;
+
+static void
+initTestData(park_testdata_t *testdata)
+{
+	memset(testdata, 0, sizeof(*testdata));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&testdata->monitor, 0, "park test"));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&testdata->exitSync, 0, "park test exit"));
+
+	J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata->monitor;
+	mon->spinCount1 = 1;
+	mon->spinCount2 = 1;
+	mon->spinCount3 = 1;
+}
+
+static void
+destroyTestData(park_testdata_t *testdata)
+{
+	omrthread_monitor_destroy(testdata->exitSync);
+	omrthread_monitor_destroy(testdata->monitor);
+}
+
+static void
+createThread(omrthread_t *t, omrthread_entrypoint_t entrypoint, park_testdata_t *testdata)
+{
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(t, J9THREAD_ATTR_DEFAULT, 0, entrypoint, testdata));
+}
+
+/* Wait until the thread has blocked on the test monitor, which its owner must hold */
+static void
+waitUntilBlocked(park_testdata_t *testdata, omrthread_t t)
+{
+	J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata->monitor;
+	while ((0 == (((J9AbstractThread *)t)->flags & J9THREAD_FLAG_BLOCKED)) || (NULL == mon->blocking)) {
+		omrthread_sleep(POLL_DELAY);
+	}
+}
+
+/* Wait until the given number of threads have finished with the test monitor */
+static void
+waitUntilDone(park_testdata_t *testdata, uintptr_t count)
+{
+	omrthread_monitor_enter(testdata->exitSync);
+	while (testdata->done < count) {
+		omrthread_monitor_wait(testdata->exitSync);
+	}
+	omrthread_monitor_exit(testdata->exitSync);
+}
+
+static void
+signalDone(park_testdata_t *testdata)
+{
+	omrthread_monitor_enter(testdata->exitSync);
+	testdata->done += 1;
+	omrthread_monitor_notify_all(testdata->exitSync);
+	omrthread_monitor_exit(testdata->exitSync);
+}
+
+/* Nothing is left blocked on a monitor nobody owns */
+static void
+expectUnowned(park_testdata_t *testdata)
+{
+	J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata->monitor;
+	EXPECT_TRUE(NULL == mon->owner);
+	EXPECT_EQ(0u, mon->count);
+	EXPECT_TRUE(NULL == mon->blocking);
+	EXPECT_TRUE(NULL == mon->waiting);
+	EXPECT_EQ((uintptr_t)J9THREAD_MONITOR_SPINLOCK_UNOWNED, mon->spinlockState);
+}
+
+static int J9THREAD_PROC
+contendingMain(void *arg)
+{
+	park_testdata_t *testdata = (park_testdata_t *)arg;
+
+	for (uintptr_t i = 0; i < ENTERS_PER_THREAD; i++) {
+		omrthread_monitor_enter(testdata->monitor);
+		uintptr_t counter = testdata->counter;
+		if (0 == (i % 64)) {
+			/* hold the monitor for longer now and then so the others block */
+			omrthread_yield();
+		}
+		testdata->counter = counter + 1;
+		omrthread_monitor_exit(testdata->monitor);
+	}
+
+	signalDone(testdata);
+	return 0;
+}
+
+TEST(MonitorParkTest, ContendedEnterExit)
+{
+	park_testdata_t testdata;
+	omrthread_t threads[CONTENDING_THREADS];
+
+	initTestData(&testdata);
+
+	/* start with every thread blocked, so the first exit has to wake one */
+	omrthread_monitor_enter(testdata.monitor);
+	for (uintptr_t i = 0; i < CONTENDING_THREADS; i++) {
+		createThread(&threads[i], contendingMain, &testdata);
+	}
+	for (uintptr_t i = 0; i < CONTENDING_THREADS; i++) {
+		waitUntilBlocked(&testdata, threads[i]);
+	}
+	omrthread_monitor_exit(testdata.monitor);
+
+	waitUntilDone(&testdata, CONTENDING_THREADS);
+
+	EXPECT_EQ((uintptr_t)(CONTENDING_THREADS * ENTERS_PER_THREAD), testdata.counter);
+	expectUnowned(&testdata);
+#if defined(OMR_THR_FUTEX_MONITORS)
+	EXPECT_LT(0u, ((J9ThreadAbstractMonitor *)testdata.monitor)->parkSequence) << "No exit woke a parked thread";
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
+	destroyTestData(&testdata);
+}
+
+static int J9THREAD_PROC
+abortedEnterMain(void *arg)
+{
+	park_testdata_t *testdata = (park_testdata_t *)arg;
+	omrthread_t self = omrthread_self();
+
+	testdata->rc = omrthread_monitor_enter_abortable_using_threadId(testdata->monitor, self);
+	if (0 == testdata->rc) {
+		omrthread_monitor_exit(testdata->monitor);
+	}
+	testdata->flags = ((J9AbstractThread *)self)->flags;
+
+	signalDone(testdata);
+	return 0;
+}
+
+TEST(MonitorParkTest, ParkedEnterAborted)
+{
+	park_testdata_t testdata;
+	omrthread_t t;
+
+	initTestData(&testdata);
+
+	omrthread_monitor_enter(testdata.monitor);
+	createThread(&t, abortedEnterMain, &testdata);
+	waitUntilBlocked(&testdata, t);
+
+	/* the aborted thread gives up on the monitor while it is still owned */
+	omrthread_abort(t);
+	waitUntilDone(&testdata, 1);
+
+	J9ThreadAbstractMonitor *mon = (J9ThreadAbstractMonitor *)testdata.monitor;
+	EXPECT_EQ(J9THREAD_INTERRUPTED_MONITOR_ENTER, testdata.rc);
+	EXPECT_EQ(0u, testdata.flags & (J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_ABORTABLE));
+	EXPECT_TRUE(omrthread_self() == (omrthread_t)mon->owner);
+	EXPECT_TRUE(NULL == mon->blocking);
+
+	omrthread_monitor_exit(testdata.monitor);
+	expectUnowned(&testdata);
+
+	/* and the monitor can still be entered */
+	EXPECT_EQ(0, omrthread_monitor_try_enter(testdata.monitor));
+	omrthread_monitor_exit(testdata.monitor);
+
+	destroyTestData(&testdata);
+}
+
+static int J9THREAD_PROC
+waitingMain(void *arg)
+{
+	park_testdata_t *testdata = (park_testdata_t *)arg;
+
+	omrthread_monitor_enter(testdata->monitor);
+	testdata->waiting = 1;
+	testdata->rc = omrthread_monitor_wait(testdata->monitor);
+	testdata->counter += 1;
+	omrthread_monitor_exit(testdata->monitor);
+
+	signalDone(testdata);
+	return 0;
+}
+
+static int J9THREAD_PROC
+enteringMain(void *arg)
+{
+	park_testdata_t *testdata = (park_testdata_t *)arg;
+
+	omrthread_monitor_enter(testdata->monitor);
+	testdata->counter += 1;
+	omrthread_monitor_exit(testdata->monitor);
+
+	signalDone(testdata);
+	return 0;
+}
+
+/* The notified waiter has to contend with a thread blocked entering the monitor, and both get it once it is exited */
+static void
+notifyWhileParked(void)
+{
+	park_testdata_t testdata;
+	omrthread_t waiter;
+	omrthread_t enterer;
+
+	initTestData(&testdata);
+	testdata.rc = -1;
+
+	createThread(&waiter, waitingMain, &testdata);
+	omrthread_monitor_enter(testdata.monitor);
+	while (0 == testdata.waiting) {
+		omrthread_monitor_exit(testdata.monitor);
+		omrthread_sleep(POLL_DELAY);
+		omrthread_monitor_enter(testdata.monitor);
+	}
+
+	/* the waiter is waiting, as the monitor is held, and another thread blocks entering it */
+	createThread(&enterer, enteringMain, &testdata);
+	waitUntilBlocked(&testdata, enterer);
+
+	EXPECT_EQ(0, omrthread_monitor_notify(testdata.monitor));
+	omrthread_monitor_exit(testdata.monitor);
+	waitUntilDone(&testdata, 2);
+
+	EXPECT_EQ(0, testdata.rc);
+	EXPECT_EQ(2u, testdata.counter);
+	expectUnowned(&testdata);
+
+	destroyTestData(&testdata);
+}
+
+TEST(MonitorParkTest, NotifyWhileParked)
+{
+	notifyWhileParked();
+}
+
+TEST(MonitorParkTest, FastNotifyWhileParked)
+{
+	uintptr_t fastNotify = omrthread_lib_get_flags() & J9THREAD_LIB_FLAG_FAST_NOTIFY;
+
+	/* the notify moves the waiter to the blocking queue itself, and has to wake it */
+	omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	notifyWhileParked();
+	if (0 == fastNotify) {
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	}
+}
+
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+#define BENCHMARK_MAX_THREADS 64
+#define BENCHMARK_MILLIS 100
+
+/* state shared by the reader threads of a benchmark run */
+typedef struct ReaderBenchmarkInfo {
+	omrthread_rwmutex_t handle;
+	omrthread_monitor_t synchronization;
+	volatile uintptr_t started;
+	volatile uintptr_t finished;
+	volatile BOOLEAN go;
+	volatile BOOLEAN stop;
+	volatile uintptr_t protectedValue;
+	volatile uintptr_t sink; /* keeps the reads of protectedValue from being optimized away */
+	uintptr_t acquisitions[BENCHMARK_MAX_THREADS];
+} ReaderBenchmarkInfo;
+
+typedef struct ReaderThreadArg {
+	ReaderBenchmarkInfo *info;
+	uintptr_t index;
+} ReaderThreadArg;
+
+/**
+ * Enter and exit the rwmutex for read until told to stop, counting the acquisitions
+ * @param arg the ReaderThreadArg of the thread
+ */
+static intptr_t J9THREAD_PROC
+readerThread(ReaderThreadArg *arg)
+{
+	ReaderBenchmarkInfo *info = arg->info;
+	uintptr_t acquisitions = 0;
+	uintptr_t sum = 0;
+
+	omrthread_monitor_enter(info->synchronization);
+	info->started += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	while (!info->go) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+
+	while (!info->stop) {
+		omrthread_rwmutex_enter_read(info->handle);
+		sum += info->protectedValue;
+		omrthread_rwmutex_exit_read(info->handle);
+		acquisitions += 1;
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	info->acquisitions[arg->index] = acquisitions;
+	info->sink += sum;
+	info->finished += 1;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+	return 0;
+}
+
+/**
+ * Run threadCount readers on a rwmutex created with flags for BENCHMARK_MILLIS
+ * @return the number of read acquisitions per millisecond
+ */
+static uintptr_t
+measureReaderThroughput(uintptr_t flags, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	ReaderBenchmarkInfo *info = (ReaderBenchmarkInfo *)omrmem_allocate_memory(sizeof(ReaderBenchmarkInfo), OMRMEM_CATEGORY_THREADS);
+	ReaderThreadArg args[BENCHMARK_MAX_THREADS];
+	uintptr_t total = 0;
+	uintptr_t i = 0;
+	uint64_t startNanos = 0;
+	uint64_t elapsedNanos = 0;
+
+	memset(info, 0, sizeof(ReaderBenchmarkInfo));
+	omrthread_rwmutex_init(&info->handle, flags, "rwmutex benchmark");
+	omrthread_monitor_init_with_name(&info->synchronization, 0, "rwmutex benchmark monitor");
+
+	for (i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		args[i].info = info;
+		args[i].index = i;
+		omrthread_create_ex(&thread, J9THREAD_ATTR_DEFAULT, 0, (omrthread_entrypoint_t)readerThread, &args[i]);
+	}
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->started < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	info->go = TRUE;
+	omrthread_monitor_notify_all(info->synchronization);
+	omrthread_monitor_exit(info->synchronization);
+
+	startNanos = omrtime_nano_time();
+	omrthread_sleep(BENCHMARK_MILLIS);
+	info->stop = TRUE;
+
+	omrthread_monitor_enter(info->synchronization);
+	while (info->finished < threadCount) {
+		omrthread_monitor_wait(info->synchronization);
+	}
+	omrthread_monitor_exit(info->synchronization);
+	elapsedNanos = omrtime_nano_time() - startNanos;
+
+	for (i = 0; i < threadCount; i++) {
+		total += info->acquisitions[i];
+	}
+
+	omrthread_monitor_destroy(info->synchronization);
+	omrthread_rwmutex_destroy(info->handle);
+	omrmem_free_memory(info);
+
+	return (uintptr_t)(((uint64_t)total * 1000000) / OMR_MAX(elapsedNanos, 1));
+}
+
+/**
+ * Compare the read acquisition throughput of a default and a scalable rwmutex
+ * with 1 to BENCHMARK_MAX_THREADS readers.
+ */
+TEST(RWMutexBenchmark, ReaderThroughput)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	uintptr_t threadCount = 0;
+
+	omrtty_printf("%8s %20s %20s\n", "readers", "default (reads/ms)", "scalable (reads/ms)");
+	for (threadCount = 1; threadCount <= BENCHMARK_MAX_THREADS; threadCount *= 2) {
+		uintptr_t defaultThroughput = measureReaderThroughput(0, threadCount);
+		uintptr_t scalableThroughput = measureReaderThroughput(J9THREAD_RWMUTEX_SCALABLE_READERS, threadCount);
+		omrtty_printf("%8zu %20zu %20zu\n", threadCount, defaultThroughput, scalableThroughput);
+		ASSERT_TRUE(0 != defaultThroughput);
+		ASSERT_TRUE(0 != scalableThroughput);
+	}
+}
@@ -91,10 +91,11 @@ runRequest(SupportThreadInfo *info)
  * @param functionsToRun an array of functions pointers. Each function will be run one in sequence synchronized
  *        using the monitor within the SupporThreadInfo
  * @param numberFunctions the number of functions in the functionsToRun array
+ * @param flags flags for the rwmutex
  * @returns a pointer to the newly created SupporThreadInfo
  */
 SupportThreadInfo *
-createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions)
+createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t numberFunctions, uintptr_t flags = 0)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
 	SupportThreadInfo *info = (SupportThreadInfo *)omrmem_allocate_memory(sizeof(SupportThreadInfo), OMRMEM_CATEGORY_THREADS);
@@ -103,7 +104,7 @@ createSupportThreadInfo(omrthread_entrypoint_t *functionsToRun, uintptr_t number
 	info->functionsToRun = functionsToRun;
 	info->numberFunctions = numberFunctions;
 	info->done = FALSE;
-	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, 0, "supportThreadInfo rwmutex");
+	omrthread_rwmutex_init((omrthread_rwmutex_t *)&info->handle, flags, "supportThreadInfo rwmutex");
 	omrthread_monitor_init_with_name(&info->synchronization, 0, "supportThreadAInfo monitor");
 	return info;
 }
@@ -1136,3 +1137,198 @@ TEST(RWMutex, WritersExcludedByWriterNonBlockTest)
 	triggerNextStepDone(info);
 	freeSupportThreadInfo(info);
 }
+
+/**
+ * Validate that a scalable rwmutex can be entered and exited for read and write,
+ * recursively, and by a writer which then enters for read
+ */
+TEST(RWMutex, ScalableEnterExitTest)
+{
+	intptr_t result;
+	omrthread_rwmutex_t handle;
+	const char *mutexName = "test_mutex";
+
+	result = omrthread_rwmutex_init(&handle, J9THREAD_RWMUTEX_SCALABLE_READERS, mutexName);
+	ASSERT_TRUE(0 == result);
+
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+
+	result = omrthread_rwmutex_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_enter_read(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(TRUE == omrthread_rwmutex_is_writelocked(handle));
+	result = omrthread_rwmutex_exit_read(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+	ASSERT_TRUE(FALSE == omrthread_rwmutex_is_writelocked(handle));
+
+	result = omrthread_rwmutex_try_enter_write(handle);
+	ASSERT_TRUE(0 == result);
+	result = omrthread_rwmutex_exit_write(handle);
+	ASSERT_TRUE(0 == result);
+
+	/* clean up */
+	result = omrthread_rwmutex_destroy(handle);
+	ASSERT_TRUE(0 == result);
+}
+
+/**
+ * validates the following for a scalable rwmutex
+ *
+ * readers are excluded while another thread holds the rwmutex for write
+ * once writer exits, reader can enter
+ */
+TEST(RWMutex, ScalableReadersExcludedTest)
+{
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_SCALABLE_READERS);
+
+	/* first enter the mutex for write */
+	ASSERT_TRUE(0 == info->readCounter);
+	omrthread_rwmutex_enter_write(info->handle);
+
+	/* start the concurrent thread that will try to enter for read and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->readCounter);
+
+	/* now release the rwmutex and validate that the thread enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_write(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->readCounter);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a scalable rwmutex
+ *
+ * writer is excluded while another thread holds the rwmutex for read,
+ * and try_enter_write does not block
+ */
+TEST(RWMutex, ScalableWritersExcludedNonBlockTest)
+{
+	intptr_t result = 0;
+	SupportThreadInfo *info;
+	omrthread_entrypoint_t functionsToRun[2];
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_SCALABLE_READERS);
+
+	/* start the concurrent thread that will try to enter for read */
+	startConcurrentThread(info);
+	ASSERT_TRUE(1 == info->readCounter);
+
+	/* now try to enter for write making sure we don't block */
+	result = omrthread_rwmutex_try_enter_write(info->handle);
+	ASSERT_TRUE(1 == info->readCounter);
+	ASSERT_TRUE(J9THREAD_RWMUTEX_WOULDBLOCK == result);
+
+	/* the failed attempt must not leave new readers blocked */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+
+	/* done now so ask thread to release and clean up */
+	triggerNextStepDone(info);
+	freeSupportThreadInfo(info);
+}
+
+/**
+ * validates the following for a scalable rwmutex
+ *
+ * a pending writer excludes new readers
+ * a thread already holding the rwmutex for read can re-enter it while the writer is pending
+ * once the readers exit the writer enters, and once it exits the new reader enters
+ */
+TEST(RWMutex, ScalablePendingWriterExcludesReadersTest)
+{
+	omrthread_rwmutex_t saveHandle;
+	SupportThreadInfo *info;
+	SupportThreadInfo *infoReader;
+	omrthread_entrypoint_t functionsToRun[2];
+	omrthread_entrypoint_t functionsToRunReader[2];
+
+	/* set up the steps for the 2 concurrent threads */
+	functionsToRun[0] = (omrthread_entrypoint_t) &enter_rwmutex_write;
+	functionsToRun[1] = (omrthread_entrypoint_t) &exit_rwmutex_write;
+	functionsToRunReader[0] = (omrthread_entrypoint_t) &enter_rwmutex_read;
+	functionsToRunReader[1] = (omrthread_entrypoint_t) &exit_rwmutex_read;
+
+	info = createSupportThreadInfo(functionsToRun, 2, J9THREAD_RWMUTEX_SCALABLE_READERS);
+	infoReader = createSupportThreadInfo(functionsToRunReader, 2, J9THREAD_RWMUTEX_SCALABLE_READERS);
+
+	/* set the two SupporThreadInfo structures so that they use the same rwmutex */
+	saveHandle = infoReader->handle;
+	infoReader->handle = info->handle;
+
+	/* first enter the mutex for read */
+	omrthread_rwmutex_enter_read(info->handle);
+
+	/* start the concurrent thread that will try to enter for write and
+	 * check that it is blocked
+	 */
+	startConcurrentThread(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* start the concurrent thread that will try to enter for read and
+	 * check that it is blocked behind the pending writer
+	 */
+	startConcurrentThread(infoReader);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* a recursive enter must not wait for the writer */
+	omrthread_rwmutex_enter_read(info->handle);
+	omrthread_rwmutex_exit_read(info->handle);
+	ASSERT_TRUE(0 == info->writeCounter);
+
+	/* now release the rwmutex and validate that the writer enters it */
+	omrthread_monitor_enter(info->synchronization);
+	omrthread_rwmutex_exit_read(info->handle);
+	omrthread_monitor_wait_interruptable(info->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(info->synchronization);
+	ASSERT_TRUE(1 == info->writeCounter);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* now let the writer exit and validate that the reader enters */
+	omrthread_monitor_enter(infoReader->synchronization);
+	triggerNextStepDone(info);
+	ASSERT_TRUE(0 == info->writeCounter);
+	omrthread_monitor_wait_interruptable(infoReader->synchronization, MILLI_TIMEOUT, NANO_TIMEOUT);
+	omrthread_monitor_exit(infoReader->synchronization);
+	ASSERT_TRUE(1 == infoReader->readCounter);
+
+	/* ok now let the reader exit */
+	triggerNextStepDone(infoReader);
+	ASSERT_TRUE(0 == infoReader->readCounter);
+
+	/* now let the threads clean up. First fix up handle in infoReader so that we
+	 * can clean up properly
+	 */
+	infoReader->handle = saveHandle;
+	freeSupportThreadInfo(info);
+	freeSupportThreadInfo(infoReader);
+}
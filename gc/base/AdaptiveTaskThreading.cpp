@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <math.h>
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "ModronAssertions.h"
+#include "ut_j9mm.h"
+
+#include "AdaptiveTaskThreading.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Task.hpp"
+
+MM_AdaptiveTaskThreading::MM_AdaptiveTaskThreading(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_AdaptiveTaskThreading *
+MM_AdaptiveTaskThreading::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AdaptiveTaskThreading *adaptiveTaskThreading = (MM_AdaptiveTaskThreading *)env->getForge()->allocate(sizeof(MM_AdaptiveTaskThreading), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != adaptiveTaskThreading) {
+		new(adaptiveTaskThreading) MM_AdaptiveTaskThreading(env);
+		if (!adaptiveTaskThreading->initialize(env)) {
+			adaptiveTaskThreading->kill(env);
+			adaptiveTaskThreading = NULL;
+		}
+	}
+	return adaptiveTaskThreading;
+}
+
+void
+MM_AdaptiveTaskThreading::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AdaptiveTaskThreading::initialize(MM_EnvironmentBase *env)
+{
+	memset(_entries, 0, sizeof(_entries));
+	return true;
+}
+
+void
+MM_AdaptiveTaskThreading::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+MM_AdaptiveTaskThreading::Entry *
+MM_AdaptiveTaskThreading::findEntry(const char *taskName, bool create)
+{
+	/* The type id of a task is a string constant of its class, so the address identifies the task type */
+	for (uintptr_t i = 0; i < entryCount; i++) {
+		Entry *entry = &_entries[i];
+		if (taskName == entry->_taskName) {
+			return entry;
+		}
+		if (NULL == entry->_taskName) {
+			if (create) {
+				entry->_taskName = taskName;
+				return entry;
+			}
+			break;
+		}
+	}
+	return NULL;
+}
+
+uintptr_t
+MM_AdaptiveTaskThreading::getRecommendedThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maximumThreadCount)
+{
+	uintptr_t threadCount = maximumThreadCount;
+	Entry *entry = findEntry(task->getBaseVirtualTypeId(), false);
+
+	if ((NULL != entry) && (0.0f < entry->_averageThroughput)) {
+		float threadTime = entry->_averageWork / entry->_averageThroughput;
+		float idealThreads = threadTime / (float)OMR_MAX(_extensions->adaptiveTaskThreadingTargetThreadTime, 1);
+		if (idealThreads < (float)maximumThreadCount) {
+			/* round up - a partial thread worth of work still needs a thread */
+			threadCount = OMR_MAX((uintptr_t)ceilf(idealThreads), 1);
+		}
+		entry->_previousRecommendedThreadCount = entry->_recommendedThreadCount;
+		entry->_previousPredictedThreadTime = entry->_predictedThreadTime;
+		entry->_recommendedThreadCount = threadCount;
+		entry->_predictedThreadTime = (uint64_t)threadTime;
+		Trc_MM_AdaptiveTaskThreading_getRecommendedThreadCount(env->getLanguageVMThread(), task->getBaseVirtualTypeId(), (uintptr_t)entry->_averageWork, (double)entry->_averageThroughput, (double)threadTime, maximumThreadCount, threadCount);
+	}
+
+	return threadCount;
+}
+
+void
+MM_AdaptiveTaskThreading::taskCompleted(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t timeInMicroSeconds)
+{
+	uintptr_t work = task->getCompletedWork();
+	if (0 == work) {
+		return;
+	}
+
+	Entry *entry = findEntry(task->getBaseVirtualTypeId(), true);
+	if (NULL == entry) {
+		/* more task types than entries - the remaining ones keep the default thread count */
+		return;
+	}
+
+	float throughput = (float)work / (float)(OMR_MAX(timeInMicroSeconds, 1) * threadCount);
+	if (0.0f == entry->_averageThroughput) {
+		entry->_averageWork = (float)work;
+		entry->_averageThroughput = throughput;
+	} else {
+		float weight = _extensions->adaptiveTaskThreadingWeight;
+		entry->_averageWork = (weight * (float)work) + ((1.0f - weight) * entry->_averageWork);
+		entry->_averageThroughput = (weight * throughput) + ((1.0f - weight) * entry->_averageThroughput);
+	}
+	entry->_lastThreadCount = threadCount;
+	entry->_lastWork = work;
+	entry->_lastTime = timeInMicroSeconds;
+	entry->_reportedRuns += 1;
+
+	Trc_MM_AdaptiveTaskThreading_taskCompleted(env->getLanguageVMThread(), task->getBaseVirtualTypeId(), threadCount, work, timeInMicroSeconds, (double)throughput);
+}
+
+void
+MM_AdaptiveTaskThreading::clearReportedRuns()
+{
+	for (uintptr_t i = 0; i < entryCount; i++) {
+		_entries[i]._reportedRuns = 0;
+	}
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ADAPTIVETASKTHREADING_HPP_)
+#define ADAPTIVETASKTHREADING_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_Task;
+
+/**
+ * Per task thread count policy used by MM_ParallelDispatcher (enabled with MM_GCExtensionsBase::adaptiveTaskThreading).
+ *
+ * Tasks that report the work they have done (MM_Task::getCompletedWork()) are tracked by type. After each run the
+ * work and the throughput per thread (work per microsecond of thread time) are folded into weighted averages.
+ * Before the next run, the expected work is converted to thread time using the throughput, and the task is given
+ * one thread per adaptiveTaskThreadingTargetThreadTime microseconds of it, up to the count the dispatcher would otherwise
+ * use. The count follows the predicted thread time both ways: it shrinks when less work is expected, and grows back up
+ * to the maximum when more is. Since throughput is measured per thread, running with few threads does not prevent the
+ * count from growing again.
+ * @ingroup GC_Base
+ */
+class MM_AdaptiveTaskThreading : public MM_BaseVirtual
+{
+/* Data members / types */
+public:
+	enum {
+		entryCount = 16 /**< Number of distinct task types that can be tracked */
+	};
+
+	struct Entry {
+		const char *_taskName; /**< Type id of the task, NULL if the entry is free */
+		float _averageWork; /**< Weighted average of the work done by a run of the task */
+		float _averageThroughput; /**< Weighted average of the work done per microsecond of thread time */
+		uintptr_t _lastThreadCount; /**< Thread count of the most recent run */
+		uintptr_t _lastWork; /**< Work done by the most recent run */
+		uint64_t _lastTime; /**< Duration, in microseconds, of the most recent run */
+		uintptr_t _reportedRuns; /**< Number of runs since the last call to clearReportedRuns() */
+		uintptr_t _recommendedThreadCount; /**< Thread count picked for the most recent run, 0 if the task had no history */
+		uint64_t _predictedThreadTime; /**< Thread time, in microseconds, predicted when _recommendedThreadCount was picked */
+		uintptr_t _previousRecommendedThreadCount; /**< Thread count picked for the run before, 0 if none */
+		uint64_t _previousPredictedThreadTime; /**< Thread time, in microseconds, predicted when _previousRecommendedThreadCount was picked */
+	};
+
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	Entry _entries[entryCount];
+
+/* Methods */
+public:
+	static MM_AdaptiveTaskThreading *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Pick the number of threads to run a task with.
+	 * @param task the task about to be dispatched
+	 * @param maximumThreadCount the number of threads the dispatcher would otherwise use
+	 * @return a thread count in [1, maximumThreadCount], maximumThreadCount if the task has no history
+	 */
+	uintptr_t getRecommendedThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t maximumThreadCount);
+
+	/**
+	 * Account for a completed run of a task. Tasks that report no work are ignored.
+	 * @param threadCount the number of threads the task ran with
+	 * @param timeInMicroSeconds the time from dispatch to completion of the task
+	 */
+	void taskCompleted(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount, uint64_t timeInMicroSeconds);
+
+	/**
+	 * Reset the run counts reported by getEntry() (typically at the start of a GC).
+	 */
+	void clearReportedRuns();
+
+	/**
+	 * @return the entry at the given index, or NULL if the entry is free
+	 */
+	MMINLINE Entry *
+	getEntry(uintptr_t index)
+	{
+		Entry *entry = &_entries[index];
+		return (NULL == entry->_taskName) ? NULL : entry;
+	}
+
+	MM_AdaptiveTaskThreading(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	Entry *findEntry(const char *taskName, bool create);
+};
+
+#endif /* ADAPTIVETASKTHREADING_HPP_ */
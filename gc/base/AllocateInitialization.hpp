@@ -232,6 +232,8 @@ public:
 #endif /* OMR_GC_ALLOCATION_TAX */
 				}
 			}
+			/* report the object if it holds the next sampled byte of the thread */
+			env->reportAllocationSampleIfPending(objectPtr, _allocateDescription.getContiguousBytes(), _allocationCategory);
 		}
 
 		if (isGCAllowed()) {
@@ -47,8 +47,9 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	
 	/* Instantiate the Virtual Memory object for the card table */
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired)) {
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired, extensions->cardTablePagePolicy)) {
 		_cardTableStart = (Card *)(memoryManager->getHeapBase(&_cardTableMemoryHandle));
+		extensions->cardTablePageSize = memoryManager->getPageSize(&_cardTableMemoryHandle);
 		/* Initialize _heapbase; we will reset _heapAlloc in heapAddRange()/heapRemoveRange() as heap changes */
 		_heapBase = (void *)heap->getHeapBase();
 		_heapAlloc = (void *)heap->getHeapTop();
@@ -239,7 +240,9 @@ MM_CardTable::isDirtyOrValue(MM_EnvironmentBase *env, void *heapAddr, Card cardV
 void
 MM_CardTable::dirtyCard(MM_EnvironmentBase *env, omrobjectptr_t objectRef)
 {
-	dirtyCardWithValue(env, objectRef, CARD_DIRTY);
+	if (!_recordDirtiedCards || _recordingDirtiedCards) {
+		dirtyCardWithValue(env, objectRef, CARD_DIRTY);
+	}
 }
 
 void
@@ -256,6 +259,9 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			if (_recordingDirtiedCards && (CARD_CLEAN == oldValue)) {
+				recordDirtiedCard(env, card);
+			}
 		}
 	}
 }
@@ -268,8 +274,12 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		
 	for ( ; card < toCard; card++) {
 		/* If card not already dirty then dirty it */
-		if ((Card)CARD_DIRTY != *card) {
+		Card oldValue = *card;
+		if ((Card)CARD_DIRTY != oldValue) {
 			*card = (Card)CARD_DIRTY;
+			if (_recordingDirtiedCards && ((Card)CARD_CLEAN == oldValue)) {
+				recordDirtiedCard(env, card);
+			}
 		}
 	}
 }
@@ -57,6 +57,8 @@ class MM_CardTable : public MM_BaseVirtual
 public:
 protected:
 	void *_heapAlloc;
+	bool _recordDirtiedCards; /**< If true, recordDirtiedCard() is called for every card dirtied by dirtyCard() which was clean */
+	volatile bool _recordingDirtiedCards; /**< While _recordDirtiedCards is set, dirtyCard() only dirties cards, and records them, while this is true. Only changed with the mutators stopped */
 private:
 	MM_MemoryHandle _cardTableMemoryHandle;	/**< memory handle for array backing store */
 	Card *_cardTableStart;
@@ -99,6 +101,8 @@ public:
 	 * @param[in] env The thread which is attempting to write to obj
 	 * @param[in] objectRef The object being modified
 	 * @note Called by the write barrier so this must be fast (although the operation is inlined, in the JIT)
+	 * @note While dirtied cards are recorded, cards are not dirtied until recording starts, as the cards dirtied
+	 * before then need no cleaning. Use dirtyCardWithValue() to dirty a card regardless.
 	 */
 	void dirtyCard(MM_EnvironmentBase *env, omrobjectptr_t objectRef);
 
@@ -257,6 +261,13 @@ protected:
 	 * @return false if the decommit failed
 	 */
 	bool decommitCardTableMemory(MM_EnvironmentBase *env, Card *lowCard, Card *highCard, Card *lowValidCard, Card *highValidCard);
+
+	/**
+	 * Called, when _recordDirtiedCards is set, for every card which goes from clean to dirty while _recordingDirtiedCards is set.
+	 * @param[in] env The thread which dirtied the card
+	 * @param[in] card The card
+	 */
+	virtual void recordDirtiedCard(MM_EnvironmentBase *env, Card *card) {}
 	
 	/**
 	 * Create a CardTable object.
@@ -264,6 +275,8 @@ protected:
 	MM_CardTable()
 		: MM_BaseVirtual()
 		, _heapAlloc(NULL)
+		, _recordDirtiedCards(false)
+		, _recordingDirtiedCards(false)
 		, _cardTableMemoryHandle()
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
@@ -36,6 +36,7 @@
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapPretoucher.hpp"
 #include "HeapRegionManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
@@ -121,6 +122,11 @@ MM_Configuration::tearDown(MM_EnvironmentBase* env)
 		extensions->globalAllocationManager = NULL;
 	}
 
+	if (NULL != extensions->heapPretoucher) {
+		extensions->heapPretoucher->kill(env);
+		extensions->heapPretoucher = NULL;
+	}
+
 	if (NULL != extensions->heap) {
 		extensions->heap->kill(env);
 		extensions->heap = NULL;
@@ -246,7 +252,17 @@ MM_Configuration::createHeap(MM_EnvironmentBase* env, uintptr_t heapBytesRequest
 			heap = NULL;
 		}
 
+		/* Create the pretoucher before the heap is published, so a failure does not leave a killed heap in the extensions */
+		if ((NULL != heap) && extensions->pretouchHeapOnExpand && (extensions->pretouchHeapInParallel || extensions->pretouchHeapInBackground)) {
+			extensions->heapPretoucher = MM_HeapPretoucher::newInstance(env, heap->getPageSize());
+			if (NULL == extensions->heapPretoucher) {
+				heap->kill(env);
+				return NULL;
+			}
+		}
+
 		extensions->heap = heap;
+
 		if (!_delegate.heapInitialized(env)) {
 			heap->kill(env);
 			heap = NULL;
@@ -480,6 +496,8 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 			extensions->splitFreeListSplitAmount = (omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE) - 1) / 8  +  1;
 		}
 	}
+
+	extensions->heapMapRunFinder.initialize(env->getPortLibrary(), extensions->vectorHeapMapScan);
 }
 
 bool
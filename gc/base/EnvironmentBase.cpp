@@ -22,6 +22,8 @@
 
 #include "omrcfg.h"
 
+#include <math.h>
+
 #include "j9nongenerated.h"
 #include "mmhook_common.h"
 #include "mmprivatehook.h"
@@ -100,8 +102,8 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 	}
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
-	/* Disable dynamic depth copying if scavengerDynamicBreadthFirstScanOrdering is not selected */ 
-	if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST != extensions->scavengerScanOrdering) {
+	/* Disable dynamic depth copying if neither scavengerDynamicBreadthFirstScanOrdering nor hierarchicalDepthCopy is selected */ 
+	if (!extensions->isScavengerHotFieldDepthCopyEnabled()) {
 		disableHotFieldDepthCopy();
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
@@ -121,6 +123,11 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 			return false;
 		}
 	}
+	_segregatedRememberedSet.count = 0;
+	_segregatedRememberedSet.fragmentCurrent = NULL;
+	_segregatedRememberedSet.fragmentTop = NULL;
+	_segregatedRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+	_segregatedRememberedSet.parentList = &extensions->rememberedSet;
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	return _delegate.initialize(this);
@@ -232,6 +239,41 @@ MM_EnvironmentBase::reportExclusiveAccessRelease()
 				J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE);
 }
 
+void
+MM_EnvironmentBase::reportAllocationSample(omrobjectptr_t objectPtr, uintptr_t size, uintptr_t allocationCategory)
+{
+	MM_GCExtensionsBase *extensions = getExtensions();
+	TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE(
+				extensions->omrHookInterface,
+				_omrVMThread,
+				objectPtr,
+				size,
+				allocationCategory,
+				extensions->allocationSamplingInterval);
+}
+
+uintptr_t
+MM_EnvironmentBase::nextAllocationSamplingInterval()
+{
+	if (0 == _allocationSamplingRandomState) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		_allocationSamplingRandomState = ((uint64_t)(uintptr_t)this ^ omrtime_hires_clock()) | 1;
+	}
+	/* xorshift64*, the top 53 bits give a uniform double in (0, 1] */
+	uint64_t x = _allocationSamplingRandomState;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	_allocationSamplingRandomState = x;
+	double uniform = (double)(((x * 2685821657736338717ULL) >> 11) + 1) / 9007199254740992.0;
+	double interval = -log(uniform) * (double)getExtensions()->allocationSamplingInterval;
+	/* clamp the (vanishingly unlikely) tail so the interval never overflows */
+	if (interval >= (double)(UDATA_MAX >> 1)) {
+		return UDATA_MAX >> 1;
+	}
+	return (uintptr_t)interval + 1;
+}
+
 void
 MM_EnvironmentBase::allocationFailureStartReportIfRequired(MM_AllocateDescription *allocDescription, uintptr_t flags)
 {
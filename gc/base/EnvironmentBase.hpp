@@ -24,6 +24,7 @@
 #define ENVIRONMENTBASECORE_HPP_
 
 #include "omrcomp.h"
+#include "j9nongenerated.h"
 #include "modronbase.h"
 #include "omr.h"
 #include "thread_api.h"
@@ -149,6 +150,8 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uint64_t _allocationSamplingRandomState; /**< State of the generator drawing the intervals between allocation samples, 0 until seeded */
+	bool _allocationSamplePending; /**< True if the object being allocated by the thread is an allocation sample to report once initialized. Cleared when the allocation interface is entered, so a sample never outlives its allocation */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -162,6 +165,7 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
+	J9VMGC_SublistFragment _segregatedRememberedSet; /**< thread local fragment of the remembered set of segregated young collections */
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
@@ -190,6 +194,7 @@ protected:
 
 	void reportExclusiveAccessRelease();
 	void reportExclusiveAccessAcquire();
+	void reportAllocationSample(omrobjectptr_t objectPtr, uintptr_t size, uintptr_t allocationCategory);
 
 public:
 	static MM_EnvironmentBase *newInstance(MM_GCExtensionsBase *extensions, OMR_VMThread *vmThread);
@@ -347,6 +352,16 @@ public:
 	 * @return true on success, false on failure 
 	 */
 	MMINLINE bool setNumaAffinity(uintptr_t *numaNodes, uintptr_t arrayLength) { return 0 == omrthread_numa_set_node_affinity(_omrVMThread->_os_thread, numaNodes, arrayLength, 0); }
+
+	/**
+	 * Get the NUMA nodes the thread currently has affinity with.
+	 *
+	 * @param numaNodes[out] The array to receive the node numbers (0 indicates no affinity)
+	 * @param arrayLength[in/out] On input the number of elements in numaNodes, on output the number of nodes the thread has affinity with (may exceed the input)
+	 *
+	 * @return true on success, false on failure
+	 */
+	MMINLINE bool getNumaAffinity(uintptr_t *numaNodes, uintptr_t *arrayLength) { return 0 == omrthread_numa_get_node_affinity(_omrVMThread->_os_thread, numaNodes, arrayLength); }
 		
 	/**
 	 * Get the threads worker id.
@@ -551,18 +566,18 @@ public:
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	/**
-	 * Disable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering
+	 * Disable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering and hierarchicalDepthCopy
 	 */
 	MMINLINE void disableHotFieldDepthCopy()
 	{
 		_hotFieldCopyDepthCount = getExtensions()->depthCopyMax;
 	}
 	/**
-	 * Enable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering
+	 * Enable scavenger hot field depth copying for dynamicBreadthFirstScanOrdering and hierarchicalDepthCopy
 	 */
 	MMINLINE void enableHotFieldDepthCopy()
 	{ 
-		if (getExtensions()->scavengerScanOrdering == MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST) {
+		if (getExtensions()->isScavengerHotFieldDepthCopyEnabled()) {
 			_hotFieldCopyDepthCount = 0;
 		}
 	}
@@ -611,6 +626,32 @@ public:
 
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
+	/**
+	 * Draw the number of bytes the thread allocates before its next allocation sample. Intervals are
+	 * exponentially distributed around allocationSamplingInterval, so every allocated byte is equally likely
+	 * to be sampled whatever the allocation pattern of the thread.
+	 * @return the interval in bytes, at least 1
+	 */
+	uintptr_t nextAllocationSamplingInterval();
+
+	/**
+	 * Report the object just allocated and initialized through J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE if it
+	 * is an allocation sample.
+	 * @param objectPtr the allocated object, NULL if its allocation or initialization failed
+	 * @param size the size of the object in bytes
+	 * @param allocationCategory the language-defined category of the object
+	 */
+	MMINLINE void
+	reportAllocationSampleIfPending(omrobjectptr_t objectPtr, uintptr_t size, uintptr_t allocationCategory)
+	{
+		if (_allocationSamplePending) {
+			_allocationSamplePending = false;
+			if (NULL != objectPtr) {
+				reportAllocationSample(objectPtr, size, allocationCategory);
+			}
+		}
+	}
+
 	MMINLINE uintptr_t getWorkUnitIndex() { return _workUnitIndex; }
 	MMINLINE uintptr_t getWorkUnitToHandle() { return _workUnitToHandle; }
 	MMINLINE void setWorkUnitToHandle(uintptr_t workUnitToHandle) { _workUnitToHandle = workUnitToHandle; }
@@ -733,6 +774,8 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSamplingRandomState(0)
+		,_allocationSamplePending(false)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -790,6 +833,8 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSamplingRandomState(0)
+		,_allocationSamplePending(false)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
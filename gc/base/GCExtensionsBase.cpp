@@ -155,6 +155,11 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 		gcmetadataPageFlags = pageFlags[0];
 	}
 
+#if defined(LINUX) && (defined(J9X86) || defined(J9HAMMER) || defined(AARCH64))
+	/* Transparent huge pages are only used for extents aligned to the PMD size */
+	transparentHugePageSize = TWO_MB;
+#endif /* defined(LINUX) && (defined(J9X86) || defined(J9HAMMER) || defined(AARCH64)) */
+
 
 	if (!_forge.initialize(env->getPortLibrary())) {
 		goto failed;
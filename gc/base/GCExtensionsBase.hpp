@@ -37,6 +37,7 @@
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HeapMapRunFinder.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -46,6 +47,7 @@
 #include "ScavengerCopyScanRatio.hpp"
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
+#include "SyncPointStats.hpp"
 
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
@@ -59,6 +61,7 @@ class MM_GlobalAllocationManager;
 class MM_GlobalCollector;
 class MM_Heap;
 class MM_HeapMap;
+class MM_HeapPretoucher;
 class MM_HeapRegionManager;
 
 class MM_InterRegionRememberedSet;
@@ -195,6 +198,7 @@ private:
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 
 	bool _isRememberedSetInOverflow;
+	bool _isRememberedSetOverflowUnrecorded; /**< set if a remembered object which did not fit in the remembered set may not have been recorded in the scavenger's overflow map */
 
 	volatile BackOutState _backOutState; /**< set if a thread is unable to copy an object due to lack of free space in both Survivor and Tenure */
 	volatile bool _concurrentGlobalGCInProgress; /**< set to true if concurrent Global GC is in progress */
@@ -265,6 +269,18 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	enum MetadataPagePolicy {
+		METADATA_PAGE_POLICY_DEFAULT = 0, /**< gcmetadataPageSize pages, possibly shared with other metadata */
+		METADATA_PAGE_POLICY_HUGE, /**< requestedPageSize pages (if they are large pages), in a reservation of its own */
+		METADATA_PAGE_POLICY_TRANSPARENT, /**< gcmetadataPageSize pages, aligned and sized to transparentHugePageSize so the OS can back them with huge pages */
+	};
+	MetadataPagePolicy heapMapPagePolicy; /**< page policy for heap maps (mark maps) */
+	MetadataPagePolicy cardTablePagePolicy; /**< page policy for the card table and the TLH mark map */
+	MetadataPagePolicy compactTablePagePolicy; /**< page policy for the compact forwarding tables */
+	uintptr_t transparentHugePageSize; /**< size of the huge pages the OS may transparently back memory with, 0 if unknown */
+	uintptr_t heapMapPageSize; /**< page size the heap map got, 0 until it is allocated */
+	uintptr_t cardTablePageSize; /**< page size the card table got, 0 until it is allocated */
+	uintptr_t compactTablePageSize; /**< page size the compact forwarding tables got, 0 until they are allocated */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -294,6 +310,7 @@ public:
 	bool doFrequentObjectAllocationSampling; /**< Whether to track object allocations*/
 	uintptr_t oolObjectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _oolTraceAllocationBytes. */
 	uintptr_t objectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _traceAllocationBytes. */
+	uintptr_t allocationSamplingInterval; /**< Average number of bytes a thread allocates between two J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLE events (0 to disable). Not used along with objectSamplingBytesGranularity, which owns the TLH sampling top then */
 
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
@@ -336,6 +353,7 @@ public:
 	const char* gcModeString;
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
+	bool splitFreeListSearchCursors; /**< If true, MPSAOL free lists keep a first fit search cursor per power of two size class to skip entries too small for an allocation */
 	bool enableHybridMemoryPool;
 
 	bool largeObjectArea;
@@ -383,6 +401,7 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workPacketStealing; /**< if true, GC threads keep the packets they fill in a private deque and steal from each other when out of work, instead of exchanging all packets through the shared packet lists */
 
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -431,16 +450,27 @@ public:
 	uintptr_t fvtest_forceReferenceChainWalkerMarkMapCommitFailureCounter; /**< Force failure at Reference Chain Walker Mark Map commit operation counter */
 
 	uintptr_t fvtest_forceCopyForwardHybridRatio; /**< Force to run CopyForward Hybrid mode value = 1-100 the percentage of non evacuated eden regions */
+	uintptr_t fvtest_rememberedSetMaximumSize; /**< If non-zero, the most bytes the remembered set may grow to, to force remembered set overflow */
 	uintptr_t softMx; /**< set through -Xsoftmx, depending on GC policy this number might differ from available heap memory, use MM_Heap::getActualSoftMxSize for calculations */
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	bool preZeroNurseryInBackground; /**< with batchClearTLH, survivor space is zeroed by a low priority background thread between scavenges, so the TLHs later carved from it need not be cleared */
+	uintptr_t preZeroedNurseryLow; /**< Free memory in [preZeroedNurseryLow, preZeroedNurseryHigh) is zero apart from the headers of the free entries, set by the scavenger */
+	uintptr_t preZeroedNurseryHigh;
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
 	uintptr_t dispatcherHybridNotifyThreadBound; /** Bound for determining hybrid notification type (Individual notifies for count < MIN(bound, maxThreads/2), otherwise notify_all) */
+	bool gcSyncTreeBarrier; /**< if true, GC threads of a parallel task synchronize on a spin-then-park combining tree barrier instead of the dispatcher synchronize monitor */
+	uintptr_t gcSyncBarrierSpinCount; /**< number of times a thread waiting on the tree barrier checks for release before it parks */
+	bool syncPointStatsEnabled; /**< if true, the time GC threads wait at each synchronization point is recorded in syncPointStats (and reported by verbose GC) */
+	MM_SyncPointStats syncPointStats; /**< per synchronization point wait times, recorded only if syncPointStatsEnabled */
+	bool adaptiveTaskThreading; /**< if true, the dispatcher picks the active thread count of each task from the work recently done by the task and the measured per thread throughput */
+	uintptr_t adaptiveTaskThreadingTargetThreadTime; /**< with adaptiveTaskThreading, the amount of work (in microseconds of thread time) each active thread of a task should be given */
+	float adaptiveTaskThreadingWeight; /**< with adaptiveTaskThreading, weight given to the most recent run of a task when averaging its work and throughput */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -456,6 +486,7 @@ public:
 	bool depthCopyTwoPaths;
 	bool depthCopyThreePaths;
 	bool alwaysDepthCopyFirstOffset;
+	bool hierarchicalDepthCopy; /**< if true, with hierarchical scan ordering the hot fields and then the other children of a copied object are copied right after it, ahead of its scan (up to depthCopyMax levels) */
 	bool allowPermanantHotFields;
 	bool hotFieldResettingEnabled;
 	uintptr_t maxConsecutiveHotFieldSelections;
@@ -477,6 +508,8 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNUMAPartitioning; /**< if true, Scavenger GC threads are bound to NUMA nodes (affinity leaders) and scan caches are queued per node, so work copied on a node is preferentially scanned there */
+	bool scavengerRememberedSetOverflowMap; /**< if true, remembered objects which do not fit in the remembered set are recorded in a card indexed object map, so an overflowed remembered set is scanned without walking the tenure space */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -557,6 +590,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactSliding; /**< If true, compact by sliding objects down their region, with forwarding addresses computed from the mark map, rather than by evacuating sub areas */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -572,6 +606,9 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool concurrentCardCleaningQueue; /**< If true, cards dirtied by the write barrier are queued in per-thread buffers and card cleaning drains the queue instead of scanning the card table. Requires optimizeConcurrentWB */
+	uintptr_t concurrentCardCleaningQueueSize; /**< Number of cards the dirty card queue holds (concurrentCardCleaningQueue), 0 to size it to the maximum heap */
+	uintptr_t finalCardCleaningPauseTarget; /**< Target time for final card cleaning in microseconds. If non-zero, extra concurrent card cleaning passes are run while the final card cleaning is predicted to exceed it. 0 to disable */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -661,6 +698,7 @@ public:
 	uintptr_t traceCostToCheckYield; /**< tracing cost (in number of objects marked and pointers scanned) after we try to yield */
 	uintptr_t sweepCostToCheckYield; /**< weighted count of free chunks/marked objects before we check yield in sweep small loop */
 	uintptr_t splitAvailableListSplitAmount; /**< Number of split available lists per size class, per defragment bucket */
+	uintptr_t segregatedRegionRefillBatchSize; /**< Number of available regions of a size class an allocation context claims from the region pool at once */
 	uint32_t newThreadAllocationColor;
 	uintptr_t minimumFreeEntrySize;
 	uintptr_t arrayletsPerRegion;
@@ -675,6 +713,10 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool concurrentSweepSegregated; /**< if true, small regions are left queued after marking, to be swept by mutators on demand and by background sweep threads */
+	uintptr_t concurrentSweepSegregatedThreads; /**< number of background threads sweeping small regions while mutators run */
+	bool segregatedYoungCollection; /**< if true, most collections of the segregated heap only mark and free the objects allocated since the previous collection */
+	uintptr_t segregatedYoungCollectionsPerFullCollection; /**< number of young collections of the segregated heap between two full collections */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -686,6 +728,8 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool verboseEventLog; /**< Write verbose:gc output to a file as binary event records (see MM_VerboseEventLog) rather than XML */
+	uintptr_t verboseEventLogRecords; /**< Number of event records buffered in memory for the verbose event log, rounded up to a power of 2 */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -822,7 +866,13 @@ public:
 
 	uintptr_t darkMatterSampleRate;/**< the weight of darkMatterSample for standard gc, default:32, if the weight = 0, disable darkMatterSampling */
 
+	bool vectorHeapMapScan; /**< If true, runs of empty or non-empty heap map slots are skipped with the widest vector instructions the processor supports */
+	MM_HeapMapRunFinder heapMapRunFinder; /**< Finds the end of heap map slot runs, with the kernel selected for the processor at startup */
+
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
+	bool pretouchHeapInParallel; /**< with pretouchHeapOnExpand, the initial heap is pretouched by the GC worker threads once they are started, rather than by the thread inflating the heap */
+	bool pretouchHeapInBackground; /**< with pretouchHeapOnExpand, heap expansions are pretouched by a low priority background thread, rather than by the expanding thread */
+	MM_HeapPretoucher *heapPretoucher; /**< pretouches the heap when pretouchHeapInParallel or pretouchHeapInBackground is set */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	uintptr_t idleMinimumFree;   /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
@@ -913,6 +963,18 @@ public:
 	MMINLINE void setObjectMap(MM_ObjectMap *objectMap) { _objectMap = objectMap; }
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
+	/**
+	 * @return true if the scavenger depth copies the hot fields of copied objects (dynamicBreadthFirstScanOrdering, or hierarchical scan ordering with hierarchicalDepthCopy)
+	 */
+	MMINLINE bool
+	isScavengerHotFieldDepthCopyEnabled()
+	{
+		return (OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == scavengerScanOrdering)
+			|| ((OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL == scavengerScanOrdering) && hierarchicalDepthCopy);
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
+
 	MMINLINE bool
 	isConcurrentScavengerEnabled()
 	{
@@ -1088,8 +1150,21 @@ public:
 	}
 
 	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow; }
-	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetInOverflow = true; }
-	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; }
+	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetOverflowUnrecorded = true; _isRememberedSetInOverflow = true; }
+	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; _isRememberedSetOverflowUnrecorded = false; }
+
+	/**
+	 * Set the overflow state for a remembered object which did not fit in the remembered set and has been
+	 * recorded in the scavenger's overflow map instead.
+	 */
+	MMINLINE void setRememberedSetOverflowRecordedState() { _isRememberedSetInOverflow = true; }
+
+	/**
+	 * @return true if the remembered set is in an overflow state and every remembered object which did not
+	 * fit in it has been recorded in the scavenger's overflow map, so the remembered objects can be found
+	 * without walking the tenure space
+	 */
+	MMINLINE bool isRememberedSetOverflowRecorded() { return _isRememberedSetInOverflow && !_isRememberedSetOverflowUnrecorded; }
 
 	MMINLINE void setScavengerBackOutState(BackOutState backOutState) { _backOutState = backOutState; }
 	MMINLINE BackOutState getScavengerBackOutState() { return _backOutState; }
@@ -1352,6 +1427,7 @@ public:
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
 		, _isRememberedSetInOverflow(false)
+		, _isRememberedSetOverflowUnrecorded(false)
 		, _backOutState(backOutFlagCleared)
 		, _concurrentGlobalGCInProgress(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1406,6 +1482,13 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapMapPagePolicy(METADATA_PAGE_POLICY_DEFAULT)
+		, cardTablePagePolicy(METADATA_PAGE_POLICY_DEFAULT)
+		, compactTablePagePolicy(METADATA_PAGE_POLICY_DEFAULT)
+		, transparentHugePageSize(0)
+		, heapMapPageSize(0)
+		, cardTablePageSize(0)
+		, compactTablePageSize(0)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1427,6 +1510,7 @@ public:
 		, doFrequentObjectAllocationSampling(false) /* Finds most frequently allocated classes. Disabled by default. */
 		, oolObjectSamplingBytesGranularity(16*1024*1024) /* Default granularity set to 16M (shows <1% perf loss). */
 		, objectSamplingBytesGranularity(UDATA_MAX) /* default UDATA_MAX (disabled) */
+		, allocationSamplingInterval(0)
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
@@ -1459,6 +1543,7 @@ public:
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
+		, splitFreeListSearchCursors(true)
 		, enableHybridMemoryPool(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -1494,6 +1579,7 @@ public:
 		, useGCStartupHints(true)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workPacketStealing(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1534,13 +1620,24 @@ public:
 		, fvtest_forceReferenceChainWalkerMarkMapCommitFailure(0)
 		, fvtest_forceReferenceChainWalkerMarkMapCommitFailureCounter(0)
 		, fvtest_forceCopyForwardHybridRatio(0)
+		, fvtest_rememberedSetMaximumSize(0)
 		, softMx(0) /* softMx only set if specified */
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 		, batchClearTLH(0)
+		, preZeroNurseryInBackground(false)
+		, preZeroedNurseryLow(0)
+		, preZeroedNurseryHigh(0)
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
 		, dispatcherHybridNotifyThreadBound(16)
+		, gcSyncTreeBarrier(false)
+		, gcSyncBarrierSpinCount(256)
+		, syncPointStatsEnabled(false)
+		, syncPointStats()
+		, adaptiveTaskThreading(false)
+		, adaptiveTaskThreadingTargetThreadTime(1000)
+		, adaptiveTaskThreadingWeight(0.50f)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		/* Start of options relating to dynamicBreadthFirstScanOrdering */
@@ -1550,6 +1647,7 @@ public:
 		, depthCopyTwoPaths(true)
 		, depthCopyThreePaths(false)
 		, alwaysDepthCopyFirstOffset(false)
+		, hierarchicalDepthCopy(false)
 		, allowPermanantHotFields (false)
 		, hotFieldResettingEnabled (false)
 		, maxConsecutiveHotFieldSelections(10)
@@ -1572,6 +1670,8 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNUMAPartitioning(false)
+		, scavengerRememberedSetOverflowMap(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1637,6 +1737,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactSliding(false)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1650,6 +1751,9 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, concurrentCardCleaningQueue(false)
+		, concurrentCardCleaningQueueSize(0)
+		, finalCardCleaningPauseTarget(0)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1715,6 +1819,7 @@ public:
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
 		, sweepCostToCheckYield(500) /* weighted count of free chunks/marked objects before we check yield in sweep small loop */
 		, splitAvailableListSplitAmount(0)
+		, segregatedRegionRefillBatchSize(4)
 		, newThreadAllocationColor(0)
 		, minimumFreeEntrySize((uintptr_t)-1) /* -1 => user did not override default minimumFreeEntrySize */
 		, arrayletsPerRegion(0)
@@ -1728,12 +1833,18 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, concurrentSweepSegregated(false)
+		, concurrentSweepSegregatedThreads(1)
+		, segregatedYoungCollection(false)
+		, segregatedYoungCollectionsPerFullCollection(8)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, verboseEventLog(false)
+		, verboseEventLogRecords(4096)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1831,7 +1942,12 @@ public:
 		, referenceChainWalkerMarkMap(NULL)
 		, trackMutatorThreadCategory(false)
 		, darkMatterSampleRate(32)
+		, vectorHeapMapScan(true)
+		, heapMapRunFinder()
 		, pretouchHeapOnExpand(false)
+		, pretouchHeapInParallel(false)
+		, pretouchHeapInBackground(false)
+		, heapPretoucher(NULL)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleMinimumFree(0)
 		, gcOnIdle(false)
@@ -71,6 +71,14 @@ public:
 
 	virtual void yield(MM_EnvironmentBase *env) {};
 
+	/**
+	 * Write barrier of a global collector which collects the objects allocated since its previous collection
+	 * on their own, called when a reference to childObject is stored into parentObject.
+	 * @param parentObject the object stored into
+	 * @param childObject the reference stored
+	 */
+	virtual void generationalWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject) {}
+
 	/**
  	 * Perform any collector-specific initialization.
  	 * @return TRUE if startup completes OK, FALSE otherwise
@@ -131,6 +131,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the rest of the run of empty slots in one go */
+				uintptr_t heapMapSlotsLeft = MM_Math::roundToCeiling(J9MODRON_HMI_HEAPMAP_ALIGNMENT, (uintptr_t)_heapChunkTop - (uintptr_t)_heapSlotCurrent) / J9MODRON_HMI_HEAPMAP_ALIGNMENT;
+				uintptr_t *heapMapSlotNonEmpty = _extensions->heapMapRunFinder.findNonEmptySlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + heapMapSlotsLeft);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNonEmpty;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
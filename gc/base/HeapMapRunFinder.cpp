@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "ut_j9mm.h"
+
+#include "HeapMapRunFinder.hpp"
+
+/* The vector kernels assume 64 bit heap map slots. GCC and clang only allow the intrinsics in functions
+ * compiled for the instruction set, which lets the rest of the GC keep the baseline instruction set.
+ */
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && (defined(__GNUC__) || defined(_MSC_VER))
+#define HEAPMAPRUNFINDER_VECTOR_KERNELS
+#include <immintrin.h>
+#if defined(__GNUC__)
+#define HEAPMAPRUNFINDER_TARGET(isa) __attribute__((target(isa)))
+#else /* defined(__GNUC__) */
+#define HEAPMAPRUNFINDER_TARGET(isa)
+#endif /* defined(__GNUC__) */
+#endif /* defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && (defined(__GNUC__) || defined(_MSC_VER)) */
+
+static uintptr_t *
+findNonEmptySlotScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t *
+findEmptySlotScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 != *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+#if defined(HEAPMAPRUNFINDER_VECTOR_KERNELS)
+/* The vector kernels only find the 256 bit step the run ends in, the scalar kernel finds the slot within it */
+#define HEAPMAPRUNFINDER_SLOTS_PER_STEP 4
+
+HEAPMAPRUNFINDER_TARGET("sse4.1") static uintptr_t *
+findNonEmptySlotSSE41(uintptr_t *current, uintptr_t *top)
+{
+	while (HEAPMAPRUNFINDER_SLOTS_PER_STEP <= (uintptr_t)(top - current)) {
+		__m128i slots = _mm_or_si128(_mm_loadu_si128((__m128i *)current), _mm_loadu_si128((__m128i *)(current + 2)));
+		if (!_mm_testz_si128(slots, slots)) {
+			break;
+		}
+		current += HEAPMAPRUNFINDER_SLOTS_PER_STEP;
+	}
+	return findNonEmptySlotScalar(current, top);
+}
+
+HEAPMAPRUNFINDER_TARGET("sse4.1") static uintptr_t *
+findEmptySlotSSE41(uintptr_t *current, uintptr_t *top)
+{
+	const __m128i zero = _mm_setzero_si128();
+	while (HEAPMAPRUNFINDER_SLOTS_PER_STEP <= (uintptr_t)(top - current)) {
+		__m128i emptySlots = _mm_or_si128(
+				_mm_cmpeq_epi64(_mm_loadu_si128((__m128i *)current), zero),
+				_mm_cmpeq_epi64(_mm_loadu_si128((__m128i *)(current + 2)), zero));
+		if (!_mm_testz_si128(emptySlots, emptySlots)) {
+			break;
+		}
+		current += HEAPMAPRUNFINDER_SLOTS_PER_STEP;
+	}
+	return findEmptySlotScalar(current, top);
+}
+
+HEAPMAPRUNFINDER_TARGET("avx2") static uintptr_t *
+findNonEmptySlotAVX2(uintptr_t *current, uintptr_t *top)
+{
+	while (HEAPMAPRUNFINDER_SLOTS_PER_STEP <= (uintptr_t)(top - current)) {
+		__m256i slots = _mm256_loadu_si256((__m256i *)current);
+		if (!_mm256_testz_si256(slots, slots)) {
+			break;
+		}
+		current += HEAPMAPRUNFINDER_SLOTS_PER_STEP;
+	}
+	return findNonEmptySlotScalar(current, top);
+}
+
+HEAPMAPRUNFINDER_TARGET("avx2") static uintptr_t *
+findEmptySlotAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	while (HEAPMAPRUNFINDER_SLOTS_PER_STEP <= (uintptr_t)(top - current)) {
+		__m256i emptySlots = _mm256_cmpeq_epi64(_mm256_loadu_si256((__m256i *)current), zero);
+		if (!_mm256_testz_si256(emptySlots, emptySlots)) {
+			break;
+		}
+		current += HEAPMAPRUNFINDER_SLOTS_PER_STEP;
+	}
+	return findEmptySlotScalar(current, top);
+}
+#endif /* defined(HEAPMAPRUNFINDER_VECTOR_KERNELS) */
+
+MM_HeapMapRunFinder::MM_HeapMapRunFinder()
+	: _findNonEmptySlot(findNonEmptySlotScalar)
+	, _findEmptySlot(findEmptySlotScalar)
+	, _kernel(kernel_scalar)
+{
+}
+
+void
+MM_HeapMapRunFinder::initialize(OMRPortLibrary *portLibrary, bool vector)
+{
+	_findNonEmptySlot = findNonEmptySlotScalar;
+	_findEmptySlot = findEmptySlotScalar;
+	_kernel = kernel_scalar;
+
+#if defined(HEAPMAPRUNFINDER_VECTOR_KERNELS)
+	if (vector) {
+		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		OMRProcessorDesc processorDescription;
+		if (0 == omrsysinfo_get_processor_description(&processorDescription)) {
+			/* The AVX feature bits only say what the processor supports - the OS must also save the extended state */
+			if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_OSXSAVE)
+				&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX)
+				&& omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_AVX2)
+			) {
+				_findNonEmptySlot = findNonEmptySlotAVX2;
+				_findEmptySlot = findEmptySlotAVX2;
+				_kernel = kernel_avx2;
+			} else if (omrsysinfo_processor_has_feature(&processorDescription, OMR_FEATURE_X86_SSE4_1)) {
+				_findNonEmptySlot = findNonEmptySlotSSE41;
+				_findEmptySlot = findEmptySlotSSE41;
+				_kernel = kernel_sse4_1;
+			}
+		}
+	}
+#endif /* defined(HEAPMAPRUNFINDER_VECTOR_KERNELS) */
+
+	Trc_MM_HeapMapRunFinder_initialize(getKernelName());
+}
+
+const char *
+MM_HeapMapRunFinder::getKernelName() const
+{
+	switch (_kernel) {
+	case kernel_sse4_1:
+		return "sse4.1";
+	case kernel_avx2:
+		return "avx2";
+	default:
+		return "scalar";
+	}
+}
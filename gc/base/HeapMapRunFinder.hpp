@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPMAPRUNFINDER_HPP_)
+#define HEAPMAPRUNFINDER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+struct OMRPortLibrary;
+
+/**
+ * Finds the end of a run of empty (or non-empty) heap map slots.
+ * Sweep and heap map iteration spend most of their time walking long runs of such slots, so the walk
+ * is done by a kernel that tests 256 bits of the map at a time using the widest vector instructions
+ * the processor supports. The kernel is selected once, at startup, from the processor features reported
+ * by the port library. Until then (or if vector scans are disabled) a scalar kernel is used.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapMapRunFinder
+{
+	/* Data Members */
+public:
+	enum Kernel {
+		kernel_scalar = 0,
+		kernel_sse4_1,
+		kernel_avx2
+	};
+
+protected:
+private:
+	typedef uintptr_t *(*FindSlotFunction)(uintptr_t *current, uintptr_t *top);
+
+	FindSlotFunction _findNonEmptySlot; /**< Kernel returning the first non-empty slot in a range */
+	FindSlotFunction _findEmptySlot; /**< Kernel returning the first empty slot in a range */
+	Kernel _kernel; /**< The kernel in use */
+
+	/* Member Functions */
+private:
+protected:
+public:
+	/**
+	 * Select the kernels for the processor we are running on.
+	 * @param portLibrary the port library describing the processor
+	 * @param vector false to force the scalar kernels
+	 */
+	void initialize(OMRPortLibrary *portLibrary, bool vector);
+
+	/**
+	 * @param current the first heap map slot to examine
+	 * @param top the heap map slot after the last one to examine
+	 * @return the first slot in [current, top) with a bit set, or top if there is none
+	 */
+	MMINLINE uintptr_t *
+	findNonEmptySlot(uintptr_t *current, uintptr_t *top)
+	{
+		/* runs of a single slot are common enough not to pay for the call */
+		if ((current < top) && (0 != *current)) {
+			return current;
+		}
+		return _findNonEmptySlot(current, top);
+	}
+
+	/**
+	 * @param current the first heap map slot to examine
+	 * @param top the heap map slot after the last one to examine
+	 * @return the first slot in [current, top) with no bits set, or top if there is none
+	 */
+	MMINLINE uintptr_t *
+	findEmptySlot(uintptr_t *current, uintptr_t *top)
+	{
+		if ((current < top) && (0 == *current)) {
+			return current;
+		}
+		return _findEmptySlot(current, top);
+	}
+
+	Kernel getKernel() const { return _kernel; }
+
+	/**
+	 * @return the printable name of the kernel in use
+	 */
+	const char *getKernelName() const;
+
+	MM_HeapMapRunFinder();
+};
+
+#endif /* HEAPMAPRUNFINDER_HPP_ */
@@ -0,0 +1,299 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "ut_j9mm.h"
+
+#include "HeapPretoucher.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "ParallelDispatcher.hpp"
+#include "PretouchHeapTask.hpp"
+
+MM_HeapPretoucher *
+MM_HeapPretoucher::newInstance(MM_EnvironmentBase *env, uintptr_t pageSize)
+{
+	MM_HeapPretoucher *pretoucher = (MM_HeapPretoucher *)env->getForge()->allocate(sizeof(MM_HeapPretoucher), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != pretoucher) {
+		new (pretoucher) MM_HeapPretoucher(env, pageSize);
+		if (!pretoucher->initialize(env)) {
+			pretoucher->kill(env);
+			pretoucher = NULL;
+		}
+	}
+	return pretoucher;
+}
+
+MM_HeapPretoucher::MM_HeapPretoucher(MM_EnvironmentBase *env, uintptr_t pageSize)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _pageSize(pageSize)
+	, _monitor(NULL)
+	, _rangeCount(0)
+	, _claimedChunks(0)
+	, _completedChunks(0)
+	, _pretouchedBytes(0)
+	, _started(false)
+	, _threadState(THREAD_NONE)
+{
+	_typeId = __FUNCTION__;
+}
+
+void
+MM_HeapPretoucher::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapPretoucher::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_HeapPretoucher::monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+	return true;
+}
+
+void
+MM_HeapPretoucher::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		shutDown();
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_HeapPretoucher::startUp(MM_EnvironmentBase *env)
+{
+	bool result = true;
+	uintptr_t pretouchedBytes = 0;
+
+	if (_extensions->pretouchHeapInParallel) {
+		MM_PretouchHeapTask pretouchHeapTask(env, _extensions->dispatcher, this);
+		_extensions->dispatcher->run(env, &pretouchHeapTask);
+		pretouchedBytes = pretouchHeapTask.getPretouchedBytes();
+	}
+
+	omrthread_monitor_enter(_monitor);
+	_started = true;
+	if (_extensions->pretouchHeapInBackground) {
+		omrthread_t thread = NULL;
+		_threadState = THREAD_RUNNING;
+		if (0 != createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN, 0, pretouchThreadProc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+			_threadState = THREAD_NONE;
+			result = false;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	Trc_MM_HeapPretoucher_startUp(env->getLanguageVMThread(), pretouchedBytes, result ? 1 : 0);
+
+	return result;
+}
+
+void
+MM_HeapPretoucher::shutDown()
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		_threadState = THREAD_SHUTDOWN_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_NONE != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	_rangeCount = 0;
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_HeapPretoucher::heapCommitted(void *address, uintptr_t size, uintptr_t numaNode)
+{
+	bool queued = false;
+
+	omrthread_monitor_enter(_monitor);
+	/* Once the GC worker threads are started, only the background thread is left to touch queued ranges */
+	if ((!_started || (THREAD_RUNNING == _threadState)) && (_rangeCount < PRETOUCH_RANGES_MAX)) {
+		PretouchRange *range = &_ranges[_rangeCount];
+		range->low = (uintptr_t)address;
+		range->high = (uintptr_t)address + size;
+		range->numaNode = numaNode;
+		_rangeCount += 1;
+		queued = true;
+		omrthread_monitor_notify_all(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return queued;
+}
+
+void
+MM_HeapPretoucher::heapDecommitting(void *address, uintptr_t size)
+{
+	uintptr_t low = (uintptr_t)address;
+	uintptr_t high = low + size;
+
+	omrthread_monitor_enter(_monitor);
+	uintptr_t index = 0;
+	while (index < _rangeCount) {
+		PretouchRange *range = &_ranges[index];
+		if ((range->high <= low) || (high <= range->low)) {
+			index += 1;
+		} else if ((low <= range->low) && (range->high <= high)) {
+			/* the whole range goes away - fill the hole with the last range */
+			_rangeCount -= 1;
+			*range = _ranges[_rangeCount];
+		} else if (low <= range->low) {
+			range->low = high;
+			index += 1;
+		} else {
+			if (high < range->high) {
+				/* the range is split in two - the upper part is dropped if the queue is full, touching is only an optimization */
+				if (_rangeCount < PRETOUCH_RANGES_MAX) {
+					_ranges[_rangeCount] = *range;
+					_ranges[_rangeCount].low = high;
+					_rangeCount += 1;
+				}
+			}
+			range->high = low;
+			index += 1;
+		}
+	}
+
+	/* A chunk being touched is no longer in the queue, so it may be in the range. Only the chunks claimed so far
+	 * have to be waited for - the background thread touches chunks one at a time, in the order they are claimed.
+	 */
+	uintptr_t claimedChunks = _claimedChunks;
+	while (_completedChunks < claimedChunks) {
+		omrthread_monitor_wait(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+uintptr_t
+MM_HeapPretoucher::pretouchQueuedRanges()
+{
+	uintptr_t pretouchedBytes = 0;
+	PretouchRange chunk;
+
+	omrthread_monitor_enter(_monitor);
+	while (claimChunk(&chunk)) {
+		omrthread_monitor_exit(_monitor);
+		pretouchChunk(&chunk);
+		pretouchedBytes += chunk.high - chunk.low;
+		omrthread_monitor_enter(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return pretouchedBytes;
+}
+
+bool
+MM_HeapPretoucher::claimChunk(PretouchRange *chunk)
+{
+	bool claimed = false;
+
+	if (0 != _rangeCount) {
+		/* claim from the last range, so a range which is used up is simply dropped */
+		PretouchRange *range = &_ranges[_rangeCount - 1];
+		*chunk = *range;
+		if ((range->high - range->low) > PRETOUCH_CHUNK_SIZE) {
+			chunk->high = chunk->low + PRETOUCH_CHUNK_SIZE;
+			range->low = chunk->high;
+		} else {
+			_rangeCount -= 1;
+		}
+		_claimedChunks += 1;
+		claimed = true;
+	}
+
+	return claimed;
+}
+
+void
+MM_HeapPretoucher::pretouchChunk(PretouchRange *chunk)
+{
+	omrthread_t self = omrthread_self();
+	uintptr_t previousNode = 0;
+	uintptr_t previousNodeCount = 1;
+	bool rebound = false;
+
+	if (0 != chunk->numaNode) {
+		/* run on the node of the range while touching it, so the pages are placed there even without a binding */
+		if (0 != omrthread_numa_get_node_affinity(self, &previousNode, &previousNodeCount)) {
+			previousNodeCount = 0;
+		}
+		rebound = (0 == omrthread_numa_set_node_affinity(self, &chunk->numaNode, 1, 0));
+	}
+
+	/* The memory may already be in use, so it must be faulted in without changing it */
+	for (uintptr_t address = chunk->low; address < chunk->high; address = MM_Math::roundToFloor(_pageSize, address) + _pageSize) {
+		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), address), 0, 0);
+	}
+
+	if (rebound) {
+		omrthread_numa_set_node_affinity(self, &previousNode, previousNodeCount, 0);
+	}
+
+	omrthread_monitor_enter(_monitor);
+	_completedChunks += 1;
+	_pretouchedBytes += chunk->high - chunk->low;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_HeapPretoucher::pretouchThreadProc(void *info)
+{
+	MM_HeapPretoucher *pretoucher = (MM_HeapPretoucher *)info;
+	pretoucher->pretouchThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_HeapPretoucher::pretouchThreadEntryPoint()
+{
+	PretouchRange chunk;
+
+	omrthread_monitor_enter(_monitor);
+	while (THREAD_RUNNING == _threadState) {
+		if (claimChunk(&chunk)) {
+			omrthread_monitor_exit(_monitor);
+			pretouchChunk(&chunk);
+			omrthread_monitor_enter(_monitor);
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	_threadState = THREAD_NONE;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(HEAPPRETOUCHER_HPP_)
+#define HEAPPRETOUCHER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Faults in newly committed heap memory ahead of its first use, so allocations into it do not take the
+ * page faults on the mutator's critical path.
+ *
+ * Committed ranges are queued rather than touched by the committing thread. Ranges committed before the
+ * GC worker threads are started (the initial heap) are touched in parallel by the worker threads once they
+ * are started (pretouchHeapInParallel), and ranges committed after that by a minimum priority background
+ * thread (pretouchHeapInBackground). Memory may already be in use when it is touched, so every page is
+ * touched with an atomic compare and swap of 0 with 0, which faults the page in for writing but never
+ * changes its contents. Ranges are touched in chunks, and a thread touching a chunk bound to a NUMA node
+ * runs on that node while touching it, so the pages are placed on the node even under a first touch policy.
+ */
+class MM_HeapPretoucher : public MM_BaseVirtual
+{
+/* Data members & types */
+public:
+protected:
+private:
+	struct PretouchRange {
+		uintptr_t low; /**< First byte of the range */
+		uintptr_t high; /**< First byte after the range */
+		uintptr_t numaNode; /**< J9 NUMA node the range is bound to, 0 if none */
+	};
+
+	enum {
+		PRETOUCH_RANGES_MAX = 64, /**< Ranges which do not fit in the queue are touched by the committing thread */
+		PRETOUCH_CHUNK_SIZE = 4 * 1024 * 1024, /**< Most bytes touched per chunk claimed from the queue */
+	};
+
+	enum ThreadState {
+		THREAD_NONE = 0,
+		THREAD_RUNNING,
+		THREAD_SHUTDOWN_REQUESTED,
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	uintptr_t _pageSize; /**< Stride between touches */
+	omrthread_monitor_t _monitor; /**< Protects the queue and the thread state */
+	PretouchRange _ranges[PRETOUCH_RANGES_MAX]; /**< Queue of ranges left to touch */
+	uintptr_t _rangeCount; /**< Number of ranges in _ranges */
+	uintptr_t _claimedChunks; /**< Number of chunks claimed from the queue */
+	uintptr_t _completedChunks; /**< Number of claimed chunks which have been touched */
+	uintptr_t _pretouchedBytes; /**< Total bytes touched so far */
+	bool _started; /**< True once the GC worker threads are started */
+	ThreadState _threadState; /**< State of the background thread */
+
+/* Methods */
+public:
+	static MM_HeapPretoucher *newInstance(MM_EnvironmentBase *env, uintptr_t pageSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Called once the GC worker threads are started. Touches the ranges committed so far in parallel if
+	 * pretouchHeapInParallel, and starts the background thread if pretouchHeapInBackground.
+	 * @return false if the background thread could not be started
+	 */
+	bool startUp(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background thread. Ranges left in the queue are not touched.
+	 */
+	void shutDown();
+
+	/**
+	 * Queue a newly committed range of the heap to be touched.
+	 * @param numaNode J9 NUMA node the range is bound to, 0 if none
+	 * @return true if the range was queued, false if the caller should touch it
+	 */
+	bool heapCommitted(void *address, uintptr_t size, uintptr_t numaNode);
+
+	/**
+	 * Remove a range of the heap which is about to be decommitted from the queue, and wait for the chunks
+	 * being touched, so the range is not touched once decommitted.
+	 */
+	void heapDecommitting(void *address, uintptr_t size);
+
+	/**
+	 * Touch chunks claimed from the queue until it is empty.
+	 * @return the number of bytes touched
+	 */
+	uintptr_t pretouchQueuedRanges();
+
+	/**
+	 * @return the total number of bytes touched so far, by any thread
+	 */
+	MMINLINE uintptr_t getPretouchedBytes() { return _pretouchedBytes; }
+
+	MM_HeapPretoucher(MM_EnvironmentBase *env, uintptr_t pageSize);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Claim the next chunk of the queue. The monitor must be held.
+	 * @return true if a chunk was claimed, false if the queue is empty
+	 */
+	bool claimChunk(PretouchRange *chunk);
+
+	/**
+	 * Touch every page of a claimed chunk, then release it.
+	 */
+	void pretouchChunk(PretouchRange *chunk);
+
+	static int J9THREAD_PROC pretouchThreadProc(void *info);
+	void pretouchThreadEntryPoint();
+};
+
+#endif /* HEAPPRETOUCHER_HPP_ */
@@ -285,6 +285,22 @@ public:
 		return tableDescriptor->_headOfSpan;
 	}
 
+	/**
+	 * Get the NUMA node of the table region that contains the address. Unlike regionDescriptorForAddress,
+	 * this does not take the region list lock, so it can be used while the heap is being expanded.
+	 *
+	 * @param heapAddress - the address whose region we are trying to find
+	 * @return the NUMA node of the region, 0 if the address is not covered by the table or the region has no node
+	 */
+	MMINLINE uintptr_t tableNumaNodeForAddress(const void* heapAddress)
+	{
+		uintptr_t numaNode = 0;
+		if ((heapAddress >= _lowTableEdge) && (heapAddress < _highTableEdge)) {
+			numaNode = physicalTableDescriptorForAddress(heapAddress)->getNumaNode();
+		}
+		return numaNode;
+	}
+
 	/**
 	 * Get the logical region descriptor that describes the address. The region may be a table
 	 * region or an auxillar region.  Note that the region described could be part of a spanning 
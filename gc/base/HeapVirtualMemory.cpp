@@ -28,6 +28,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapPretoucher.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -323,9 +324,12 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 	bool resultCommitMemory = memoryManager->commitMemory(&_vmemHandle, address, size);
 
 	if (resultCommitMemory && extensions->pretouchHeapOnExpand) {
-		memset(address, 0, size);
+		MM_HeapPretoucher *pretoucher = extensions->heapPretoucher;
+		if ((NULL == pretoucher) || !pretoucher->heapCommitted(address, size, getHeapRegionManager()->tableNumaNodeForAddress(address))) {
+			memset(address, 0, size);
+		}
 	}
-	
+
 	return resultCommitMemory;
 }
 
@@ -339,6 +343,9 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 {
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	if (NULL != extensions->heapPretoucher) {
+		extensions->heapPretoucher->heapDecommitting(address, size);
+	}
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
@@ -23,6 +23,7 @@
 
 #include "MemoryManager.hpp"
 
+#include "ut_j9mm.h"
 #include "ModronAssertions.h"
 #include "GCExtensionsBase.hpp"
 #include "NonVirtualMemory.hpp"
@@ -404,16 +405,18 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 }
 
 bool
-MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size)
+MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size, MM_GCExtensionsBase::MetadataPagePolicy pagePolicy)
 {
 	Assert_MM_true(NULL != handle);
 	Assert_MM_true(NULL == handle->getVirtualMemory());
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+	bool isDefaultPagePolicy = (MM_GCExtensionsBase::METADATA_PAGE_POLICY_DEFAULT == pagePolicy);
 
 	/*
 	 * Can we take already preallocated memory?
+	 * Memory with a page policy of its own must not share pages with other metadata
 	 */
-	if (NULL != _preAllocated.getVirtualMemory()) {
+	if (isDefaultPagePolicy && (NULL != _preAllocated.getVirtualMemory())) {
 		/* base might be not aligned */
 		void* base = (void*)MM_Math::roundToCeiling(alignment, (uintptr_t)_preAllocated.getMemoryBase());
 		void* top = (void*)((uintptr_t)base + MM_Math::roundToCeiling(alignment, size));
@@ -461,12 +464,34 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
 			Assert_MM_true(0 != pageSize);
 
+			/*
+			 * Huge pages (explicit or transparent) only back the parts of the memory which cover whole, aligned
+			 * huge pages, so align the base to the huge page size and round the structure up to whole huge pages.
+			 * The base is aligned within the reservation, which only needs alignment - 1 bytes of slack for it.
+			 */
+			switch (pagePolicy) {
+			case MM_GCExtensionsBase::METADATA_PAGE_POLICY_HUGE:
+				if (isLargePage(env, extensions->requestedPageSize)) {
+					pageSize = extensions->requestedPageSize;
+					pageFlags = extensions->requestedPageFlags;
+				}
+				alignment = OMR_MAX(alignment, pageSize);
+				allocateSize = MM_Math::roundToCeiling(alignment, size) + (alignment - 1);
+				break;
+			case MM_GCExtensionsBase::METADATA_PAGE_POLICY_TRANSPARENT:
+				alignment = OMR_MAX(alignment, extensions->transparentHugePageSize);
+				allocateSize = MM_Math::roundToCeiling(alignment, size) + (alignment - 1);
+				break;
+			default:
+				break;
+			}
+
 			/*
 			 * Preallocation is enabled for all platforms where metadata can be allocated in virtual memory
 			 * Segmentation is enabled for AIX-64 only, so physical page size is used as a segment size for other platforms
 			 * To get advantage of preallocation this memory should be allocated in large pages
 			 */
-			if (isLargePage(env, pageSize)) {
+			if (isDefaultPagePolicy && isLargePage(env, pageSize)) {
 
 				uintptr_t minimumAllocationUnit = getSegmentSize();
 				if (0 == minimumAllocationUnit) {
@@ -488,6 +513,13 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			 * Create Virtual Memory instance
 			 */
 			instance = MM_VirtualMemory::newInstance(env, alignment, allocateSize, pageSize, pageFlags, tailPadding, preferredAddress, ceiling, mode, options, memoryCategory);
+			if ((NULL == instance) && (pageSize != extensions->gcmetadataPageSize)) {
+				/* huge pages are a preference - fall back to the default metadata pages if none are left */
+				instance = MM_VirtualMemory::newInstance(env, alignment, allocateSize, extensions->gcmetadataPageSize, extensions->gcmetadataPageFlags, tailPadding, preferredAddress, ceiling, mode, options, memoryCategory);
+			}
+			if (NULL != instance) {
+				Trc_MM_MemoryManager_createVirtualMemoryForMetadata_pages(env->getLanguageVMThread(), size, (uintptr_t)pagePolicy, instance->getPageSize(), instance->getHeapBase());
+			}
 		} else {
 			/*
 			 * Allocate memory using malloc (create NonVirtual Memory instance)
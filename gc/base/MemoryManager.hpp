@@ -27,6 +27,7 @@
 #include "modronbase.h"
 
 #include "BaseNonVirtual.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MemoryHandle.hpp"
 #include "VirtualMemory.hpp"
 
@@ -156,9 +157,11 @@ public:
 	 * @param[in/out] handle pointer to memory handle
 	 * @param heapAlignment required heap alignment
 	 * @param size required memory size
+	 * @param pagePolicy pages to back the memory with. Memory with a policy other than the default gets a reservation of its own,
+	 * with its base aligned to the (huge) page size, so the whole structure can be backed with huge pages.
 	 * @return true if pointer to virtual memory is not NULL
 	 */
-	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size);
+	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size, MM_GCExtensionsBase::MetadataPagePolicy pagePolicy = MM_GCExtensionsBase::METADATA_PAGE_POLICY_DEFAULT);
 
 	/**
 	 * Destroy virtual memory instance
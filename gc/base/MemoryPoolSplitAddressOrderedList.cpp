@@ -140,6 +140,61 @@ MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromList(MM_EnvironmentBas
 	
 	return currentFreeEntry;
 }
+
+MMINLINE MM_HeapLinkedFreeHeader*
+MM_MemoryPoolSplitAddressOrderedList::internalAllocateFromSearchCursors(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry)
+{
+	bool const compressed = compressObjectReferences();
+	J9ModronFreeList* freeList = &_heapFreeLists[curFreeList];
+	uintptr_t lookupClass = J9ModronFreeList::sizeClassIndex(sizeInBytesRequired);
+	uintptr_t walkCountCurrentList = 0;
+	uintptr_t largestWalkedSize = 0;
+	uintptr_t startClass = 0;
+
+	*previousFreeEntry = NULL;
+
+	/* Nothing on this list is large enough - no need to walk it */
+	if (freeList->isSizeClassEmpty(lookupClass)) {
+		return NULL;
+	}
+
+	/* Skip the entries known to be too small */
+	MM_HeapLinkedFreeHeader* currentFreeEntry = freeList->_freeList;
+	MM_HeapLinkedFreeHeader* startFreeEntry = freeList->findSearchCursor(lookupClass, &startClass);
+	if (NULL != startFreeEntry) {
+		*previousFreeEntry = startFreeEntry;
+		currentFreeEntry = startFreeEntry->getNext(compressed);
+	}
+
+	while (NULL != currentFreeEntry) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		/* in first pass, we ignore reserved free entry */
+		if ((sizeInBytesRequired <= currentFreeEntrySize) && !isPreviousReservedFreeEntry(*previousFreeEntry, curFreeList)) {
+			break;
+		}
+
+		if (largestWalkedSize < currentFreeEntrySize) {
+			largestWalkedSize = currentFreeEntrySize;
+		}
+
+		walkCountCurrentList += 1;
+
+		*previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext(compressed);
+		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > *previousFreeEntry));
+	}
+
+	/* Remember how far the walk got, or that the list holds nothing large enough */
+	freeList->recordSearch(startClass, largestWalkedSize, *previousFreeEntry, NULL != currentFreeEntry);
+
+	if (largestWalkedSize > *largestFreeEntry) {
+		*largestFreeEntry = largestWalkedSize;
+	}
+
+	_allocSearchCount += walkCountCurrentList;
+
+	return currentFreeEntry;
+}
  
  
 void*
@@ -181,7 +236,11 @@ retry:
 
 			if (skipReserved) {
 				/* first pass will skip reserved free entry */
-				currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
+				if (_extensions->splitFreeListSearchCursors) {
+					currentFreeEntry = internalAllocateFromSearchCursors(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
+				} else {
+					currentFreeEntry = internalAllocateFromList(env, sizeInBytesRequired, curFreeList, &previousFreeEntry, &largestFreeEntry);
+				}
 				if (NULL != currentFreeEntry) {
 					/* found a freeEntry; will release lock only after we handle the remainder */
 					break;
@@ -257,6 +316,7 @@ skipSearch:
 			_previousReservedFreeEntry = recycleEntry;
 		}
 		_heapFreeLists[curFreeList].updateHint(currentFreeEntry, recycleEntry);
+		_heapFreeLists[curFreeList].updateSearchCursors(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStatsForFreeList[curFreeList].incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		if (!skipReserved && isPreviousReservedFreeEntry(previousFreeEntry, curFreeList)) {
@@ -277,6 +337,7 @@ skipSearch:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		_heapFreeLists[curFreeList].removeHint(currentFreeEntry);
+		_heapFreeLists[curFreeList].removeFromSearchCursors(currentFreeEntry);
 	}
 
 	/* Was our initial or suggested freelist empty? If not, go back and use it more. */
@@ -449,6 +510,7 @@ skipSearch:
 		}
 		_allocDiscardedBytes += recycleEntrySize;
 		_heapFreeLists[curFreeList].removeHint(freeEntry);
+		_heapFreeLists[curFreeList].removeFromSearchCursors(freeEntry);
 	} else {
 		if (!skipReserved && isPreviousReservedFreeEntry(previousFreeEntry, curFreeList)) {
 			_reservedFreeEntrySize = recycleEntrySize;
@@ -457,6 +519,7 @@ skipSearch:
 			_previousReservedFreeEntry = (MM_HeapLinkedFreeHeader*) addrTop;
 		}
 		_heapFreeLists[curFreeList].updateHint(freeEntry, (MM_HeapLinkedFreeHeader*)addrTop);
+		_heapFreeLists[curFreeList].updateSearchCursors(freeEntry, (MM_HeapLinkedFreeHeader*)addrTop);
 		_largeObjectAllocateStatsForFreeList[curFreeList].incrementFreeEntrySizeClassStats(recycleEntrySize);
 	}
 
@@ -485,6 +548,10 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t lastFreeListIndex = _heapFreeListCount - 1;
+
+	/* The lists were rebuilt */
+	clearSearchCursors();
+
 	if (cause == forCompact && (lastFreeListIndex != 0)) {
 		/* Move all the compact items to the beginning of the lists */
 		_heapFreeLists[0]._freeList = _heapFreeLists[lastFreeListIndex]._freeList;
@@ -676,6 +743,9 @@ MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, u
 		return;
 	}
 
+	/* The range is added as a new entry or coalesced with an existing one */
+	clearSearchCursors();
+
 	MM_HeapLinkedFreeHeader** head = NULL;
 	uintptr_t curFreeListIndex = 0;
 	for (curFreeListIndex = 0; curFreeListIndex < _heapFreeListCount; ++curFreeListIndex) {
@@ -821,6 +891,9 @@ MM_MemoryPoolSplitAddressOrderedList::contractWithRange(MM_EnvironmentBase* env,
 		return NULL;
 	}
 
+	/* The entry holding the range is split or removed */
+	clearSearchCursors();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	uintptr_t freeListIndex;
@@ -941,6 +1014,8 @@ MM_MemoryPoolSplitAddressOrderedList::addFreeEntries(MM_EnvironmentBase* env,
 	bool const compressed = compressObjectReferences();
 	uintptr_t localFreeListMemoryCount = freeListMemoryCount;
 
+	clearSearchCursors();
+
 	MM_HeapLinkedFreeHeader* freeEntryToAdd = freeListHead;
 	while (freeEntryToAdd != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(freeEntryToAdd->getSize());
@@ -1078,6 +1153,9 @@ MM_MemoryPoolSplitAddressOrderedList::removeFreeEntriesWithinRange(MM_Environmen
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Entries within the range are removed without going through the search cursors */
+	clearSearchCursors();
+
 	/* Find the first free entry, if any, within specified range */
 	uintptr_t currentFreeListIndex;
 	previousFreeEntry = NULL;
@@ -71,6 +71,12 @@ private:
 	 */
 	MM_HeapLinkedFreeHeader* internalAllocateFromList(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry);
 
+	/**
+	 *  Search the free entry from the free list, using the search cursors of the list (only for first pass iterating)
+	 *  @see internalAllocateFromList()
+	 */
+	MM_HeapLinkedFreeHeader* internalAllocateFromSearchCursors(MM_EnvironmentBase* env, uintptr_t sizeInBytesRequired, uintptr_t curFreeList, MM_HeapLinkedFreeHeader** previousFreeEntry, uintptr_t* largestFreeEntry);
+
 	/* helpers for maintaining reserved free entry - start */
 	/**
 	 * check if previousFreeEntry is the same as previousReservedFreeEntry
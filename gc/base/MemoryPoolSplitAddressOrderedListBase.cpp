@@ -113,6 +113,7 @@ void J9ModronFreeList::reset()
 	_freeCount = 0;
 	_timesLocked = 0;
 	clearHints();
+	clearSearchCursors();
 }
 
 bool
@@ -455,6 +456,7 @@ MM_MemoryPoolSplitAddressOrderedListBase::findAddressAfterFreeSize(MM_Environmen
 	uintptr_t remainingBytesNeeded = sizeRequired;
 	uintptr_t currentFreeListIndex;
 	MM_HeapLinkedFreeHeader* currentFreeEntry = (MM_HeapLinkedFreeHeader*)getFirstFreeStartingAddr(env, &currentFreeListIndex);
+	currentFreeEntry = skipFreeEntriesSmallerThan(env, currentFreeEntry, minimumSize, &currentFreeListIndex);
 
 	/* Count full free entries until an entry needs to be split. */
 	while (NULL != currentFreeEntry) {
@@ -485,11 +487,53 @@ MM_MemoryPoolSplitAddressOrderedListBase::findAddressAfterFreeSize(MM_Environmen
 		}
 
 		currentFreeEntry = (MM_HeapLinkedFreeHeader*)getNextFreeStartingAddr(env, currentFreeEntry, &currentFreeListIndex);
+		currentFreeEntry = skipFreeEntriesSmallerThan(env, currentFreeEntry, minimumSize, &currentFreeListIndex);
 	}
 
 	return NULL;
 }
 
+/**
+ * When freeEntry is the head of a free list, use the search cursors of the list to skip the leading entries (or the
+ * whole list) known to be smaller than size.
+ *
+ * @param freeEntry a free entry, or NULL
+ * @param[in/out] freeListIndex the index of the free list holding freeEntry
+ * @return the first entry at or after freeEntry which is not known to be smaller than size, or NULL
+ */
+MM_HeapLinkedFreeHeader*
+MM_MemoryPoolSplitAddressOrderedListBase::skipFreeEntriesSmallerThan(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t size, uintptr_t* freeListIndex)
+{
+	if (0 == size) {
+		return freeEntry;
+	}
+
+	uintptr_t sizeClass = J9ModronFreeList::sizeClassIndex(size);
+	while ((NULL != freeEntry) && (*freeListIndex < _heapFreeListCount) && (freeEntry == _heapFreeLists[*freeListIndex]._freeList)) {
+		J9ModronFreeList* freeList = &_heapFreeLists[*freeListIndex];
+		if (freeList->isSizeClassEmpty(sizeClass)) {
+			/* every entry of this list is too small - move on to the next non-empty list */
+			freeEntry = NULL;
+			for (uintptr_t i = *freeListIndex + 1; i < _heapFreeListCount; ++i) {
+				if (NULL != _heapFreeLists[i]._freeList) {
+					*freeListIndex = i;
+					freeEntry = _heapFreeLists[i]._freeList;
+					break;
+				}
+			}
+		} else {
+			uintptr_t startClass = 0;
+			MM_HeapLinkedFreeHeader* startFreeEntry = freeList->findSearchCursor(sizeClass, &startClass);
+			if (NULL == startFreeEntry) {
+				break;
+			}
+			freeEntry = (MM_HeapLinkedFreeHeader*)getNextFreeStartingAddr(env, startFreeEntry, freeListIndex);
+		}
+	}
+
+	return freeEntry;
+}
+
 bool
 MM_MemoryPoolSplitAddressOrderedListBase::recycleHeapChunk(MM_EnvironmentBase* env, void* addrBase, void* addrTop,
 													   MM_HeapLinkedFreeHeader* previousFreeEntry, MM_HeapLinkedFreeHeader* nextFreeEntry, uintptr_t curFreeList)
@@ -722,6 +766,10 @@ void
 MM_MemoryPoolSplitAddressOrderedListBase::moveHeap(MM_EnvironmentBase* env, void* srcBase, void* srcTop, void* dstBase)
 {
 	bool const compressed = compressObjectReferences();
+
+	/* Entries move, so the search cursors are stale */
+	clearSearchCursors();
+
 	for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
 		MM_HeapLinkedFreeHeader* currentFreeEntry, *previousFreeEntry;
 
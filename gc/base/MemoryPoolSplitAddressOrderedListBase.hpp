@@ -32,6 +32,7 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "Bits.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -54,12 +55,144 @@ public:
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
 
+	/* Search cursor support.
+	 * The list is not split into bins, as the sweep, coalescing and the reserved free entry rely on its address order:
+	 * entries stay on the single address ordered list, and each power of two size class only remembers where a first
+	 * fit search may start. Size class c stands for the entries of at least 2^c
+	 * bytes. A size class either has a cursor, an entry such that no entry up to and including it is 2^c bytes or
+	 * larger (so a search for an entry of at least 2^c bytes can start right after it, and it is the predecessor of
+	 * the entry found), or is known to be empty. Both only become wrong when entries are added or grow, which clears
+	 * the cursors. The reserved free entry counts like any other.
+	 */
+	MM_HeapLinkedFreeHeader* _searchCursor[J9BITS_BITS_IN_SLOT]; /**< Cursor of each size class which has one */
+	uintptr_t _searchCursorMap; /**< Bit c set if size class c has a cursor */
+	uintptr_t _searchEmptyMap; /**< Bit c set if no entry of at least 2^c bytes is on the list */
+
 	bool initialize(MM_EnvironmentBase* env);
 	void tearDown();
 
 	void clearHints();
 	void reset();
 
+	/**
+	 * @return the index of the highest bit set in value, which must not be 0
+	 */
+	MMINLINE static uintptr_t highestBitIndex(uintptr_t value)
+	{
+		uintptr_t index = 0;
+		for (uintptr_t shift = J9BITS_BITS_IN_SLOT / 2; 0 != shift; shift /= 2) {
+			if (0 != (value >> shift)) {
+				value >>= shift;
+				index += shift;
+			}
+		}
+		return index;
+	}
+
+	/**
+	 * @return the largest size class which holds every entry of at least size bytes
+	 */
+	MMINLINE static uintptr_t sizeClassIndex(uintptr_t size)
+	{
+		return highestBitIndex(size);
+	}
+
+	/**
+	 * @return a mask of the size classes up to and including sizeClass
+	 */
+	MMINLINE static uintptr_t sizeClassMaskUpTo(uintptr_t sizeClass)
+	{
+		return ((((uintptr_t)1 << sizeClass) - 1) << 1) | 1;
+	}
+
+	MMINLINE void clearSearchCursors()
+	{
+		_searchCursorMap = 0;
+		_searchEmptyMap = 0;
+	}
+
+	/**
+	 * @return true if the list is known to hold no entry of at least 2^sizeClass bytes
+	 */
+	MMINLINE bool isSizeClassEmpty(uintptr_t sizeClass)
+	{
+		return 0 != (_searchEmptyMap & sizeClassMaskUpTo(sizeClass));
+	}
+
+	/**
+	 * Find the entry to start a search for an entry of at least 2^sizeClass bytes after.
+	 * @param[out] startClass the size class the cursor was recorded for
+	 * @return the start entry, or NULL if the search has to start at the head of the list
+	 */
+	MMINLINE MM_HeapLinkedFreeHeader* findSearchCursor(uintptr_t sizeClass, uintptr_t* startClass)
+	{
+		uintptr_t indexed = _searchCursorMap & sizeClassMaskUpTo(sizeClass);
+		if (0 == indexed) {
+			*startClass = 0;
+			return NULL;
+		}
+		*startClass = highestBitIndex(indexed);
+		return _searchCursor[*startClass];
+	}
+
+	/**
+	 * Record the result of a search which started in startClass and walked entries no larger than largestWalked.
+	 * @param lastWalked the last entry too small for the search, NULL if none was walked
+	 * @param found true if the search found an entry, false if it reached the end of the list
+	 */
+	MMINLINE void recordSearch(uintptr_t startClass, uintptr_t largestWalked, MM_HeapLinkedFreeHeader* lastWalked, bool found)
+	{
+		uintptr_t firstClass = startClass;
+		if (0 != largestWalked) {
+			firstClass = OMR_MAX(firstClass, highestBitIndex(largestWalked) + 1);
+		}
+		if (firstClass >= J9BITS_BITS_IN_SLOT) {
+			return;
+		}
+		uintptr_t classes = ~(uintptr_t)0 << firstClass;
+		if (!found) {
+			_searchEmptyMap |= classes;
+		} else if (NULL != lastWalked) {
+			for (uintptr_t sizeClass = firstClass; sizeClass < J9BITS_BITS_IN_SLOT; sizeClass++) {
+				/* the cursor of a size class only moves towards higher addresses */
+				if ((0 == (_searchCursorMap & ((uintptr_t)1 << sizeClass))) || (_searchCursor[sizeClass] < lastWalked)) {
+					_searchCursor[sizeClass] = lastWalked;
+				}
+			}
+			_searchCursorMap |= classes;
+		}
+	}
+
+	/**
+	 * An entry was replaced by a smaller entry at a higher address (the remainder of an allocation from it).
+	 */
+	MMINLINE void updateSearchCursors(MM_HeapLinkedFreeHeader* oldFreeEntry, MM_HeapLinkedFreeHeader* newFreeEntry)
+	{
+		uintptr_t indexed = _searchCursorMap;
+		while (0 != indexed) {
+			uintptr_t sizeClass = highestBitIndex(indexed);
+			if (_searchCursor[sizeClass] == oldFreeEntry) {
+				_searchCursor[sizeClass] = newFreeEntry;
+			}
+			indexed &= ~((uintptr_t)1 << sizeClass);
+		}
+	}
+
+	/**
+	 * An entry was removed from the list, so the size classes with their cursor on it lose the cursor.
+	 */
+	MMINLINE void removeFromSearchCursors(MM_HeapLinkedFreeHeader* freeEntry)
+	{
+		uintptr_t indexed = _searchCursorMap;
+		while (0 != indexed) {
+			uintptr_t sizeClass = highestBitIndex(indexed);
+			if (_searchCursor[sizeClass] == freeEntry) {
+				_searchCursorMap &= ~((uintptr_t)1 << sizeClass);
+			}
+			indexed &= ~((uintptr_t)1 << sizeClass);
+		}
+	}
+
 	MMINLINE void addHint(MM_HeapLinkedFreeHeader* freeEntry, uintptr_t lookupSize)
 	{
 		/* Travel the list removing any hints that this new hint will override */
@@ -245,6 +378,8 @@ public:
 		, _hintActive(NULL)
 		, _hintInactive(NULL)
 		, _hintLru(0)
+		, _searchCursorMap(0)
+		, _searchEmptyMap(0)
 	{
 	}
 };
@@ -309,6 +444,18 @@ protected:
 		}
 	}
 
+	/**
+	 * Forget what the search cursors of all free lists know, before entries are added to the lists or grow.
+	 */
+	MMINLINE void clearSearchCursors()
+	{
+		for (uintptr_t i = 0; i < _heapFreeListCountExtended; ++i) {
+			_heapFreeLists[i].clearSearchCursors();
+		}
+	}
+
+	MM_HeapLinkedFreeHeader* skipFreeEntriesSmallerThan(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t size, uintptr_t* freeListIndex);
+
 	bool printFreeListValidity(MM_EnvironmentBase* env);
 public:
 	virtual void* allocateObject(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
@@ -77,6 +77,7 @@ public:
 		, indexableObject = 4			/* this is set for array object scanners where the array elements can be partitioned for multithreaded scanning */
 		, indexableObjectNoSplit = 8	/* this is set for array object scanners where the array elements cannot be partitioned for multithreaded scanning */
 		, headObjectScanner = 16		/* this is set for array object scanners containing the elements from the first split segment, and for all non-indexable objects */
+		, copyAhead = 32				/* scavenge heap phase, hierarchicalDepthCopy -- enumerate the children of a just copied object to copy them ahead of its scan; must have no side effects (eg, reference discovery) and should skip weak referents */
 		, noMoreSlots = 128				/* this is set when object has more no slots to scan past current bitmap */
 	};
 
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_Packet;
+
+/**
+ * Bounded Chase-Lev work stealing deque of packets.
+ * The owning thread pushes and pops at the bottom without any atomic read-modify-write
+ * (except when racing a thief for the last entry), while other threads steal from the top
+ * with a single compare and swap.  The deque does not grow; push fails when it is full and
+ * the caller is expected to fall back to the shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_PacketDeque : public MM_BaseNonVirtual
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_Packet * volatile *_entries; /**< Circular array of _capacity entries */
+	uintptr_t _capacity; /**< Number of entries in _entries, always a power of two */
+	uintptr_t _mask; /**< _capacity - 1 */
+	volatile uintptr_t _top; /**< Index of the next entry to be stolen (only ever increases) */
+	volatile uintptr_t _bottom; /**< Index of the next free slot for the owner (modified by the owner only) */
+	uintptr_t _randomSeed; /**< Owner private state used to select steal victims */
+
+/* Methods */
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity, uintptr_t seed);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a packet on the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet the packet to push
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+		if ((bottom - top) >= _capacity) {
+			return false;
+		}
+		_entries[bottom & _mask] = packet;
+		/* The entry must be visible before the new bottom is */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop a packet from the bottom of the deque. Must only be called by the owning thread.
+	 * @return a packet, or NULL if the deque is empty (or the last packet was lost to a thief)
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* Publishing the new bottom must be ordered with the read of top, otherwise the owner and a thief may both take the last entry */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) >= 0) {
+			packet = _entries[bottom & _mask];
+			if (bottom == top) {
+				/* Last entry - race any thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			_bottom = bottom + 1;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal a packet from the top of the deque. May be called by any thread.
+	 * @return a packet, or NULL if the deque was empty or the steal lost a race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			packet = _entries[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+		}
+		return packet;
+	}
+
+	/**
+	 * @return true if the deque appeared to hold at least one packet when checked
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return (intptr_t)(_bottom - _top) <= 0;
+	}
+
+	/**
+	 * Pick the next pseudo-random number from the owner private sequence (xorshift).
+	 * Must only be called by the owning thread.
+	 */
+	MMINLINE uintptr_t
+	nextRandom()
+	{
+		uintptr_t x = _randomSeed;
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		_randomSeed = x;
+		return x;
+	}
+
+	MM_PacketDeque()
+		: MM_BaseNonVirtual()
+		, _entries(NULL)
+		, _capacity(0)
+		, _mask(0)
+		, _top(0)
+		, _bottom(0)
+		, _randomSeed(1)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+private:
+};
+
+#endif /* PACKETDEQUE_HPP_ */
@@ -31,12 +31,14 @@
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include "AdaptiveTaskThreading.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "Task.hpp"
+#include "TreeBarrier.hpp"
 
 #include "ParallelDispatcher.hpp"
 
@@ -236,6 +238,14 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		omrthread_monitor_destroy(_synchronizeMutex);
 		_synchronizeMutex = NULL;
 	}
+	if(_synchronizeBarrier) {
+		_synchronizeBarrier->kill(env);
+		_synchronizeBarrier = NULL;
+	}
+	if(_adaptiveTaskThreading) {
+		_adaptiveTaskThreading->kill(env);
+		_adaptiveTaskThreading = NULL;
+	}
 
 	if(_taskTable) {
 		forge->free(_taskTable);
@@ -286,6 +296,20 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if (env->getExtensions()->gcSyncTreeBarrier) {
+		_synchronizeBarrier = MM_TreeBarrier::newInstance(env, _threadCountMaximum);
+		if(!_synchronizeBarrier) {
+			goto error_no_memory;
+		}
+	}
+
+	if (env->getExtensions()->adaptiveTaskThreading) {
+		_adaptiveTaskThreading = MM_AdaptiveTaskThreading::newInstance(env);
+		if(!_adaptiveTaskThreading) {
+			goto error_no_memory;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -475,6 +499,12 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 		Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_useCollectorRecommendedThreads(task->getRecommendedWorkingThreads(), taskActiveThreadCount);
 	}
 
+	/* Adaptive task threading picks a count up to the one computed above, only for tasks whose thread count was not set by the caller */
+	if ((NULL != _adaptiveTaskThreading) && (UDATA_MAX == threadCount)) {
+		taskActiveThreadCount = _adaptiveTaskThreading->getRecommendedThreadCount(env, task, taskActiveThreadCount);
+		_activeThreadCount = taskActiveThreadCount;
+	}
+
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -510,6 +540,21 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 	return toReturn;
 }
 
+void
+MM_ParallelDispatcher::clearTaskStats(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->syncPointStatsEnabled) {
+		extensions->syncPointStats.clear();
+	}
+	if (NULL != _synchronizeBarrier) {
+		_synchronizeBarrier->clearStats();
+	}
+	if (NULL != _adaptiveTaskThreading) {
+		_adaptiveTaskThreading->clearReportedRuns();
+	}
+}
+
 void
 MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
 {
@@ -524,6 +569,10 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_task = task;
 
 	task->setSynchronizeMutex(_synchronizeMutex);
+	if (NULL != _synchronizeBarrier) {
+		_synchronizeBarrier->reset(env, threadCount);
+		task->setSynchronizeBarrier(_synchronizeBarrier);
+	}
 
 	/* Main thread will be used - update status */
 	_statusTable[env->getWorkerID()] = worker_status_reserved;
@@ -581,13 +630,18 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 void
 MM_ParallelDispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCount)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 	uintptr_t activeThreads = recomputeActiveThreadCountForTask(env, task, newThreadCount);
 	task->mainSetup(env);
+	uint64_t startTime = omrtime_hires_clock();
 	prepareThreadsForTask(env, task, activeThreads);
 	acceptTask(env);
 	task->run(env);
 	completeTask(env);
 	cleanupAfterTask(env);
+	if (NULL != _adaptiveTaskThreading) {
+		_adaptiveTaskThreading->taskCompleted(env, task, activeThreads, omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
 	task->mainCleanup(env);
 }
 
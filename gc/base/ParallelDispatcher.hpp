@@ -39,6 +39,8 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_AdaptiveTaskThreading;
+class MM_TreeBarrier;
 
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
@@ -70,6 +72,8 @@ protected:
 	/* Task as they are dispatched.  For now, since there is only one task active at any time, a */
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_synchronizeBarrier; /**< Barrier handed to tasks instead of the synchronize mutex, NULL unless gcSyncTreeBarrier is enabled */
+	MM_AdaptiveTaskThreading *_adaptiveTaskThreading; /**< Per task thread count policy, NULL unless adaptiveTaskThreading is enabled */
 	
 	bool _workerThreadsReservedForGC;  /**< States whether or not the worker threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
@@ -126,6 +130,14 @@ public:
 	MMINLINE virtual uintptr_t threadCountMaximum() { return _threadCountMaximum; }
 	MMINLINE omrthread_t* getThreadTable() { return _threadTable; }
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
+	MMINLINE MM_AdaptiveTaskThreading *getAdaptiveTaskThreading() { return _adaptiveTaskThreading; }
+	MMINLINE MM_TreeBarrier *getSynchronizeBarrier() { return _synchronizeBarrier; }
+
+	/**
+	 * Reset the statistics of tasks (sync point waits, barrier episodes and adaptive thread counts), so that they
+	 * cover the GC increment about to start. Called by collectors before they report the increment start.
+	 */
+	void clearTaskStats(MM_EnvironmentBase *env);
 	virtual void setThreadCount(uintptr_t threadCount);
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
@@ -149,6 +161,8 @@ public:
 		,_workerThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
+		,_adaptiveTaskThreading(NULL)
 		,_workerThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
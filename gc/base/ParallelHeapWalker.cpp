@@ -24,6 +24,8 @@
 
 #include "ModronAssertions.h"
 
+#include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ParallelTask.hpp"
 #include "ParallelDispatcher.hpp"
@@ -33,8 +35,10 @@
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
+#include "Math.hpp"
 #include "MemorySubSpace.hpp"
 #include "ParallelGlobalGC.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
@@ -91,11 +95,227 @@ MM_ParallelHeapWalker::newInstance(MM_ParallelGlobalGC *globalCollector, MM_Mark
 	heapWalker = (MM_ParallelHeapWalker *)env->getForge()->allocate(sizeof(MM_ParallelHeapWalker), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (heapWalker) {
 		new(heapWalker) MM_ParallelHeapWalker(globalCollector, markMap);
+		if (!heapWalker->initialize(env)) {
+			heapWalker->kill(env);
+			heapWalker = NULL;
+		}
 	}
 
 	return heapWalker;
 }
 
+bool
+MM_ParallelHeapWalker::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_HeapWalker::initialize(env)) {
+		return false;
+	}
+
+	/* the dispatcher does not exist yet, but it never runs more threads than gcThreadCount */
+	_rangeCount = env->getExtensions()->gcThreadCount;
+	_sections = (WalkSection *)env->getForge()->allocate(sizeof(WalkSection) * (PARALLEL_WALK_SECTIONS_MAX + 1), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_ranges = (volatile uint64_t *)env->getForge()->allocate(sizeof(uint64_t) * _rangeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	return (NULL != _sections) && (NULL != _ranges);
+}
+
+void
+MM_ParallelHeapWalker::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sections) {
+		env->getForge()->free(_sections);
+		_sections = NULL;
+	}
+	if (NULL != _ranges) {
+		env->getForge()->free((void *)_ranges);
+		_ranges = NULL;
+	}
+}
+
+void
+MM_ParallelHeapWalker::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	MM_HeapWalker::kill(env);
+}
+
+bool
+MM_ParallelHeapWalker::buildSections(MM_EnvironmentBase *env, uintptr_t walkFlags)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	/* sections are a whole number of mark map slots, so no slot is counted by two sections of a region */
+	uintptr_t sectionSize = extensions->heap->getMemorySize() / (PARALLEL_WALK_SECTIONS_MAX / 2);
+	sectionSize = MM_Math::roundToCeiling(J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT, OMR_MAX(sectionSize, (uintptr_t)PARALLEL_WALK_SECTION_SIZE_MINIMUM));
+
+	uintptr_t sectionCount = 0;
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptor *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+			uintptr_t *base = (uintptr_t *)region->getLowAddress();
+			uintptr_t *high = (uintptr_t *)region->getHighAddress();
+			while (base < high) {
+				if (PARALLEL_WALK_SECTIONS_MAX == sectionCount) {
+					_sectionCount = 0;
+					return false;
+				}
+				uintptr_t *top = (uintptr_t *)OMR_MIN((uintptr_t)high, (uintptr_t)base + sectionSize);
+				WalkSection *section = &_sections[sectionCount];
+				section->region = region;
+				section->base = base;
+				section->top = top;
+				section->workBefore = 0;
+				sectionCount += 1;
+				base = top;
+			}
+		}
+	}
+	_sectionCount = sectionCount;
+	return true;
+}
+
+void
+MM_ParallelHeapWalker::estimateSectionWork(MM_EnvironmentBase *env)
+{
+	uintptr_t *markBits = _markMap->getHeapMapBits();
+	for (uintptr_t index = 0; index < _sectionCount; index++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			WalkSection *section = &_sections[index];
+			/* one bit is marked per live object; every section also costs something to claim and scan */
+			uintptr_t work = 1;
+			uintptr_t slotIndex = _markMap->getSlotIndex((omrobjectptr_t)section->base);
+			uintptr_t slotTop = _markMap->getSlotIndex((omrobjectptr_t)(section->top - 1)) + 1;
+			for (; slotIndex < slotTop; slotIndex++) {
+				work += MM_Bits::populationCount(markBits[slotIndex]);
+			}
+			section->workBefore = work;
+		}
+	}
+}
+
+void
+MM_ParallelHeapWalker::carveRanges(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	uintptr_t totalWork = 0;
+	for (uintptr_t index = 0; index < _sectionCount; index++) {
+		uintptr_t work = _sections[index].workBefore;
+		_sections[index].workBefore = totalWork;
+		totalWork += work;
+	}
+	_sections[_sectionCount].workBefore = totalWork;
+
+	/* range i starts at the first section whose work before it reaches i / threadCount of the total */
+	uintptr_t next = 0;
+	for (uintptr_t rangeIndex = 0; rangeIndex < threadCount; rangeIndex++) {
+		uintptr_t top = _sectionCount;
+		if (rangeIndex + 1 < threadCount) {
+			uintptr_t workTarget = (uintptr_t)(((uint64_t)totalWork * (rangeIndex + 1)) / threadCount);
+			top = next;
+			while ((top < _sectionCount) && (_sections[top].workBefore < workTarget)) {
+				top += 1;
+			}
+		}
+		_ranges[rangeIndex] = makeRange(next, top);
+		next = top;
+	}
+	_activeRangeCount = threadCount;
+	_rangesClaimed = 0;
+	_sectionsStolen = 0;
+	MM_AtomicOperations::storeSync();
+}
+
+uintptr_t
+MM_ParallelHeapWalker::claimSection(MM_EnvironmentBase *env, uintptr_t rangeIndex, bool *stolen)
+{
+	volatile uint64_t *ownRange = &_ranges[rangeIndex];
+
+	while (true) {
+		/* sections are only taken from the front of a range by its owner */
+		uint64_t range = MM_AtomicOperations::getU64(ownRange);
+		uintptr_t next = rangeNext(range);
+		uintptr_t top = rangeTop(range);
+		if (next < top) {
+			if (range == MM_AtomicOperations::lockCompareExchangeU64(ownRange, range, makeRange(next + 1, top))) {
+				*stolen = false;
+				return next;
+			}
+			continue;
+		}
+
+		/* the range is empty: find the one with the most work left */
+		uintptr_t victimIndex = _rangeCount;
+		uint64_t victimRange = 0;
+		uintptr_t victimWork = 0;
+		for (uintptr_t index = 0; index < _activeRangeCount; index++) {
+			uint64_t candidate = MM_AtomicOperations::getU64(&_ranges[index]);
+			uintptr_t candidateNext = rangeNext(candidate);
+			uintptr_t candidateTop = rangeTop(candidate);
+			if (candidateNext < candidateTop) {
+				uintptr_t work = _sections[candidateTop].workBefore - _sections[candidateNext].workBefore;
+				if (work > victimWork) {
+					victimIndex = index;
+					victimRange = candidate;
+					victimWork = work;
+				}
+			}
+		}
+		if (_rangeCount == victimIndex) {
+			return _sectionCount;
+		}
+
+		/* steal the back half of the victim's work, or its only section */
+		uintptr_t victimNext = rangeNext(victimRange);
+		uintptr_t victimTop = rangeTop(victimRange);
+		uintptr_t split = victimNext;
+		if ((victimTop - victimNext) > 1) {
+			uintptr_t workTarget = _sections[victimNext].workBefore + (victimWork / 2);
+			split = victimNext + 1;
+			while ((split < (victimTop - 1)) && (_sections[split].workBefore < workTarget)) {
+				split += 1;
+			}
+		}
+		if (victimRange == MM_AtomicOperations::lockCompareExchangeU64(&_ranges[victimIndex], victimRange, makeRange(victimNext, split))) {
+			/* nobody else updates an empty range, the remaining stolen sections can be published with a plain store */
+			MM_AtomicOperations::setU64(ownRange, makeRange(split + 1, victimTop));
+			*stolen = true;
+			return split;
+		}
+	}
+}
+
+uintptr_t
+MM_ParallelHeapWalker::walkSection(MM_EnvironmentBase *env, WalkSection *section, MM_HeapWalkerObjectFunc function, void *userData)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t objectsWalked = 0;
+
+	/* As for chunks, the walk of a section starts at its first marked object and runs past its top up to the
+	 * first marked object of a later section, so the dead objects in between are walked with the section.
+	 * The first section of a region starts at the region base, so the dead objects at the start of the
+	 * region are walked too.
+	 */
+	omrobjectptr_t firstObject = NULL;
+	if (section->base == (uintptr_t *)section->region->getLowAddress()) {
+		firstObject = (omrobjectptr_t)section->base;
+	} else {
+		MM_HeapMapIterator markedObjectIterator(extensions, _markMap, section->base, section->top);
+		firstObject = markedObjectIterator.nextObject();
+	}
+	if (NULL != firstObject) {
+		GC_ObjectHeapBufferedIterator objectHeapIterator(extensions, section->region, false, 1);
+		objectHeapIterator.reset((uintptr_t *)firstObject, (uintptr_t *)section->region->getHighAddress());
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+		omrobjectptr_t object = NULL;
+		while (NULL != (object = objectHeapIterator.nextObject())) {
+			if (((uintptr_t *)object >= section->top) && _markMap->isBitSet(object)) {
+				break;
+			}
+			function(omrVMThread, section->region, object, userData);
+			objectsWalked += 1;
+		}
+	}
+	return objectsWalked;
+}
+
 /**
  * Walk through all live objects of the heap in parallel and apply the provided function.
  */
@@ -119,17 +339,52 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 	MM_Heap *heap = extensions->heap;
 	MM_HeapRegionManager *regionManager = heap->getHeapRegionManager();
 	regionManager->lock();
-	GC_HeapRegionIterator regionIterator(regionManager);
-	MM_HeapRegionDescriptor *region = NULL;
-	OMR_VMThread *omrVMThread = env->getOmrVMThread();
 
-	while (NULL != (region = regionIterator.nextRegion())) {
-		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
-			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
-			omrobjectptr_t object = NULL;
-			while ((object = objectHeapIterator.nextObject()) != NULL) {
-				function(omrVMThread, region, object, userData);
-				objectsWalked += 1;
+	bool walkBySections = false;
+	if ((threadCount > 1) && (threadCount <= _rangeCount) && _markMap->isMarkMapValid()) {
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			buildSections(env, walkFlags);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+		walkBySections = (0 != _sectionCount);
+	}
+
+	if (walkBySections) {
+		estimateSectionWork(env);
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			carveRanges(env, threadCount);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+
+		uintptr_t rangeIndex = MM_AtomicOperations::add(&_rangesClaimed, 1) - 1;
+		uintptr_t sectionsWalked = 0;
+		uintptr_t sectionsStolen = 0;
+		bool stolen = false;
+		uintptr_t sectionIndex = 0;
+		while (_sectionCount != (sectionIndex = claimSection(env, rangeIndex, &stolen))) {
+			objectsWalked += walkSection(env, &_sections[sectionIndex], function, userData);
+			sectionsWalked += 1;
+			if (stolen) {
+				sectionsStolen += 1;
+			}
+		}
+		if (0 != sectionsStolen) {
+			MM_AtomicOperations::add(&_sectionsStolen, sectionsStolen);
+		}
+		Trc_MM_ParallelHeapWalker_allObjectsDoParallel_sections(env->getLanguageVMThread(), _sectionCount, sectionsWalked, sectionsStolen);
+	} else {
+		GC_HeapRegionIterator regionIterator(regionManager);
+		MM_HeapRegionDescriptor *region = NULL;
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (walkFlags == (region->getTypeFlags() & walkFlags)) {
+				GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
+				omrobjectptr_t object = NULL;
+				while ((object = objectHeapIterator.nextObject()) != NULL) {
+					function(omrVMThread, region, object, userData);
+					objectsWalked += 1;
+				}
 			}
 		}
 	}
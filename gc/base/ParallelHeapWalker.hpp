@@ -25,21 +25,49 @@
 
 #include "omr.h"
 #include "omrcfg.h"
+#include "modronbase.h"
 
 #include "HeapWalker.hpp"
 
 class MM_EnvironmentBase;
+class MM_HeapRegionDescriptor;
 class MM_ParallelGlobalGC;
 class MM_MarkMap;
 
+/**
+ * When the mark map is valid, a parallel walk splits the walked regions into sections and estimates the work of
+ * each section from the number of objects marked in it. Every thread is handed a range of consecutive sections
+ * of about the same estimated work, and a thread which runs out of sections steals the back half of the range
+ * with the most work left. Ranges are single 64 bit words updated with compare and swap, so sections are
+ * claimed without a lock.
+ */
 class MM_ParallelHeapWalker : public MM_HeapWalker
 {
 	/*
 	 * Data members
 	 */
 private:
+	struct WalkSection {
+		MM_HeapRegionDescriptor *region; /**< Region the section lies in */
+		uintptr_t *base; /**< First byte of the section */
+		uintptr_t *top; /**< First byte after the section */
+		uintptr_t workBefore; /**< Estimated work of the section, then the work of all sections before it once the ranges are carved */
+	};
+
+	enum {
+		PARALLEL_WALK_SECTIONS_MAX = 4096, /**< Walks needing more sections fall back to chunks shared through work units */
+		PARALLEL_WALK_SECTION_SIZE_MINIMUM = 256 * 1024,
+	};
+
 	MM_MarkMap *_markMap;
 	MM_ParallelGlobalGC *_globalCollector;
+	WalkSection *_sections; /**< Sections of the current walk, followed by a sentinel holding the total work */
+	uintptr_t _sectionCount; /**< Number of sections of the current walk, 0 if the walk uses chunks */
+	volatile uint64_t *_ranges; /**< Per thread ranges: index of the next section in the low half, index after the last section in the high half */
+	uintptr_t _rangeCount; /**< Number of entries in _ranges, the most threads which can walk by sections */
+	uintptr_t _activeRangeCount; /**< Number of ranges carved for the current walk, one per thread */
+	volatile uintptr_t _rangesClaimed; /**< Number of ranges claimed by the threads of the current walk */
+	volatile uintptr_t _sectionsStolen; /**< Number of sections stolen by the threads of the current walk */
 protected:
 public:
 	
@@ -47,8 +75,48 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Split the regions walked into sections. Called by a single thread.
+	 * @return false if the regions need more than PARALLEL_WALK_SECTIONS_MAX sections
+	 */
+	bool buildSections(MM_EnvironmentBase *env, uintptr_t walkFlags);
+
+	/**
+	 * Estimate the work of the sections, in parallel.
+	 */
+	void estimateSectionWork(MM_EnvironmentBase *env);
+
+	/**
+	 * Turn the section work into prefix sums, and hand every thread a range of about the same work.
+	 * Called by a single thread.
+	 */
+	void carveRanges(MM_EnvironmentBase *env, uintptr_t threadCount);
+
+	/**
+	 * Claim a section from the range of the calling thread, stealing from the range with the most
+	 * work left when it is empty.
+	 * @param[out] stolen set to true if the section was stolen
+	 * @return the index of the section claimed, or _sectionCount if there are none left
+	 */
+	uintptr_t claimSection(MM_EnvironmentBase *env, uintptr_t rangeIndex, bool *stolen);
+
+	/**
+	 * Walk the objects starting in a section.
+	 * @return the number of objects walked
+	 */
+	uintptr_t walkSection(MM_EnvironmentBase *env, WalkSection *section, MM_HeapWalkerObjectFunc function, void *userData);
+
+	MMINLINE static uint64_t makeRange(uintptr_t next, uintptr_t top) { return ((uint64_t)top << 32) | (uint64_t)next; }
+	MMINLINE static uintptr_t rangeNext(uint64_t range) { return (uintptr_t)(range & 0xFFFFFFFF); }
+	MMINLINE static uintptr_t rangeTop(uint64_t range) { return (uintptr_t)(range >> 32); }
+
 protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
 public:	
+	virtual void kill(MM_EnvironmentBase *env);
+
 	/**
 	 * Walk through all live objects of the heap in parallel and apply the provided function.
 	 */
@@ -61,6 +129,20 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * @return the number of sections of the last walk split into sections (walks by chunks leave it unchanged)
+	 */
+	uintptr_t getSectionCount() {
+		return _sectionCount;
+	}
+
+	/**
+	 * @return the number of sections stolen in the last walk split into sections
+	 */
+	uintptr_t getSectionsStolen() {
+		return _sectionsStolen;
+	}
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -77,6 +159,13 @@ public:
 		: MM_HeapWalker()
 		, _markMap(markMap)
 		, _globalCollector(globalCollector)
+		, _sections(NULL)
+		, _sectionCount(0)
+		, _ranges(NULL)
+		, _rangeCount(0)
+		, _activeRangeCount(0)
+		, _rangesClaimed(0)
+		, _sectionsStolen(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -30,6 +30,7 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
 #include "WorkStack.hpp"
 
@@ -68,6 +69,7 @@ void
 MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 {
 	_markingScheme->workerCleanupAfterGC(env);
+	addCompletedWork(env->_markStats._bytesScanned);
 
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
@@ -90,6 +92,14 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+	if (env->getExtensions()->workPacketStealing) {
+		Trc_MM_ParallelMarkTask_workStealingStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getWorkerID(),
+			env->_workPacketStats.workPacketsStolen,
+			env->_workPacketStats.workPacketStealFailures,
+			env->_workPacketStats._workStallCount + env->_workPacketStats._completeStallCount);
+	}
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -31,6 +31,7 @@
 #include "EnvironmentBase.hpp"
 #include "ModronAssertions.h"
 #include "ParallelDispatcher.hpp"
+#include "TreeBarrier.hpp"
 
 bool
 MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
@@ -72,10 +73,29 @@ MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 void
 MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 {
+	uint64_t startTime = 0;
+
 	Trc_MM_SynchronizeGCThreads_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		if (env->getExtensions()->syncPointStatsEnabled) {
+			startTime = omrtime_hires_clock();
+		}
+
+		if (NULL != _synchronizeBarrier) {
+			uintptr_t episode = _synchronizeBarrier->getReleaseEpisode();
+			checkBarrierSyncPoint(env, id, "synchronizeGCThreads");
+			if (_synchronizeBarrier->arrive(env)) {
+				resetBarrierSyncPoint();
+				_synchronizeBarrier->release(env);
+			} else {
+				_synchronizeBarrier->waitForRelease(env, episode);
+			}
+			goto done;
+		}
+
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -106,6 +126,8 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 
 	}
 
+done:
+	recordSyncPointWait(env, id, startTime);
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
 }
 
@@ -113,11 +135,37 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMainThread = false;
+	uint64_t startTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		if (env->getExtensions()->syncPointStatsEnabled) {
+			startTime = omrtime_hires_clock();
+		}
+
+		if (NULL != _synchronizeBarrier) {
+			uintptr_t releaseEpisode = _synchronizeBarrier->getReleaseEpisode();
+			uintptr_t arrivalEpisode = _synchronizeBarrier->getArrivalEpisode();
+			checkBarrierSyncPoint(env, id, "synchronizeGCThreadsAndReleaseMain");
+			bool lastToArrive = _synchronizeBarrier->arrive(env);
+			if (env->isMainThread()) {
+				if (!lastToArrive) {
+					_synchronizeBarrier->waitForArrival(env, arrivalEpisode);
+				}
+				isMainThread = true;
+				_synchronized = true;
+			} else {
+				if (lastToArrive) {
+					_synchronizeBarrier->notifyArrived(env);
+				}
+				_synchronizeBarrier->waitForRelease(env, releaseEpisode);
+			}
+			goto done;
+		}
+
 		volatile uintptr_t index = _synchronizeIndex;
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -160,6 +208,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, con
 	}
 
 done:
+	recordSyncPointWait(env, id, startTime);
 	Trc_MM_SynchronizeGCThreadsAndReleaseMain_Exit(env->getLanguageVMThread());
 	return isMainThread;	
 }
@@ -168,11 +217,29 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	uint64_t startTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		if (env->getExtensions()->syncPointStatsEnabled) {
+			startTime = omrtime_hires_clock();
+		}
+
+		if (NULL != _synchronizeBarrier) {
+			uintptr_t episode = _synchronizeBarrier->getReleaseEpisode();
+			checkBarrierSyncPoint(env, id, "synchronizeGCThreadsAndReleaseSingleThread");
+			if (_synchronizeBarrier->arrive(env)) {
+				isReleasedThread = true;
+				_synchronized = true;
+			} else {
+				_synchronizeBarrier->waitForRelease(env, episode);
+			}
+			goto done;
+		}
+
 		volatile uintptr_t index = _synchronizeIndex;
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
@@ -207,6 +274,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	}
 
 done:
+	recordSyncPointWait(env, id, startTime);
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -230,6 +298,13 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
+	if (NULL != _synchronizeBarrier) {
+		resetBarrierSyncPoint();
+		uint64_t notifyStartTime = omrtime_hires_clock();
+		_synchronizeBarrier->release(env);
+		addToNotifyStallTime(env, notifyStartTime, omrtime_hires_clock());
+		return;
+	}
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
 	_synchronizeIndex += 1;
@@ -294,6 +369,45 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_ParallelTask::setSynchronizeBarrier(MM_TreeBarrier *synchronizeBarrier)
+{
+	_synchronizeBarrier = synchronizeBarrier;
+	if (NULL != synchronizeBarrier) {
+		resetBarrierSyncPoint();
+	}
+}
+
+void
+MM_ParallelTask::checkBarrierSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller)
+{
+	/* With the barrier there is no lock to serialize arrivals - the first thread to arrive installs the id and work unit index */
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	Assert_GC_true_with_message4(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s from %s: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), caller, id, syncPointUniqueId);
+
+	uintptr_t workUnitIndex = env->getWorkUnitIndex();
+	uintptr_t syncPointWorkUnitIndex = MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointWorkUnitIndex, UDATA_MAX, workUnitIndex);
+	Assert_GC_true_with_message4(env, (UDATA_MAX == syncPointWorkUnitIndex) || (syncPointWorkUnitIndex == workUnitIndex),
+		"%s from %s: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), caller, workUnitIndex, syncPointWorkUnitIndex);
+}
+
+void
+MM_ParallelTask::resetBarrierSyncPoint()
+{
+	_syncPointUniqueId = NULL;
+	_syncPointWorkUnitIndex = UDATA_MAX;
+}
+
+void
+MM_ParallelTask::recordSyncPointWait(MM_EnvironmentBase *env, const char *id, uint64_t startTime)
+{
+	if (0 != startTime) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		env->getExtensions()->syncPointStats.record(id, omrtime_hires_clock() - startTime);
+	}
+}
+
 /**
  * Return true if threads are currently syncronized, false otherwise
  * @return true if threads are currently syncronized, false otherwise
@@ -36,6 +36,7 @@
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -62,11 +63,27 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	MM_TreeBarrier *_synchronizeBarrier; /**< If not NULL, synchronization points are implemented with this barrier rather than _synchronizeMutex */
+	volatile uintptr_t _completedWork; /**< Work reported by the threads of the task through addCompletedWork() */
 public:
 	
 	/*
 	 * Function members
 	 */
+private:
+	/**
+	 * Check that all threads synchronizing on the barrier arrived at the same synchronization point and work unit.
+	 */
+	void checkBarrierSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller);
+	/**
+	 * Forget the synchronization point checked by checkBarrierSyncPoint(), must be done before the barrier is released.
+	 */
+	void resetBarrierSyncPoint();
+	/**
+	 * Record the time the calling thread waited at a synchronization point, if enabled.
+	 * @param startTime the hi-res time the thread arrived, or 0 if recording was not enabled
+	 */
+	void recordSyncPointWait(MM_EnvironmentBase *env, const char *id, uint64_t startTime);
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase *env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
@@ -77,6 +94,7 @@ public:
 	virtual bool synchronizeGCThreadsAndReleaseMain(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	virtual void setSynchronizeBarrier(MM_TreeBarrier *synchronizeBarrier);
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -91,6 +109,13 @@ public:
 	
 	virtual bool isSynchronized();
 
+	/**
+	 * Account for work done by the calling thread, typically when it completes the task.
+	 * @param work the work done, in task specific units
+	 */
+	MMINLINE void addCompletedWork(uintptr_t work) { MM_AtomicOperations::add(&_completedWork, work); }
+	MMINLINE virtual uintptr_t getCompletedWork() { return _completedWork; }
+
 	/**
 	 * Create a ParallelTask object.
 	 */
@@ -107,6 +132,8 @@ public:
 		,_synchronizeIndex(0)
 		,_synchronizeCount(0)
 		,_synchronizeMutex(NULL)
+		,_synchronizeBarrier(NULL)
+		,_completedWork(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(PRETOUCHHEAPTASK_HPP_)
+#define PRETOUCHHEAPTASK_HPP_
+
+#include "omrcfg.h"
+
+#include "ParallelTask.hpp"
+
+class MM_EnvironmentBase;
+class MM_HeapPretoucher;
+class MM_ParallelDispatcher;
+
+/**
+ * Task used to touch the heap ranges queued on a heap pretoucher in parallel.
+ * @ingroup GC_Base_Core
+ */
+class MM_PretouchHeapTask : public MM_ParallelTask
+{
+private:
+	MM_HeapPretoucher *_pretoucher;
+	volatile uintptr_t _pretouchedBytes; /**< Bytes touched by all threads */
+
+public:
+	virtual uintptr_t getVMStateID();
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	uintptr_t getPretouchedBytes() const { return _pretouchedBytes; }
+
+	MM_PretouchHeapTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_HeapPretoucher *pretoucher) :
+		MM_ParallelTask(env, dispatcher)
+		, _pretoucher(pretoucher)
+		, _pretouchedBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* PRETOUCHHEAPTASK_HPP_ */
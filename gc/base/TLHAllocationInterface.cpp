@@ -167,6 +167,8 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	void *result = NULL;
 	MM_AllocationContext *ac = env->getAllocationContext();
 	_bytesAllocatedBase = _stats.bytesAllocated(false);
+	/* A sample is reported by the allocation that took it: drop one left by an allocation never initialized */
+	env->_allocationSamplePending = false;
 
 	if (NULL != ac) {
 		/* ensure that we are allowed to use the AI in this configuration in the Tarok case */
@@ -206,6 +208,20 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
+
+		if (MM_TLHAllocationSupport::isAllocationSamplingEnabled(env->getExtensions())) {
+			/* Allocations outside of the TLHs are sampled on their own schedule, as they have no top to lower */
+			uintptr_t size = allocDescription->getContiguousBytes();
+			if (0 == _samplingBytesLeft) {
+				_samplingBytesLeft = env->nextAllocationSamplingInterval();
+			}
+			if (size >= _samplingBytesLeft) {
+				env->_allocationSamplePending = true;
+				_samplingBytesLeft = 0;
+			} else {
+				_samplingBytesLeft -= size;
+			}
+		}
 	}
 
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
@@ -63,6 +63,7 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+	uintptr_t _samplingBytesLeft; /**< Bytes to allocate outside of the TLHs up to and including the next sampled byte (0 until drawn) */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -102,7 +103,8 @@ private:
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 		_cachedAllocationsEnabled(true),
-		_bytesAllocatedBase(0)
+		_bytesAllocatedBase(0),
+		_samplingBytesLeft(0)
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
@@ -117,6 +117,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	} else {
 		/* Clear current information accumulated */
 		setAllZeroes();
+		_samplingCheckpoint = NULL;
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
@@ -141,6 +142,7 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 
 	/* Clear current information accumulated */
 	setAllZeroes();
+	_samplingCheckpoint = NULL;
 
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
 }
@@ -170,6 +172,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		return false;
 	}
 
+	/* The TLH is retired, drop its sampling top so it is cached or abandoned with its real top */
+	resetSamplingTop();
+
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
 	stats->_tlhDiscardedBytes += getRemainingSize();
@@ -245,7 +250,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				if (0 != extensions->batchClearTLH) {
 					void *base = getBase();
 					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					if (((uintptr_t)base >= extensions->preZeroedNurseryLow) && ((uintptr_t)top <= extensions->preZeroedNurseryHigh)) {
+						/* Pre-zeroed nursery memory, only the header of the free entry the TLH was carved from is left */
+						OMRZeroMemory(base, OMR_MIN(sizeof(MM_HeapLinkedFreeHeaderTLH), (uintptr_t)top - (uintptr_t)base));
+						stats->_tlhAllocatedPreZeroed += (uintptr_t)top - (uintptr_t)base;
+					} else {
+						OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -289,6 +300,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
+		if (isAllocationSamplingEnabled(extensions)) {
+			setSamplingTop(env);
+		}
 	}
 
 	return didRefresh;
@@ -305,15 +319,31 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 
 	Assert_MM_true(!env->getExtensions()->isSegregatedHeap());
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
-	/* If there's insufficient space, refresh the current TLH */
+	bool sampled = false;
 	if (sizeInBytesRequired > getSize()) {
-		refresh(env, allocDescription, shouldCollectOnFailure);
+		/* If there's insufficient space, refresh the current TLH, unless only its sampling top is in the way */
+		if (!reachesSamplingTop(sizeInBytesRequired)) {
+			refresh(env, allocDescription, shouldCollectOnFailure);
+		}
+		/* The sampling top of a refreshed TLH may be in the way as well */
+		if ((sizeInBytesRequired > getSize()) && reachesSamplingTop(sizeInBytesRequired)) {
+			/* The allocation takes the sampled byte: count from after it again */
+			setTop(_tlh->realHeapTop);
+			setRealTop(NULL);
+			_samplingCheckpoint = NULL;
+			_samplingBytesLeft = 0;
+			sampled = true;
+		}
 	}
 
 	/* Try to fit the allocate into the current TLH */
 	if(sizeInBytesRequired <= getSize()) {
 		memPtr = (void *)getAlloc();
 		setAlloc((void *)((uintptr_t)getAlloc() + sizeInBytesRequired));
+		if (sampled) {
+			env->_allocationSamplePending = true;
+			setSamplingTop(env);
+		}
 #if defined(OMR_GC_TLH_PREFETCH_FTA)
 		if (*_pointerToTlhPrefetchFTA < (intptr_t)sizeInBytesRequired) {
 			*_pointerToTlhPrefetchFTA = 0;
@@ -383,6 +413,23 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 #endif /* OMR_GC_TLH_PREFETCH_FTA */
 }
 
+void
+MM_TLHAllocationSupport::setSamplingTop(MM_EnvironmentBase *env)
+{
+	if (0 == _samplingBytesLeft) {
+		_samplingBytesLeft = env->nextAllocationSamplingInterval();
+	}
+	_samplingCheckpoint = getAlloc();
+	if (NULL != _samplingCheckpoint) {
+		/* The next sampled byte is the last one left, allocations ending before it stay inline */
+		uintptr_t bytesBeforeSample = _samplingBytesLeft - 1;
+		if (bytesBeforeSample < getSize()) {
+			setRealTop(getTop());
+			setTop((void *)((uintptr_t)_samplingCheckpoint + bytesBeforeSample));
+		}
+	}
+}
+
 void
 MM_TLHAllocationSupport::updateFrequentObjectsStats(MM_EnvironmentBase *env)
 {
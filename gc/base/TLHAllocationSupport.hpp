@@ -83,6 +83,9 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	uintptr_t _samplingBytesLeft; /**< Bytes to allocate from this TLH, counted from _samplingCheckpoint, up to and including the next sampled byte (0 until drawn) */
+	void *_samplingCheckpoint; /**< Alloc pointer from which _samplingBytesLeft is counted, NULL if the TLH has no sampling top */
+
 public:
 protected:
 private:
@@ -146,6 +149,48 @@ private:
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
+	/**
+	 * @return true if the TLH top may be lowered to the next allocation sample
+	 */
+	MMINLINE static bool
+	isAllocationSamplingEnabled(MM_GCExtensionsBase *extensions)
+	{
+		/* realHeapTop belongs to the language while it samples or disables inline allocation */
+		return (0 != extensions->allocationSamplingInterval) && (UDATA_MAX == extensions->objectSamplingBytesGranularity) && !extensions->needDisableInlineAllocation();
+	}
+
+	/**
+	 * Hide the part of the TLH from the next sampled byte on behind realHeapTop, so the allocation of the
+	 * sampled byte leaves the inline allocation path and nothing is paid between samples.
+	 */
+	void setSamplingTop(MM_EnvironmentBase *env);
+
+	/**
+	 * Account for the bytes allocated since the sampling top was set and restore the real TLH top.
+	 */
+	MMINLINE void
+	resetSamplingTop()
+	{
+		if (NULL != _samplingCheckpoint) {
+			/* the sampled byte lies at or beyond the top, so fewer bytes than left were allocated */
+			_samplingBytesLeft -= (uintptr_t)getAlloc() - (uintptr_t)_samplingCheckpoint;
+			if (NULL != _tlh->realHeapTop) {
+				setTop(_tlh->realHeapTop);
+				setRealTop(NULL);
+			}
+			_samplingCheckpoint = NULL;
+		}
+	}
+
+	/**
+	 * @return true if allocating sizeInBytesRequired bytes from the TLH allocates the next sampled byte
+	 */
+	MMINLINE bool
+	reachesSamplingTop(uintptr_t sizeInBytesRequired)
+	{
+		return (NULL != _samplingCheckpoint) && (NULL != _tlh->realHeapTop) && (sizeInBytesRequired <= getRemainingSize());
+	}
+
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
 	MMINLINE void wipeTLH(MM_EnvironmentBase *env)
@@ -157,6 +202,7 @@ private:
 		/* Mark all newly allocated objects from the TLH as valid objects */
 		markValidObjectForRange(env, _tlh->heapBase, getAlloc());
 #endif
+		resetSamplingTop();
 		setupTLH(env, NULL, NULL, NULL, NULL);
 		setRealTop(NULL);
 	}
@@ -191,7 +237,9 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_samplingBytesLeft(0),
+		_samplingCheckpoint(NULL)
 	{};
 
 	/*
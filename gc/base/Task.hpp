@@ -47,6 +47,7 @@
 
 class MM_EnvironmentBase;
 class MM_ParallelDispatcher;
+class MM_TreeBarrier;
 
 /**
  * @todo Provide class documentation
@@ -67,6 +68,12 @@ public:
 
 	virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
 
+	/**
+	 * Amount of work done by all threads of the task, in task specific units (used by adaptive task threading).
+	 * @return the work done, or 0 if the task does not measure its work
+	 */
+	virtual uintptr_t getCompletedWork() { return 0; }
+
 	/**
 	 * Single call setup routine for tasks invoked by the main thread before the task is dispatched.
 	 */
@@ -89,6 +96,11 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	MMINLINE virtual void setSynchronizeBarrier(MM_TreeBarrier *synchronizeBarrier)
+	{
+		/* in a Task we don't need a barrier */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
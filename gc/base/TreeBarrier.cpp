@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "TreeBarrier.hpp"
+
+MM_TreeBarrier *
+MM_TreeBarrier::newInstance(MM_EnvironmentBase *env, uintptr_t maxThreads)
+{
+	MM_TreeBarrier *barrier = (MM_TreeBarrier *)env->getForge()->allocate(sizeof(MM_TreeBarrier), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != barrier) {
+		new(barrier) MM_TreeBarrier();
+		if (!barrier->initialize(env, maxThreads)) {
+			barrier->kill(env);
+			barrier = NULL;
+		}
+	}
+	return barrier;
+}
+
+void
+MM_TreeBarrier::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TreeBarrier::initialize(MM_EnvironmentBase *env, uintptr_t maxThreads)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	Assert_MM_true(0 < maxThreads);
+	_maxThreads = maxThreads;
+	_spinCount = env->getExtensions()->gcSyncBarrierSpinCount;
+
+	/* size the node array for the widest tree we may have to build */
+	_nodeCount = 0;
+	uintptr_t width = maxThreads;
+	do {
+		width = parentLevelWidth(width);
+		_nodeCount += width;
+	} while (1 < width);
+
+	_nodes = (TreeNode *)forge->allocate(_nodeCount * sizeof(TreeNode), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_slotTable = (uintptr_t *)forge->allocate(maxThreads * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	_slotGeneration = (uintptr_t *)forge->allocate(maxThreads * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if ((NULL == _nodes) || (NULL == _slotTable) || (NULL == _slotGeneration)) {
+		return false;
+	}
+	memset((void *)_nodes, 0, _nodeCount * sizeof(TreeNode));
+	memset(_slotTable, 0, maxThreads * sizeof(uintptr_t));
+	memset(_slotGeneration, 0, maxThreads * sizeof(uintptr_t));
+
+	if (0 != omrthread_monitor_init_with_name(&_parkMonitor, 0, "MM_TreeBarrier::park")) {
+		_parkMonitor = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_TreeBarrier::tearDown(MM_EnvironmentBase *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	if (NULL != _parkMonitor) {
+		omrthread_monitor_destroy(_parkMonitor);
+		_parkMonitor = NULL;
+	}
+	if (NULL != _nodes) {
+		forge->free(_nodes);
+		_nodes = NULL;
+	}
+	if (NULL != _slotTable) {
+		forge->free(_slotTable);
+		_slotTable = NULL;
+	}
+	if (NULL != _slotGeneration) {
+		forge->free(_slotGeneration);
+		_slotGeneration = NULL;
+	}
+}
+
+void
+MM_TreeBarrier::reset(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	Assert_MM_true((0 < threadCount) && (threadCount <= _maxThreads));
+	_threadCount = threadCount;
+
+	/* Build the tree bottom up. Each level starts right after the previous one, leaves first, so the parent of
+	 * node i of a level is node (i / _fanIn) of the next level.
+	 */
+	uintptr_t children = threadCount;
+	uintptr_t levels = 0;
+	TreeNode *level = _nodes;
+	do {
+		uintptr_t width = parentLevelWidth(children);
+		TreeNode *parentLevel = level + width;
+		for (uintptr_t i = 0; i < width; i++) {
+			level[i]._count = 0;
+			level[i]._expected = OMR_MIN((uintptr_t)_fanIn, children - (i * _fanIn));
+			level[i]._parent = (1 == width) ? NULL : &parentLevel[i / _fanIn];
+		}
+		children = width;
+		level = parentLevel;
+		levels += 1;
+	} while (1 < children);
+	Assert_MM_true(level <= (_nodes + _nodeCount));
+	_maxLevels = OMR_MAX(_maxLevels, levels);
+
+	_nextSlot = 0;
+	_generation += 1;
+	MM_AtomicOperations::storeSync();
+}
+
+uintptr_t
+MM_TreeBarrier::getSlot(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	Assert_MM_true(workerID < _maxThreads);
+
+	if (_generation != _slotGeneration[workerID]) {
+		/* first sync of this thread in the task - slots are handed out densely in order of arrival */
+		_slotTable[workerID] = MM_AtomicOperations::add(&_nextSlot, 1) - 1;
+		_slotGeneration[workerID] = _generation;
+		Assert_MM_true(_slotTable[workerID] < _threadCount);
+	}
+	return _slotTable[workerID];
+}
+
+bool
+MM_TreeBarrier::arrive(MM_EnvironmentBase *env)
+{
+	TreeNode *node = &_nodes[getSlot(env) / _fanIn];
+
+	while (NULL != node) {
+		if (node->_expected != MM_AtomicOperations::add(&node->_count, 1)) {
+			/* not the last child of this node - the last one carries on up the tree */
+			return false;
+		}
+		/* No thread can arrive at this node again before the episode is released, which
+		 * happens only after the root is complete, so it is safe to reset the count here.
+		 */
+		node->_count = 0;
+		node = node->_parent;
+	}
+
+	/* completed the root - only one thread at a time gets here, and the release publishes the counts */
+	_episodes += 1;
+	_arrivals += _threadCount;
+	MM_AtomicOperations::readWriteBarrier();
+	return true;
+}
+
+void
+MM_TreeBarrier::waitForEpisode(MM_EnvironmentBase *env, volatile uintptr_t *episodeAddr, uintptr_t episode)
+{
+	for (uintptr_t spin = 0; spin < _spinCount; spin++) {
+		if (episode != *episodeAddr) {
+			MM_AtomicOperations::readBarrier();
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	omrthread_monitor_enter(_parkMonitor);
+	/* The increment is a full fence - either the releasing thread sees us parked, or we see the new episode */
+	MM_AtomicOperations::add(&_parkedCount, 1);
+	_parks += 1;
+	while (episode == *episodeAddr) {
+		omrthread_monitor_wait(_parkMonitor);
+	}
+	MM_AtomicOperations::subtract(&_parkedCount, 1);
+	omrthread_monitor_exit(_parkMonitor);
+}
+
+void
+MM_TreeBarrier::advanceEpisode(MM_EnvironmentBase *env, volatile uintptr_t *episodeAddr)
+{
+	MM_AtomicOperations::add(episodeAddr, 1);
+	/* The add is a full fence, so the read of the parked count cannot be satisfied before the new episode is visible */
+	if (0 != _parkedCount) {
+		omrthread_monitor_enter(_parkMonitor);
+		omrthread_monitor_notify_all(_parkMonitor);
+		omrthread_monitor_exit(_parkMonitor);
+	}
+}
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TREEBARRIER_HPP_)
+#define TREEBARRIER_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Combining tree barrier used by MM_ParallelTask to synchronize the GC threads of a task
+ * (enabled with MM_GCExtensionsBase::gcSyncTreeBarrier).
+ *
+ * Arriving threads count up a tree of small counters (fan in of _fanIn), so that no single
+ * word is updated by all threads. The thread that completes the root is the last one to arrive.
+ * Waiting threads spin on an episode counter for a while, and only then park on a monitor.
+ * The release only enters the monitor if some thread has actually parked.
+ *
+ * One barrier is owned by the dispatcher and shared by all tasks it runs, the same way as the
+ * synchronize mutex. It must be reset for the thread count of a task before the task is dispatched.
+ * @ingroup GC_Base
+ */
+class MM_TreeBarrier : public MM_BaseVirtual
+{
+/* Data members / types */
+public:
+protected:
+private:
+	enum {
+		_fanIn = 4, /**< Number of children (threads or nodes) counted by each tree node */
+		_nodeSize = 64 /**< Size each node is padded to, so that nodes do not share cache lines */
+	};
+
+	struct TreeNode {
+		volatile uintptr_t _count; /**< Number of children arrived in the current episode */
+		uintptr_t _expected; /**< Number of children expected in each episode */
+		TreeNode *_parent; /**< Parent node, NULL for the root */
+		uint8_t _padding[_nodeSize - (3 * sizeof(uintptr_t))];
+	};
+
+	uintptr_t _maxThreads; /**< Maximum number of threads that can take part in an episode */
+	uintptr_t _threadCount; /**< Number of threads taking part in each episode of the current task */
+	TreeNode *_nodes; /**< All tree nodes, leaves first, sized for _maxThreads */
+	uintptr_t _nodeCount; /**< Number of entries in _nodes */
+
+	uintptr_t *_slotTable; /**< Leaf slot of each worker (indexed by worker ID) for the current task */
+	uintptr_t *_slotGeneration; /**< Generation each entry of _slotTable was assigned in (indexed by worker ID) */
+	uintptr_t _generation; /**< Incremented at every reset, invalidating all slots */
+	volatile uintptr_t _nextSlot; /**< Next slot to hand out in the current task */
+
+	volatile uintptr_t _arrivalEpisode; /**< Incremented when all threads have arrived, if the last arriving thread is not the one to be released */
+	volatile uintptr_t _releaseEpisode; /**< Incremented when the waiting threads are released */
+	volatile uintptr_t _parkedCount; /**< Number of threads parked on _parkMonitor */
+	omrthread_monitor_t _parkMonitor; /**< Monitor parked threads wait on */
+	uintptr_t _spinCount; /**< Number of times a waiting thread checks the episode before it parks */
+
+	uintptr_t _episodes; /**< Number of episodes completed since the stats were cleared */
+	uintptr_t _arrivals; /**< Number of thread arrivals in the episodes completed since the stats were cleared */
+	uintptr_t _parks; /**< Number of times a waiting thread parked since the stats were cleared */
+	uintptr_t _maxLevels; /**< Most levels of the tree built for a task since the stats were cleared */
+
+/* Methods */
+public:
+	static MM_TreeBarrier *newInstance(MM_EnvironmentBase *env, uintptr_t maxThreads);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Prepare the barrier for a task. Must be called before any thread of the task arrives.
+	 * @param threadCount the number of threads that will arrive at each episode
+	 */
+	void reset(MM_EnvironmentBase *env, uintptr_t threadCount);
+
+	/**
+	 * Arrive at the barrier, without waiting for the other threads.
+	 * @return true if the calling thread is the last one to arrive
+	 */
+	bool arrive(MM_EnvironmentBase *env);
+
+	/**
+	 * Wait for the release of the given episode.
+	 * @param episode the value of getReleaseEpisode() read before arriving
+	 */
+	void waitForRelease(MM_EnvironmentBase *env, uintptr_t episode)
+	{
+		waitForEpisode(env, &_releaseEpisode, episode);
+	}
+
+	/**
+	 * Wait for all threads to have arrived at the given episode. Only used by the thread to be released when
+	 * it is not the last one to arrive, and requires the last one to call notifyArrived().
+	 * @param episode the value of getArrivalEpisode() read before arriving
+	 */
+	void waitForArrival(MM_EnvironmentBase *env, uintptr_t episode)
+	{
+		waitForEpisode(env, &_arrivalEpisode, episode);
+	}
+
+	/**
+	 * Notify the thread waiting in waitForArrival() that all threads have arrived.
+	 */
+	void notifyArrived(MM_EnvironmentBase *env)
+	{
+		advanceEpisode(env, &_arrivalEpisode);
+	}
+
+	/**
+	 * Release all threads waiting in waitForRelease().
+	 */
+	void release(MM_EnvironmentBase *env)
+	{
+		advanceEpisode(env, &_releaseEpisode);
+	}
+
+	MMINLINE uintptr_t getReleaseEpisode() { return _releaseEpisode; }
+	MMINLINE uintptr_t getArrivalEpisode() { return _arrivalEpisode; }
+
+	/**
+	 * Reset the episode, arrival and park counts. Must not be called while a task is using the barrier.
+	 */
+	void clearStats()
+	{
+		_episodes = 0;
+		_arrivals = 0;
+		_parks = 0;
+		_maxLevels = 0;
+	}
+
+	MMINLINE uintptr_t getFanIn() { return _fanIn; }
+	MMINLINE uintptr_t getEpisodes() { return _episodes; }
+	MMINLINE uintptr_t getArrivals() { return _arrivals; }
+	MMINLINE uintptr_t getParks() { return _parks; }
+	MMINLINE uintptr_t getMaxLevels() { return _maxLevels; }
+
+	MM_TreeBarrier()
+		: MM_BaseVirtual()
+		, _maxThreads(0)
+		, _threadCount(0)
+		, _nodes(NULL)
+		, _nodeCount(0)
+		, _slotTable(NULL)
+		, _slotGeneration(NULL)
+		, _generation(0)
+		, _nextSlot(0)
+		, _arrivalEpisode(0)
+		, _releaseEpisode(0)
+		, _parkedCount(0)
+		, _parkMonitor(NULL)
+		, _spinCount(0)
+		, _episodes(0)
+		, _arrivals(0)
+		, _parks(0)
+		, _maxLevels(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t maxThreads);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * @return the number of tree nodes needed at the level above a level of the given width
+	 */
+	MMINLINE static uintptr_t parentLevelWidth(uintptr_t width) { return (width + _fanIn - 1) / _fanIn; }
+
+	uintptr_t getSlot(MM_EnvironmentBase *env);
+	void waitForEpisode(MM_EnvironmentBase *env, volatile uintptr_t *episodeAddr, uintptr_t episode);
+	void advanceEpisode(MM_EnvironmentBase *env, volatile uintptr_t *episodeAddr);
+};
+
+#endif /* TREEBARRIER_HPP_ */
@@ -120,6 +120,12 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workPacketStealing) {
+		if (!initStealableDeques(env)) {
+			return false;
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -213,6 +219,32 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	return true;
 }
 
+/**
+ * Allocate a work stealing deque for every GC thread
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPackets::initStealableDeques(MM_EnvironmentBase *env)
+{
+	_stealableDequeCount = _extensions->gcThreadCount;
+	_stealableDeques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * _stealableDequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _stealableDeques) {
+		_stealableDequeCount = 0;
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+		new(&_stealableDeques[i]) MM_PacketDeque();
+	}
+	for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+		if (!_stealableDeques[i].initialize(env, _stealableDequeSize, i + 1)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Destroy the resources a MM_WorkPackets is responsible for
  */
@@ -241,6 +273,15 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		_allocatingPackets = NULL;
 	}
 
+	if (NULL != _stealableDeques) {
+		for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+			_stealableDeques[i].tearDown(env);
+		}
+		env->getForge()->free(_stealableDeques);
+		_stealableDeques = NULL;
+		_stealableDequeCount = 0;
+	}
+
 	_emptyPacketList.tearDown(env);
 	_fullPacketList.tearDown(env);
 	_nonEmptyPacketList.tearDown(env);
@@ -262,6 +303,15 @@ void
 MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 {	
 	MM_Packet *packet;
+
+	if (NULL != _stealableDeques) {
+		for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+			while (NULL != (packet = _stealableDeques[i].steal())) {
+				packet->resetData(env);
+				putPacket(env, packet);
+			}
+		}
+	}
 	
 	while(NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
@@ -332,11 +382,87 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| ((NULL != _stealableDeques) && stealablePacketAvailable()));
 				
 	return res;
 }
 
+/**
+ * Determine whether any GC thread holds a packet in its deque
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPackets::stealablePacketAvailable()
+{
+	for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+		if (!_stealableDeques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Determine whether the calling thread exchanges packets through its own deque.
+ * Only threads running a dispatched task take part in work stealing; all other
+ * threads (mutators helping with concurrent marking, for example) use the shared lists.
+ * @return true if the thread owns a deque for the current task
+ */
+bool
+MM_WorkPackets::isWorkStealingActive(MM_EnvironmentBase *env)
+{
+	return (NULL != _stealableDeques) && (NULL != env->_currentTask) && (env->getWorkerID() < _stealableDequeCount);
+}
+
+/**
+ * Steal a packet from the deque of another GC thread. The first victim is
+ * picked at random, the remaining deques are then tried in order.
+ *
+ * @return a packet, or NULL if none could be stolen
+ */
+MM_Packet *
+MM_WorkPackets::stealPacket(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t victim = _stealableDeques[workerID].nextRandom() % _stealableDequeCount;
+
+	for (uintptr_t i = 0; i < _stealableDequeCount; i++) {
+		if (victim != workerID) {
+			MM_Packet *packet = _stealableDeques[victim].steal();
+			if (NULL != packet) {
+				packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.workPacketsStolen += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				return packet;
+			}
+		}
+		victim += 1;
+		if (victim == _stealableDequeCount) {
+			victim = 0;
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.workPacketStealFailures += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	return NULL;
+}
+
+void
+MM_WorkPackets::returnStealablePackets(MM_EnvironmentBase *env)
+{
+	if (isWorkStealingActive(env)) {
+		MM_PacketDeque *deque = &_stealableDeques[env->getWorkerID()];
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = deque->pop())) {
+			packet->setOwner(env);
+			putPacket(env, packet);
+		}
+	}
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -385,6 +511,19 @@ MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
+	bool workStealing = isWorkStealingActive(env);
+
+	if (workStealing) {
+		/* The packets this thread produced most recently are the most likely to still be in its cache */
+		packet = _stealableDeques[env->getWorkerID()].pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+	}
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
@@ -408,6 +547,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		packet = getInputPacketFromOverflow(env);
 	}
 
+	if ((NULL == packet) && workStealing) {
+		packet = stealPacket(env);
+	}
+
 	if(NULL != packet) {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		env->_workPacketStats.workPacketsAcquired += 1;
@@ -432,6 +575,10 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	bool doneFlag = false;
 	volatile uintptr_t doneIndex = _inputListDoneIndex;
 	bool mustSyncThreadsAndExit = (NULL != env->_currentTask) && env->_currentTask->shouldYieldFromTask(env);
+
+	if (isWorkStealingActive(env)) {
+		return getInputPacketWorkStealing(env);
+	}
 	
 	while(!doneFlag) {
 		if (!mustSyncThreadsAndExit) {
@@ -497,6 +644,81 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 	return packet;
 }
 
+/**
+ * Get an input packet in work stealing mode. Threads which run out of work spin looking
+ * for packets to steal rather than waiting on the input list monitor. Termination is
+ * detected with a shared count of idle task threads: a thread leaves the idle state
+ * (decrements the count) before it takes any new work, so once every task thread is
+ * idle no packet can be left in the shared lists, the overflow handler or any deque.
+ *
+ * @return Pointer to an input packet, or NULL once all task threads are out of work
+ */
+MM_Packet *
+MM_WorkPackets::getInputPacketWorkStealing(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	bool mustSyncThreadsAndExit = env->_currentTask->shouldYieldFromTask(env);
+
+	if (mustSyncThreadsAndExit) {
+		/* Leave our work in the shared lists for whoever resumes the task */
+		returnStealablePackets(env);
+	} else {
+		packet = getInputPacketNoWait(env);
+		if (NULL != packet) {
+			return packet;
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	uintptr_t doneIndex = _stealDoneIndex;
+	uintptr_t spinCount = 0;
+	bool done = false;
+	MM_AtomicOperations::add(&_stealIdleCount, 1);
+
+	while ((NULL == packet) && !done) {
+		uintptr_t idleCount = _stealIdleCount;
+		if (doneIndex != _stealDoneIndex) {
+			done = true;
+		} else if (threadCount == idleCount) {
+			/* Every task thread is out of work - the first one to notice ends this round */
+			if (threadCount == MM_AtomicOperations::lockCompareExchange(&_stealIdleCount, threadCount, 0)) {
+				MM_AtomicOperations::add(&_stealDoneIndex, 1);
+				done = true;
+			}
+		} else if (!mustSyncThreadsAndExit && inputPacketAvailable(env)) {
+			/* Leave the idle state before taking the work so termination can not be declared while we hold it */
+			if (idleCount == MM_AtomicOperations::lockCompareExchange(&_stealIdleCount, idleCount, idleCount - 1)) {
+				packet = getInputPacketNoWait(env);
+				if (NULL == packet) {
+					MM_AtomicOperations::add(&_stealIdleCount, 1);
+				}
+			}
+			spinCount = 0;
+		} else if (spinCount < _stealSpinCount) {
+			spinCount += 1;
+			MM_AtomicOperations::yieldCPU();
+		} else {
+			omrthread_yield();
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	uint64_t waitEndTime = omrtime_hires_clock();
+	if (done) {
+		env->_workPacketStats.addToCompleteStallTime(waitStartTime, waitEndTime);
+	} else {
+		env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return packet;
+}
+
 /**
  * Get an output packet
  * 
@@ -578,6 +800,13 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	MM_Packet *packet = NULL;
 	
 	packet = getPacket(env, &_fullPacketList);
+	if ((NULL == packet) && isWorkStealingActive(env)) {
+		/* In work stealing mode the packets this thread filled are held in its deque rather than on the full list */
+		packet = _stealableDeques[env->getWorkerID()].pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+		}
+	}
 	if(NULL != packet) {
 		/* Move the contents of the packet to overflow */
 		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
@@ -762,6 +991,16 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	if (isWorkStealingActive(env) && !packet->isEmpty()) {
+		/* Keep the packet local; other threads steal it only when they run out of work */
+		packet->resetOwner();
+		if (_stealableDeques[env->getWorkerID()].push(packet)) {
+			return;
+		}
+		/* The deque is full - fall back to the shared lists */
+		packet->setOwner(env);
+	}
 	putPacket(env, packet);
 }
 
@@ -36,6 +36,7 @@
 
 #include "BaseVirtual.hpp"
 #include "Packet.hpp"
+#include "PacketDeque.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
 
@@ -64,7 +65,9 @@ protected:
 		_fullPacketThreshold = _slotsInPacket >> 4,
 		_satisfactoryCapacity = _slotsInPacket / 2,
 		_indexMask = 0xff,
-		_maxPacketSearch = 20
+		_maxPacketSearch = 20,
+		_stealableDequeSize = 1024,
+		_stealSpinCount = 64
 	};
 
 	uintptr_t _packetsPerBlock;
@@ -89,6 +92,11 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_PacketDeque *_stealableDeques; /**< Per GC thread deques of output packets (indexed by worker ID), NULL unless work stealing is enabled */
+	uintptr_t _stealableDequeCount; /**< Number of entries in _stealableDeques */
+	volatile uintptr_t _stealIdleCount; /**< Number of task threads which are out of work, used for termination detection in work stealing mode */
+	volatile uintptr_t _stealDoneIndex; /**< Incremented each time all task threads ran out of work in work stealing mode */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
@@ -96,6 +104,12 @@ protected:
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
+	bool isWorkStealingActive(MM_EnvironmentBase *env);
+	bool initStealableDeques(MM_EnvironmentBase *env);
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+	bool stealablePacketAvailable();
+	MM_Packet *getInputPacketWorkStealing(MM_EnvironmentBase *env);
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	
@@ -116,6 +130,14 @@ public:
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Move any packets left in the calling thread's deque to the shared lists, so that
+	 * they remain visible once the thread stops taking part in the current task.
+	 * No-op unless work stealing is active for the thread.
+	 * @param env the current thread
+	 */
+	void returnStealablePackets(MM_EnvironmentBase *env);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -235,7 +257,12 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_extensions(NULL),
+		_stealableDeques(NULL),
+		_stealableDequeCount(0),
+		_stealIdleCount(0),
+		_stealDoneIndex(0)
 	{
 		_typeId = __FUNCTION__;
 	}
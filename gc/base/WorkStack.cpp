@@ -83,6 +83,9 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	if (NULL != _workPackets) {
+		_workPackets->returnStealablePackets(env);
+	}
 	_workPackets = NULL;
 }
 
@@ -29,7 +29,9 @@
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "ModronAssertions.h"
 #include "RegionPoolSegregated.hpp"
@@ -62,6 +64,7 @@ bool
 MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 {
 	memset(&_perContextSmallFullRegions[0], 0, sizeof(_perContextSmallFullRegions));
+	memset(&_perContextSmallAvailableRegions[0], 0, sizeof(_perContextSmallAvailableRegions));
 
 	if (!MM_AllocationContext::initialize(env)) {
 		return false;
@@ -79,7 +82,8 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		_smallRegions[i] = NULL;
 		/* the small allocation lock needs to be acquired before small full region queue can be accessed, no concurrent access should be possible */
 		_perContextSmallFullRegions[i] = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_FULL, true, false, false);
-		if (NULL == _perContextSmallFullRegions[i]) {
+		_perContextSmallAvailableRegions[i] = MM_LockFreeHeapRegionQueue::newInstance(env, _regionPool->getHeapRegionManager(), MM_HeapRegionList::HRL_KIND_AVAILABLE);
+		if ((NULL == _perContextSmallFullRegions[i]) || (NULL == _perContextSmallAvailableRegions[i])) {
 			return false;
 		}
 	}
@@ -111,6 +115,10 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 			_perContextSmallFullRegions[i]->kill(env);
 			_perContextSmallFullRegions[i] = NULL;
 		}
+		if (NULL != _perContextSmallAvailableRegions[i]) {
+			_perContextSmallAvailableRegions[i]->kill(env);
+			_perContextSmallAvailableRegions[i] = NULL;
+		}
 	}
 
 	if (NULL != _perContextArrayletFullRegions) {
@@ -153,10 +161,11 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 {
 	lockContext();
 
-	/* flush the per-context small full regions to sweep regions */
+	/* flush the per-context small full regions, and the available regions claimed but not used yet, to sweep regions */
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		flushSmall(env, sizeClass);
 		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		_perContextSmallAvailableRegions[sizeClass]->dequeue(_regionPool->getSmallSweepRegions(sizeClass), UDATA_MAX);
 	}
 
 	/* flush the per-context large full region to sweep regions */
@@ -179,8 +188,10 @@ MM_AllocationContextSegregated::returnFullRegionsToRegionPool(MM_EnvironmentBase
 {
 	lockContext();
 
+	uintptr_t splitIndex = env->getEnvironmentId() % _regionPool->getSplitAvailableListSplitCount();
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 		_regionPool->getSmallFullRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
+		returnReservedSmallRegions(env, sizeClass, splitIndex);
 	}
 	_regionPool->getLargeFullRegions()->enqueue(_perContextLargeFullRegions);
 	_regionPool->getArrayletFullRegions()->enqueue(_perContextArrayletFullRegions);
@@ -188,6 +199,17 @@ MM_AllocationContextSegregated::returnFullRegionsToRegionPool(MM_EnvironmentBase
 	unlockContext();
 }
 
+void
+MM_AllocationContextSegregated::returnReservedSmallRegions(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t splitIndex)
+{
+	uintptr_t numCells = env->getExtensions()->defaultSizeClasses->getNumCells(sizeClass);
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	while (NULL != (region = _perContextSmallAvailableRegions[sizeClass]->dequeue())) {
+		uintptr_t occupancy = (region->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
+		_regionPool->enqueueAvailable(region, sizeClass, occupancy, splitIndex);
+	}
+}
+
 void
 MM_AllocationContextSegregated::signalSmallRegionDepleted(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
@@ -197,13 +219,26 @@ MM_AllocationContextSegregated::signalSmallRegionDepleted(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::tryAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
-	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
+	/* Claim a batch of regions at a time, so threads refilling the same size class meet in the region pool less often */
+	MM_LockFreeHeapRegionQueue *availableRegions = _perContextSmallAvailableRegions[sizeClass];
+	if (availableRegions->isEmpty()) {
+		_regionPool->allocateRegionsFromSmallSizeClass(env, sizeClass, availableRegions, env->getExtensions()->segregatedRegionRefillBatchSize);
+	}
+	MM_HeapRegionDescriptorSegregated *region = availableRegions->dequeue();
 	bool result = false;
 	if (region != NULL) {
 		_smallRegions[sizeClass] = region;
 		/* cache the small full region in AC */
 		_perContextSmallFullRegions[sizeClass]->enqueue(region);
 		result = true;
+
+		/* Another context found the region pool out of this size class, so give back the rest of the batch rather
+		 * than have it sweep or take a free region while these sit idle. Only the owner touches its reserve.
+		 */
+		if (_regionPool->isSmallSizeClassExhausted(sizeClass) && !availableRegions->isEmpty()) {
+			returnReservedSmallRegions(env, sizeClass, env->getEnvironmentId() % _regionPool->getSplitAvailableListSplitCount());
+			_regionPool->resetSkipAvailableRegionForAllocation(sizeClass);
+		}
 	}
 	return result;
 }
@@ -247,7 +282,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* Young collections tell old objects from young ones by the marks left by the previous collection */
+	return !env->getExtensions()->segregatedYoungCollection;
 }
 
 /*
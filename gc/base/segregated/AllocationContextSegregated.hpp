@@ -38,6 +38,7 @@
 class MM_GlobalAllocationManagerSegregated;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
+class MM_LockFreeHeapRegionQueue;
 class MM_HeapRegionDescriptorSegregated;
 class MM_SegregatedMarkingScheme;
 class MM_RegionPoolSegregated;
@@ -49,6 +50,7 @@ public:
 	MM_HeapRegionDescriptorSegregated *_smallRegions[OMR_SIZECLASSES_NUM_SMALL+1];
 
 protected:
+	MM_GlobalAllocationManagerSegregated *_globalAllocationManager;
 	MM_RegionPoolSegregated *_regionPool;
 
 private:
@@ -59,6 +61,7 @@ private:
 	volatile uint32_t _count; /**< how many threads are attached to me */
 
 	MM_HeapRegionQueue *_perContextSmallFullRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context Regions that have been allocated into during this GC cycle. */
+	MM_LockFreeHeapRegionQueue *_perContextSmallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context available regions claimed from the region pool in a batch but not allocated into yet. Returned to the region pool when it runs out of their size class. */
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
 
@@ -112,6 +115,7 @@ public:
 protected:
 	MM_AllocationContextSegregated(MM_EnvironmentBase *env, MM_GlobalAllocationManagerSegregated *gam, MM_RegionPoolSegregated *regionPool)
 		: MM_AllocationContext()
+		, _globalAllocationManager(gam)
 		, _regionPool(regionPool)
 		, _arrayletRegion(NULL)
 		, _markingScheme(NULL)
@@ -129,6 +133,12 @@ protected:
 
 
 	void flushSmall(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Return the available regions of a size class this context claimed in a batch but has not allocated into yet
+	 * to the available lists of the region pool.
+	 */
+	void returnReservedSmallRegions(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t splitIndex);
 	void flushArraylet(MM_EnvironmentBase *env);
 
 	virtual bool shouldPreMarkSmallCells(MM_EnvironmentBase *env);
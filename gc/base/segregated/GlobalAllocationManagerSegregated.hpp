@@ -31,6 +31,7 @@
 
 class MM_AllocationContextSegregated;
 class MM_EnvironmentBase;
+class MM_HeapRegionQueue;
 class MM_RegionPoolSegregated;
 class MM_SegregatedMarkingScheme;
 class MM_SweepSchemeSegregated;
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronopt.h"
+#include "sizeclasses.h"
+
+#include "LockFreeFreeHeapRegionList.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeFreeHeapRegionList *
+MM_LockFreeFreeHeapRegionList::newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionList::RegionListKind regionListKind)
+{
+	MM_LockFreeFreeHeapRegionList *fpl = (MM_LockFreeFreeHeapRegionList *)env->getForge()->allocate(sizeof(MM_LockFreeFreeHeapRegionList), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (fpl) {
+		new (fpl) MM_LockFreeFreeHeapRegionList(regionManager, regionListKind);
+		if (!fpl->initialize(env)) {
+			fpl->kill(env);
+			return NULL;
+		}
+	}
+	return fpl;
+}
+
+void
+MM_LockFreeFreeHeapRegionList::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeFreeHeapRegionList::initialize(MM_EnvironmentBase *env)
+{
+	return _regions.initialize(env);
+}
+
+void
+MM_LockFreeFreeHeapRegionList::tearDown(MM_EnvironmentBase *env)
+{
+	_regions.tearDown(env);
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_LockFreeFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess)
+{
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	if (1 == numRegions) {
+		region = MM_FreeHeapRegionList::allocate(env, szClass);
+	}
+	return region;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
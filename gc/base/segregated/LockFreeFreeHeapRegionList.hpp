@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEFREEHEAPREGIONLIST_HPP_)
+#define LOCKFREEFREEHEAPREGIONLIST_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+#include "modronopt.h"
+
+#include "FreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A FreeHeapRegionList of single regions which can be used concurrently without a lock. The regions are
+ * kept on a MM_LockFreeHeapRegionQueue, so this list can not hold ranges of regions. Detaching a region pops
+ * the whole list, which is fine for a rare operation but not for coalescing, so coalescing moves the regions
+ * to a MM_LockingFreeHeapRegionList first.
+ */
+class MM_LockFreeFreeHeapRegionList : public MM_FreeHeapRegionList
+{
+/* Data members & types */
+public:
+protected:
+private:
+	MM_LockFreeHeapRegionQueue _regions; /**< The free regions */
+
+/* Methods */
+public:
+	static MM_LockFreeFreeHeapRegionList *newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, MM_HeapRegionList::RegionListKind regionListKind);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeFreeHeapRegionList(MM_HeapRegionManager *regionManager, MM_HeapRegionList::RegionListKind regionListKind) :
+		MM_FreeHeapRegionList(regionListKind, true),
+		_regions(regionManager, regionListKind)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual void
+	push(MM_HeapRegionDescriptorSegregated *region)
+	{
+		Assert_MM_true(1 == region->getRange());
+		/* Only the next link is used on the stack, clear the one a doubly linked list may have left */
+		region->setPrev(NULL);
+		_regions.enqueue(region);
+	}
+
+	virtual void
+	push(MM_HeapRegionQueue *src)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->dequeue())) {
+			push(region);
+		}
+	}
+
+	virtual void
+	push(MM_FreeHeapRegionList *src)
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = src->pop())) {
+			push(region);
+		}
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *pop() { return _regions.dequeue(); }
+
+	virtual void
+	detach(MM_HeapRegionDescriptorSegregated *cur)
+	{
+		bool found = _regions.remove(cur);
+		Assert_MM_true(found);
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
+
+	/* Methods inherited from HeapRegionList */
+	virtual bool isEmpty() { return _regions.isEmpty(); }
+	virtual uintptr_t getTotalRegions() { return _regions.getTotalRegions(); }
+	virtual void showList(MM_EnvironmentBase *env) { _regions.showList(env); }
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEFREEHEAPREGIONLIST_HPP_ */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionQueue *
+MM_LockFreeHeapRegionQueue::newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, RegionListKind regionListKind)
+{
+	MM_LockFreeHeapRegionQueue *regionList = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionQueue), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (regionList) {
+		new (regionList) MM_LockFreeHeapRegionQueue(regionManager, regionListKind);
+		if (!regionList->initialize(env)) {
+			regionList->kill(env);
+			return NULL;
+		}
+	}
+	return regionList;
+}
+
+void
+MM_LockFreeHeapRegionQueue::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionQueue::initialize(MM_EnvironmentBase *env)
+{
+	return true;
+}
+
+void
+MM_LockFreeHeapRegionQueue::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+/**
+ * Not safe to call while the queue is being updated.
+ */
+void
+MM_LockFreeHeapRegionQueue::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t index = 0;
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeHeapRegionList 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = regionFromTop(_top); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, index, cur->getRange());
+		count += 1;
+		index += cur->getRange();
+	}
+	omrtty_printf("\n");
+}
+
+/**
+ * DEBUG method that iterates over all regions in the list and sums up the free bytes.
+ * Not safe to call while the queue is being updated.
+ * @see MM_HeapRegionDescriptorSegregated::debugCountFreeBytes()
+ */
+uintptr_t
+MM_LockFreeHeapRegionQueue::debugCountFreeBytesInRegions()
+{
+	uintptr_t freeBytes = 0;
+	for (MM_HeapRegionDescriptorSegregated *cur = regionFromTop(_top); cur != NULL; cur = cur->getNext()) {
+		freeBytes += cur->debugCountFreeBytes();
+	}
+	return freeBytes;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
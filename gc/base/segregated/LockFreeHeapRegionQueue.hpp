@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONQUEUE_HPP_)
+#define LOCKFREEHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "HeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A region queue which can be used concurrently without a lock. Regions are kept on a stack, so unlike
+ * MM_LockingHeapRegionQueue the order in which they are dequeued is LIFO, which is fine for lists of
+ * interchangeable regions such as the available lists. It does not keep a running total of the free bytes
+ * in its regions.
+ *
+ * The top of the stack is a single 64 bit word holding the region table index of the top region and a
+ * tag which is bumped by every update. Region descriptors are never freed and every update changes the
+ * tag, so a thread can walk several regions down from the top it read and claim all of them with a single
+ * compare and swap, which fails if the stack changed in the meantime (including the ABA case).
+ */
+class MM_LockFreeHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	volatile uint64_t _top; /**< Tag in the high half, region table index + 1 of the top region (0 when empty) in the low half */
+	MM_HeapRegionManager *_regionManager; /**< Maps between region descriptors and region table indices */
+
+public:
+	static MM_LockFreeHeapRegionQueue *newInstance(MM_EnvironmentBase *env, MM_HeapRegionManager *regionManager, RegionListKind regionListKind);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionQueue(MM_HeapRegionManager *regionManager, RegionListKind regionListKind) :
+		MM_HeapRegionQueue(regionListKind, true, false),
+		_top(0),
+		_regionManager(regionManager)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isEmpty() { return NULL == regionFromTop(MM_AtomicOperations::getU64(&_top)); }
+
+	virtual uintptr_t getTotalRegions() { return length(); }
+
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		pushChain(region, region, 1);
+	}
+
+	/**
+	 * Move all regions of src to the receiver.
+	 * @param srcAsPQ the source queue, which must also be a MM_LockFreeHeapRegionQueue
+	 */
+	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
+	{
+		MM_LockFreeHeapRegionQueue *src = (MM_LockFreeHeapRegionQueue *)srcAsPQ;
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t count = 0;
+		MM_HeapRegionDescriptorSegregated *front = src->popChain(UDATA_MAX, &back, &count);
+		if (NULL != front) {
+			pushChain(front, back, count);
+		}
+	}
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeue()
+	{
+		uintptr_t count = 0;
+		return popChain(1, NULL, &count);
+	}
+
+	/* check that the receiver is not empty before attempting the dequeue, using the top as _length lags behind it */
+	MM_HeapRegionDescriptorSegregated *dequeueIfNonEmpty()
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if (!isEmpty()) {
+			region = dequeue();
+		}
+		return region;
+	}
+
+	/**
+	 * Claim up to count regions with a single compare and swap and enqueue them on target.
+	 * @return the number of regions moved
+	 */
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+	{
+		uintptr_t moved = 0;
+		if (!isEmpty()) {
+			MM_HeapRegionDescriptorSegregated *region = popChain(count, NULL, &moved);
+			while (NULL != region) {
+				MM_HeapRegionDescriptorSegregated *next = region->getNext();
+				region->setNext(NULL);
+				target->enqueue(region);
+				region = next;
+			}
+		}
+		return moved;
+	}
+
+	/**
+	 * Unlink a region from anywhere in the queue. All regions are claimed at once and the others are pushed
+	 * back, so a concurrent dequeue may find the queue empty in the meantime.
+	 * @return true if the region was found in the queue
+	 */
+	bool
+	remove(MM_HeapRegionDescriptorSegregated *region)
+	{
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t count = 0;
+		MM_HeapRegionDescriptorSegregated *front = popChain(UDATA_MAX, &back, &count);
+		MM_HeapRegionDescriptorSegregated *previous = NULL;
+		MM_HeapRegionDescriptorSegregated *current = front;
+		while ((NULL != current) && (region != current)) {
+			previous = current;
+			current = current->getNext();
+		}
+		if (NULL != current) {
+			MM_HeapRegionDescriptorSegregated *next = current->getNext();
+			current->setNext(NULL);
+			count -= 1;
+			if (NULL == previous) {
+				front = next;
+			} else {
+				previous->setNext(next);
+			}
+			if (back == current) {
+				back = previous;
+			}
+		}
+		if (NULL != front) {
+			pushChain(front, back, count);
+		}
+		return NULL != current;
+	}
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+
+protected:
+private:
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	regionFromTop(uint64_t top)
+	{
+		uintptr_t indexPlusOne = (uintptr_t)(top & 0xFFFFFFFF);
+		return (0 == indexPlusOne) ? NULL : (MM_HeapRegionDescriptorSegregated *)_regionManager->mapRegionTableIndexToDescriptor(indexPlusOne - 1);
+	}
+
+	MMINLINE uint64_t
+	makeTop(uint64_t oldTop, MM_HeapRegionDescriptorSegregated *region)
+	{
+		uint64_t indexPlusOne = (NULL == region) ? 0 : ((uint64_t)_regionManager->mapDescriptorToRegionTableIndex(region) + 1);
+		return ((oldTop + ((uint64_t)1 << 32)) & ~(uint64_t)0xFFFFFFFF) | indexPlusOne;
+	}
+
+	/**
+	 * Push the chain [front, back] of count regions, linked through their next pointers.
+	 */
+	void
+	pushChain(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+	{
+		uint64_t oldTop = 0;
+		do {
+			oldTop = MM_AtomicOperations::getU64(&_top);
+			back->setNext(regionFromTop(oldTop));
+			/* the links must be visible before the regions can be reached from _top */
+			MM_AtomicOperations::storeSync();
+		} while (oldTop != MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, makeTop(oldTop, front)));
+		MM_AtomicOperations::add(&_length, count);
+	}
+
+	/**
+	 * Unlink up to maxCount regions from the top of the stack.
+	 * @param[out] back the last region unlinked, if not NULL
+	 * @param[out] count the number of regions unlinked
+	 * @return the first region unlinked (still linked to the rest through next pointers, the last one's next is NULL), or NULL
+	 */
+	MM_HeapRegionDescriptorSegregated *
+	popChain(uintptr_t maxCount, MM_HeapRegionDescriptorSegregated **back, uintptr_t *count)
+	{
+		uint64_t oldTop = 0;
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		MM_HeapRegionDescriptorSegregated *last = NULL;
+		uintptr_t popped = 0;
+		do {
+			oldTop = MM_AtomicOperations::getU64(&_top);
+			MM_AtomicOperations::loadSync();
+			front = regionFromTop(oldTop);
+			if (NULL == front) {
+				*count = 0;
+				return NULL;
+			}
+			/* The regions may be claimed by another thread while we walk them, in which case their links are
+			 * meaningless - but then the tag has moved on and the exchange below fails.
+			 */
+			last = front;
+			popped = 1;
+			while (popped < maxCount) {
+				MM_HeapRegionDescriptorSegregated *next = last->getNext();
+				if (NULL == next) {
+					break;
+				}
+				last = next;
+				popped += 1;
+			}
+		} while (oldTop != MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, makeTop(oldTop, last->getNext())));
+		MM_AtomicOperations::subtract(&_length, popped);
+
+		if (NULL != back) {
+			*back = last;
+		}
+		*count = popped;
+		last->setNext(NULL);
+		return front;
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONQUEUE_HPP_ */
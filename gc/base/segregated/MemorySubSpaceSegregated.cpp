@@ -166,6 +166,17 @@ MM_MemorySubSpaceSegregated::allocateMixedObjectOrArraylet(MM_EnvironmentBase *e
 
 		Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
 
+		/* finishing a concurrent sweep left over from the last collect may free enough to satisfy the allocate */
+		if (_memoryPoolSegregated->getRegionPool()->completeConcurrentSweep(env)) {
+			allocDescription->restoreObjects(env);
+			result = allocate(env, allocDescription, allocType);
+			if (NULL != result) {
+				reportAllocationFailureEnd(env);
+				return result;
+			}
+			allocDescription->saveObjects(env);
+		}
+
 		/* run the collector in the default mode (ie:  not explicitly aggressive) */
 		result = _collector->garbageCollect(env, this, allocDescription, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, NULL, NULL, NULL);
 		allocDescription->restoreObjects(env);
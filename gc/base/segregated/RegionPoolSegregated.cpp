@@ -32,7 +32,9 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeFreeHeapRegionList.hpp"
 #include "LockingFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "OMR_VMThread.hpp"
@@ -80,7 +82,8 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 		_smallSweepRegions[szClass] = NULL;
 	}
 
-	_singleFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_FREE, true);
+	/* Allocation contexts take single regions from the free list when the available lists run out, so it must not take a lock */
+	_singleFreeList = MM_LockFreeFreeHeapRegionList::newInstance(env, _heapRegionManager, MM_HeapRegionList::HRL_KIND_FREE);
 	_multiFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_MULTI_FREE, false);
 	_coalesceFreeList = MM_RegionPoolSegregated::allocateFreeHeapRegionList(env, MM_HeapRegionList::HRL_KIND_COALESCE, false);
 	if ((_singleFreeList == NULL) || (_multiFreeList == NULL) || (_coalesceFreeList == NULL)) {
@@ -90,15 +93,15 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
-			_smallAvailableRegions[szClass][i] = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			uintptr_t splitAvailableListsSize = sizeof(MM_LockFreeHeapRegionQueue) * _splitAvailableListSplitCount;
+			_smallAvailableRegions[szClass][i] = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 			if (NULL == _smallAvailableRegions[szClass][i]) {
 				return false;
 			}
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				/* Allocation contexts refill from the available lists, so they must not take a lock */
+				new (&regionQueue[j]) MM_LockFreeHeapRegionQueue(_heapRegionManager, MM_HeapRegionList::HRL_KIND_AVAILABLE);
 				if (!(&regionQueue[j])->initialize(env)) {
 					return false;
 				}
@@ -186,7 +189,7 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 	
 	for (int32_t szClass=OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (uintptr_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
 			if (NULL != regionQueueArray) {
 				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
 					(&regionQueueArray[j])->tearDown(env);
@@ -221,9 +224,9 @@ MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
+				regionQueue[j].dequeue(_smallSweepRegions[sizeClass], UDATA_MAX);
 			}
 		}
 		_initialCountOfSweepRegions[sizeClass] = _currentCountOfSweepRegions[sizeClass] = _smallSweepRegions[sizeClass]->getTotalRegions();
@@ -325,62 +328,83 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
-	uintptr_t splitIndex = env->getWorkerID() % _splitAvailableListSplitCount;
+	joinBucketListsForSplitIndex(env->getWorkerID() % _splitAvailableListSplitCount);
+}
+
+void
+MM_RegionPoolSegregated::joinBucketListsForSplitIndex(uintptr_t splitIndex)
+{
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+		MM_LockFreeHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
 			primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
 		}
 	}
 }
 
+/* join the lists for each buckets per size class, for all split indices */
+void
+MM_RegionPoolSegregated::joinBucketLists(MM_EnvironmentBase *env)
+{
+	for (uintptr_t splitIndex = 0; splitIndex < _splitAvailableListSplitCount; splitIndex++) {
+		joinBucketListsForSplitIndex(splitIndex);
+	}
+}
+
+bool
+MM_RegionPoolSegregated::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	return (NULL != _sweepScheme) && _sweepScheme->completeConcurrentSweep(env);
+}
+
 /**
- * Attempt to allocate a region from the given size classes available list.
- * If there are no available regions in this size class, return null.
+ * Attempt to allocate regions from the given size classes available lists.
+ * All regions come from the first list found not to be empty, claimed in a single operation.
+ * If there are no available regions in this size class, return 0.
  */
-MM_HeapRegionDescriptorSegregated *
-MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass)
+uintptr_t
+MM_RegionPoolSegregated::allocateRegionsFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, MM_HeapRegionQueue *target, uintptr_t count)
 {
-	MM_HeapRegionDescriptorSegregated *region = NULL;
+	uintptr_t moved = 0;
 	/* skip searching the available queue for this size class if we've already exhausted all available regions */
 	if (SKIP_AVAILABLE_REGION_FOR_ALLOCATION == _skipAvailableRegionForAllocation[sizeClass]) {
-		return region;
+		return moved;
 	}
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
-	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
-	region = allocationQueue->dequeueIfNonEmpty();
-	if (region != NULL) {
-		return region;
+	MM_LockFreeHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
+	MM_LockFreeHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	moved = allocationQueue->dequeue(target, count);
+	if (0 != moved) {
+		return moved;
 	}
 
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
 		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
-		region = allocationQueue->dequeueIfNonEmpty();
-		if (region != NULL) {
-			return region;
+		moved = allocationQueue->dequeue(target, count);
+		if (0 != moved) {
+			return moved;
 		}
 	}
 
 	/* if all split lists in the primary bucket fail, try the remaining buckets */
 	if (_isSweepingSmall) {
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
+			MM_LockFreeHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
 				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
-				region = allocationQueue->dequeueIfNonEmpty();
-				if (region != NULL) {
-					return region;
+				moved = allocationQueue->dequeue(target, count);
+				if (0 != moved) {
+					return moved;
 				}
 			}
 		}
 	} else {
 		_skipAvailableRegionForAllocation[sizeClass] = SKIP_AVAILABLE_REGION_FOR_ALLOCATION;
 	}
-	return region;
+	return moved;
 }
 
 /**
@@ -28,6 +28,7 @@
 
 #include "HeapRegionList.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "RegionPool.hpp"
 #include "SweepSchemeSegregated.hpp"
@@ -38,6 +39,7 @@ class MM_EnvironmentBase;
 class MM_FreeHeapRegionList;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
+class MM_LockFreeHeapRegionQueue;
 class MM_LockingHeapRegionQueue;
 
 #define PRIMARY_BUCKET 0
@@ -79,7 +81,7 @@ private:
 	 * defragmentation purposes prefers the least occupied regions while allocation prefers the
 	 * most occupied.
 	*/
-	MM_LockingHeapRegionQueue *_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
+	MM_LockFreeHeapRegionQueue *_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
 	
 	/** 
 	 * @note Some of the full regions may be attached to AllocationContexts, and thus being actively
@@ -157,6 +159,8 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	void joinBucketListsForSplitIndex(uintptr_t splitIndex);
 	
 protected:
 public:
@@ -171,7 +175,11 @@ public:
 	static MM_HeapRegionQueue* allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes);
 	static MM_FreeHeapRegionList* allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly);
 	MM_HeapRegionDescriptorSegregated *allocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t szClass, uintptr_t maxExcess);
-	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	/**
+	 * Move up to count available regions of the size class to target, claiming them from a single available list.
+	 * @return the number of regions moved
+	 */
+	uintptr_t allocateRegionsFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, MM_HeapRegionQueue *target, uintptr_t count);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
@@ -239,10 +247,13 @@ public:
 
 	void setSweepSmallPages(bool sweepSmall) { _isSweepingSmall = sweepSmall; }
 	void resetSkipAvailableRegionForAllocation() { memset(&_skipAvailableRegionForAllocation[0], 0, sizeof(_skipAvailableRegionForAllocation)); }
+	void resetSkipAvailableRegionForAllocation(uintptr_t sizeClass) { _skipAvailableRegionForAllocation[sizeClass] = 0; }
+	bool isSmallSizeClassExhausted(uintptr_t sizeClass) { return SKIP_AVAILABLE_REGION_FOR_ALLOCATION == _skipAvailableRegionForAllocation[sizeClass]; }
 
 	void updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy);
 	
 
+	MMINLINE MM_HeapRegionManager *getHeapRegionManager() { return _heapRegionManager; }
 	MMINLINE MM_FreeHeapRegionList *getSingleFreeList() { return _singleFreeList; }
 	MMINLINE MM_FreeHeapRegionList *getMultiFreeList() { return _multiFreeList; }
 	MMINLINE MM_FreeHeapRegionList *getCoalesceFreeList() { return _coalesceFreeList; }
@@ -251,12 +262,19 @@ public:
 	MMINLINE MM_HeapRegionQueue *getArrayletSweepRegions() { return _arrayletSweepRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletFullRegions() { return _arrayletFullRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletAvailableRegions() { return _arrayletAvailableRegions; }
-	MMINLINE MM_LockingHeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return &_smallAvailableRegions[sizeClass][defragBucket][splitList]; }
+	MMINLINE MM_LockFreeHeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return &_smallAvailableRegions[sizeClass][defragBucket][splitList]; }
 	MMINLINE MM_HeapRegionQueue *getSmallSweepRegions(uintptr_t sizeClass) { return _smallSweepRegions[sizeClass]; }
 	MMINLINE MM_HeapRegionQueue *getSmallFullRegions(uintptr_t sizeClass) { return _smallFullRegions[sizeClass]; }
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
 
 	void joinBucketListsForSplitIndex(MM_EnvironmentBase *env);
+	void joinBucketLists(MM_EnvironmentBase *env);
+
+	/**
+	 * Finish a concurrent sweep of the small regions, if one is in progress. Called with exclusive VM access.
+	 * @return true if a concurrent sweep was in progress (and so regions may have been freed)
+	 */
+	bool completeConcurrentSweep(MM_EnvironmentBase *env);
 	
 	void setSweepScheme(MM_SweepSchemeSegregated *sweepScheme) { _sweepScheme = sweepScheme; }
 
@@ -20,6 +20,8 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "omrutil.h"
+
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -33,6 +35,12 @@
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
+#include "SegregatedYoungMarkTask.hpp"
+#include "SublistFragment.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
@@ -48,6 +56,9 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/* Regions a background sweep thread sweeps between checks for an exclusive access request */
+#define SWEEP_HELPER_REGIONS_PER_STEP 16
+
 /**
  * Initialization
  */
@@ -94,6 +105,12 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (0 != omrthread_monitor_init_with_name(&_sweepHelpersMonitor, 0, "MM_SegregatedGC::sweepHelpers")) {
+		_sweepHelpersMonitor = NULL;
+		return false;
+	}
+
 	return true;
 }
 
@@ -112,6 +129,16 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	if (NULL != _sweepHelpersTable) {
+		env->getForge()->free(_sweepHelpersTable);
+		_sweepHelpersTable = NULL;
+	}
+
+	if (NULL != _sweepHelpersMonitor) {
+		omrthread_monitor_destroy(_sweepHelpersMonitor);
+		_sweepHelpersMonitor = NULL;
+	}
 }
 
 bool
@@ -129,12 +156,196 @@ MM_SegregatedGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *sub
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
+	/* The background sweep threads are started by the first concurrent sweep, as they can not attach before the heap exists */
 	return true;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	shutdownSweepHelpers(extensions);
+}
+
+int J9THREAD_PROC
+MM_SegregatedGC::sweepHelperThreadProc(void *info)
+{
+	MM_SegregatedGC *collector = (MM_SegregatedGC *)info;
+	MM_GCExtensionsBase *extensions = collector->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(sweepHelperThreadProc2, info,
+			extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+uintptr_t
+MM_SegregatedGC::sweepHelperThreadProc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_SegregatedGC *collector = (MM_SegregatedGC *)info;
+
+	/* The thread is started by a collection, so this waits for the collection to release exclusive access */
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(collector->_extensions->getOmrVM(), "Segregated Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	if (NULL != omrThread) {
+		collector->sweepHelperEntryPoint(omrThread);
+	} else {
+		/* The concurrent sweep is left to the mutators and to the next collection */
+		omrthread_monitor_enter(collector->_sweepHelpersMonitor);
+		collector->_sweepHelpersShutdownCount += 1;
+		omrthread_monitor_notify_all(collector->_sweepHelpersMonitor);
+		omrthread_exit(collector->_sweepHelpersMonitor);
+	}
+
+	return 0;
+}
+
+void
+MM_SegregatedGC::sweepHelperEntryPoint(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	SweepHelperRequest request = SWEEP_HELPER_WAIT;
+
+	env->initializeGCThread();
+
+	while (SWEEP_HELPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		while (SWEEP_HELPER_WAIT == (request = _sweepHelpersRequest)) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+
+		if (SWEEP_HELPER_SHUTDOWN == request) {
+			continue;
+		}
+
+		/* Sweep in small steps so a thread requesting exclusive access is not held up for long */
+		env->acquireVMAccess();
+		request = getSweepHelperRequest(env);
+		while ((SWEEP_HELPER_SWEEP == request) && (0 != _sweepScheme->sweepQueuedSmallRegions(env, SWEEP_HELPER_REGIONS_PER_STEP))) {
+			request = getSweepHelperRequest(env);
+		}
+		env->releaseVMAccess();
+
+		/* With the queues drained, finish the sweep so that its statistics count every region. This needs exclusive
+		 * access, which a collection may have been given first, in which case there may be a new sweep to help with.
+		 */
+		bool sweepLeft = false;
+		if (SWEEP_HELPER_SWEEP == getSweepHelperRequest(env)) {
+			env->acquireExclusiveVMAccess();
+			sweepLeft = !_sweepScheme->finishDrainedConcurrentSweep(env) && _sweepScheme->isConcurrentSweepInProgress();
+			env->releaseExclusiveVMAccess();
+		}
+
+		/* Wait until the next concurrent sweep is started */
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		if ((SWEEP_HELPER_SWEEP == _sweepHelpersRequest) && !sweepLeft) {
+			_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+			omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		}
+		request = _sweepHelpersRequest;
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	_sweepHelpersShutdownCount += 1;
+	omrthread_monitor_notify_all(_sweepHelpersMonitor);
+	omrthread_exit(_sweepHelpersMonitor);
+}
+
+MM_SegregatedGC::SweepHelperRequest
+MM_SegregatedGC::getSweepHelperRequest(MM_EnvironmentBase *env)
+{
+	SweepHelperRequest result;
+
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	if (env->isExclusiveAccessRequestWaiting()) {
+		if (SWEEP_HELPER_SWEEP == _sweepHelpersRequest) {
+			_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+		}
+	}
+	result = _sweepHelpersRequest;
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+
+	return result;
+}
+
+/**
+ * Background sweep threads are attached with minimum priority, so they only use cycles the application leaves spare.
+ * They are not waited for: they attach once the collection starting them releases exclusive access.
+ */
+bool
+MM_SegregatedGC::startSweepHelpers(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = _extensions->concurrentSweepSegregatedThreads;
+	_sweepHelpersTable = (omrthread_t *)env->getForge()->allocate(threadCount * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sweepHelpersTable) {
+		return false;
+	}
+	memset(_sweepHelpersTable, 0, threadCount * sizeof(omrthread_t));
+
+	uintptr_t started = 0;
+	for (; started < threadCount; started++) {
+		intptr_t threadForkResult = createThreadWithCategory(&_sweepHelpersTable[started],
+							OMR_OS_STACK_SIZE,
+							J9THREAD_PRIORITY_MIN,
+							0,
+							sweepHelperThreadProc,
+							(void *)this,
+							J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+		if (0 != threadForkResult) {
+			break;
+		}
+	}
+	_sweepHelpersStarted = started;
+
+	return (_sweepHelpersStarted == threadCount);
+}
+
+void
+MM_SegregatedGC::shutdownSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	if (0 < _sweepHelpersStarted) {
+		omrthread_monitor_enter(_sweepHelpersMonitor);
+		_sweepHelpersRequest = SWEEP_HELPER_SHUTDOWN;
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+		while (_sweepHelpersShutdownCount < _sweepHelpersStarted) {
+			omrthread_monitor_wait(_sweepHelpersMonitor);
+		}
+		_sweepHelpersStarted = 0;
+		_sweepHelpersShutdownCount = 0;
+		omrthread_monitor_exit(_sweepHelpersMonitor);
+	}
+}
+
+void
+MM_SegregatedGC::resumeSweepHelpers(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	if ((NULL == _sweepHelpersTable) && (0 < _extensions->concurrentSweepSegregatedThreads)) {
+		if (!startSweepHelpers(env)) {
+			Trc_MM_SegregatedGC_sweepHelpersNotStarted(env->getLanguageVMThread(), _sweepHelpersStarted, _extensions->concurrentSweepSegregatedThreads);
+		}
+	}
+	if ((0 < _sweepHelpersStarted) && (SWEEP_HELPER_WAIT == _sweepHelpersRequest)) {
+		_sweepHelpersRequest = SWEEP_HELPER_SWEEP;
+		omrthread_monitor_notify_all(_sweepHelpersMonitor);
+	}
+	omrthread_monitor_exit(_sweepHelpersMonitor);
+}
+
+void
+MM_SegregatedGC::waitForSweepHelpers(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_sweepHelpersMonitor);
+	while ((SWEEP_HELPER_SWEEP == _sweepHelpersRequest) && (_sweepHelpersShutdownCount < _sweepHelpersStarted)) {
+		omrthread_monitor_wait(_sweepHelpersMonitor);
+	}
+	omrthread_monitor_exit(_sweepHelpersMonitor);
 }
 
 void *
@@ -185,6 +396,9 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
+	/* Regions left unswept by the previous cycle still hold its marks, which must be cleared before marking */
+	_sweepScheme->completeConcurrentSweep(env);
+
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
 	 * we really need to do this here? */
 	/* Flush the allocation contexts */
@@ -203,12 +417,31 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 //	}
 
+	bool youngCollection = false;
+	if (_extensions->segregatedYoungCollection) {
+		flushRememberedSetFragments(env);
+		youngCollection = shouldCollectYoung(env);
+		Trc_MM_SegregatedGC_collectionStart(env->getLanguageVMThread(), youngCollection ? "young" : "full", _youngCollectionsSinceFullCollection, _extensions->rememberedSet.countElements());
+	}
+
 	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	if (youngCollection) {
+		/* The objects marked by the previous collection are old, only the objects reachable from the roots and the
+		 * remembered set through young objects are marked */
+		_youngCollectionsSinceFullCollection += 1;
+		markYoungObjects(env);
+	} else {
+		if (_extensions->segregatedYoungCollection) {
+			_youngCollectionsSinceFullCollection = 0;
+			clearRememberedSet(env);
+		}
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
+	markStats->_youngMark = youngCollection;
 
 	/* Do any post mark checks */
 	/* OMRTODO we need to implement this function for segregated marking scheme */
@@ -244,9 +477,107 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
 	}
 
+	/* The background sweep threads start once the mutators are released */
+	if (_sweepScheme->isConcurrentSweepInProgress()) {
+		resumeSweepHelpers(env);
+	}
+
 	return true;
 }
 
+bool
+MM_SegregatedGC::shouldCollectYoung(MM_EnvironmentBase *env)
+{
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+	/* An aggressive collection follows a young collection which did not free enough memory */
+	return !_rememberedSetOverflow
+		&& (_youngCollectionsSinceFullCollection < _extensions->segregatedYoungCollectionsPerFullCollection)
+		&& !gcCode.isExplicitGC()
+		&& !gcCode.isAggressiveGC()
+		&& !gcCode.isOutOfMemoryGC();
+}
+
+void
+MM_SegregatedGC::flushRememberedSetFragments(MM_EnvironmentBase *env)
+{
+	GC_OMRVMThreadListIterator vmThreadListIterator(env->getOmrVM());
+	while (OMR_VMThread *thread = vmThreadListIterator.nextOMRVMThread()) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(thread);
+		MM_SublistFragment::flush(&walkEnv->_segregatedRememberedSet);
+	}
+}
+
+void
+MM_SegregatedGC::markYoungObjects(MM_EnvironmentBase *env)
+{
+	MM_SegregatedYoungMarkTask markTask(env, _dispatcher, this, _markingScheme, env->_cycleState);
+	_dispatcher->run(env, &markTask);
+	_extensions->rememberedSet.clear(env);
+}
+
+void
+MM_SegregatedGC::clearRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			/* the unused entries of flushed fragments are NULL */
+			if (NULL != *slotPtr) {
+				_extensions->objectModel.clearRemembered(*slotPtr);
+			}
+		}
+	}
+	_extensions->rememberedSet.clear(env);
+	_rememberedSetOverflow = false;
+}
+
+void
+MM_SegregatedGC::scanRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				omrobjectptr_t objectPtr = *slotPtr;
+				if (NULL != objectPtr) {
+					Assert_MM_true(_markingScheme->isMarked(objectPtr));
+					_extensions->objectModel.clearRemembered(objectPtr);
+					env->_workStack.push(env, objectPtr);
+					env->_markStats._rememberedObjectsScanned += 1;
+				}
+			}
+		}
+	}
+}
+
+void
+MM_SegregatedGC::addToRememberedSet(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	if (env->_segregatedRememberedSet.fragmentCurrent >= env->_segregatedRememberedSet.fragmentTop) {
+		/* There wasn't enough room in the current fragment - allocate a new one */
+		MM_SublistFragment fragment((J9VMGC_SublistFragment *)&env->_segregatedRememberedSet);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment *)&env->_segregatedRememberedSet);
+		if (!_extensions->rememberedSet.allocate(env, &fragment)) {
+			/* The object is left unremembered (so it is not mistaken for a remembered object later) and the
+			 * next collection is full */
+			_rememberedSetOverflow = true;
+			_extensions->objectModel.atomicSetObjectFlags(objectPtr, OMR_OBJECT_METADATA_REMEMBERED_BITS, STATE_NOT_REMEMBERED);
+			return;
+		}
+	}
+
+	/* There is at least 1 free entry in the fragment - use it */
+	env->_segregatedRememberedSet.count++;
+	uintptr_t *rememberedSetEntry = env->_segregatedRememberedSet.fragmentCurrent++;
+	*rememberedSetEntry = (uintptr_t)objectPtr;
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -511,6 +842,9 @@ MM_SegregatedGC::reportGCIncrementStart(MM_EnvironmentBase *env)
 		Assert_MM_unreachable();
 	}
 
+	/* task stats cover this increment only */
+	_extensions->dispatcher->clearTaskStats(env);
+
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_START(
 		_extensions->privateHookInterface,
 		env->getOmrVMThread(),
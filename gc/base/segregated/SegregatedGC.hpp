@@ -49,6 +49,20 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the main cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 private:
+	typedef enum {
+		SWEEP_HELPER_WAIT = 1,
+		SWEEP_HELPER_SWEEP,
+		SWEEP_HELPER_SHUTDOWN
+	} SweepHelperRequest;
+
+	omrthread_monitor_t _sweepHelpersMonitor; /**< Protects the request and thread counts, and wakes the background sweep threads */
+	omrthread_t *_sweepHelpersTable; /**< Background sweep threads */
+	uintptr_t _sweepHelpersStarted; /**< Number of background sweep threads started */
+	uintptr_t _sweepHelpersShutdownCount; /**< Number of background sweep threads which have exited, or failed to attach */
+	volatile SweepHelperRequest _sweepHelpersRequest; /**< What the background sweep threads should be doing */
+
+	uintptr_t _youngCollectionsSinceFullCollection; /**< Number of young collections since the last full collection */
+	volatile bool _rememberedSetOverflow; /**< True if an old object could not be remembered, in which case the next collection must be full */
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
 	uintptr_t _scanBytes;
@@ -58,6 +72,32 @@ public:
 	 * Function members
 	 */
 private:
+	static int J9THREAD_PROC sweepHelperThreadProc(void *info);
+	static uintptr_t sweepHelperThreadProc2(OMRPortLibrary *portLib, void *info);
+	void sweepHelperEntryPoint(OMR_VMThread *omrThread);
+	SweepHelperRequest getSweepHelperRequest(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the threads which sweep small regions left queued by a concurrent sweep. Called with the helpers monitor held.
+	 * @return true if all threads started
+	 */
+	bool startSweepHelpers(MM_EnvironmentBase *env);
+	void shutdownSweepHelpers(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Wake the background sweep threads once a concurrent sweep has been started, starting them the first time.
+	 */
+	void resumeSweepHelpers(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the collection about to start only has to collect the objects allocated since the previous collection
+	 */
+	bool shouldCollectYoung(MM_EnvironmentBase *env);
+
+	/**
+	 * Empty the remembered set before a full collection, which does not need it.
+	 */
+	void clearRememberedSet(MM_EnvironmentBase *env);
 protected:
 	void reportGCIncrementStart(MM_EnvironmentBase *env);
 	void reportGCIncrementEnd(MM_EnvironmentBase *env);
@@ -112,6 +152,52 @@ public:
 		return _sweepScheme;
 	}
 
+	/**
+	 * Wait until the background sweep threads have swept and finished the current concurrent sweep, or have
+	 * backed off for a collection. Must not be called with VM access, as the sweep is finished under exclusive access.
+	 */
+	void waitForSweepHelpers(MM_EnvironmentBase *env);
+
+	/**
+	 * Generational write barrier for young collections (segregatedYoungCollection). The objects which survived the
+	 * previous collection are old and are still marked, the objects allocated since are young and are not, so
+	 * an old object is remembered when a reference to a young object is stored into it.
+	 * @param parentObject the object stored into
+	 * @param childObject the reference stored
+	 */
+	virtual void
+	generationalWriteBarrier(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		MM_MarkMap *markMap = _markingScheme->getMarkMap();
+		if ((NULL != childObject) && markMap->isBitSet(parentObject) && !markMap->isBitSet(childObject)) {
+			if (_extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
+				addToRememberedSet(env, parentObject);
+			}
+		}
+	}
+
+	/**
+	 * Record a newly remembered object in the thread's remembered set fragment.
+	 */
+	void addToRememberedSet(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Flush the remembered set fragments of all threads to the remembered set.
+	 */
+	void flushRememberedSetFragments(MM_EnvironmentBase *env);
+
+	/**
+	 * Mark the objects allocated since the previous collection which are reachable from the roots or from the
+	 * remembered set, leaving the marks of the old objects in place, and empty the remembered set.
+	 */
+	void markYoungObjects(MM_EnvironmentBase *env);
+
+	/**
+	 * Push the remembered objects onto the work stack to be scanned as roots of a young collection and forget
+	 * them, as every object they refer to is old once the collection completes. Called by all GC threads.
+	 */
+	void scanRememberedSet(MM_EnvironmentBase *env);
+
 	MM_SegregatedGC(MM_EnvironmentBase *env)
 		: MM_GlobalCollector()
 		, _extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
@@ -119,6 +205,13 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _sweepHelpersMonitor(NULL)
+		, _sweepHelpersTable(NULL)
+		, _sweepHelpersStarted(0)
+		, _sweepHelpersShutdownCount(0)
+		, _sweepHelpersRequest(SWEEP_HELPER_WAIT)
+		, _youngCollectionsSinceFullCollection(0)
+		, _rememberedSetOverflow(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
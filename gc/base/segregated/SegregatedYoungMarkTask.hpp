@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDYOUNGMARKTASK_HPP_)
+#define SEGREGATEDYOUNGMARKTASK_HPP_
+
+#include "omrmodroncore.h"
+
+#include "ParallelMarkTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_SegregatedGC;
+
+/**
+ * Mark task of a young collection of the segregated heap. The mark map is not cleared, so the objects which
+ * survived the previous collection are still marked and are neither traced nor freed, and the objects of the
+ * remembered set are scanned as roots.
+ */
+class MM_SegregatedYoungMarkTask : public MM_ParallelMarkTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedGC *_collector;
+	MM_MarkingScheme *_markingScheme;
+
+/* Methods */
+public:
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_SegregatedYoungMarkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_SegregatedGC *collector, MM_MarkingScheme *markingScheme, MM_CycleState *cycleState)
+		: MM_ParallelMarkTask(env, dispatcher, markingScheme, false, cycleState)
+		, _collector(collector)
+		, _markingScheme(markingScheme)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDYOUNGMARKTASK_HPP_ */
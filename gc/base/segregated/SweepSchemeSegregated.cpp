@@ -23,6 +23,7 @@
 #include "omrcomp.h"
 #include "sizeclasses.h"
 #include "ModronAssertions.h"
+#include "ut_j9mm.h"
 
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
@@ -118,16 +119,99 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
-	regionPool->joinBucketListsForSplitIndex(env);
+	/* A concurrent sweep leaves the small regions queued for mutators to sweep on demand and for the
+	 * background sweep threads to drain, so the pause only covers the arraylet and large regions.
+	 */
+	bool concurrentSweep = _extensions->concurrentSweepSegregated && !_isFixHeapForWalk;
+	if (!concurrentSweep) {
+		incrementalSweepSmall(env);
+		regionPool->joinBucketListsForSplitIndex(env);
+	}
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		regionPool->setSweepSmallPages(false);
-		postSweep(env);
+		if (concurrentSweep && (0 != regionPool->getCurrentTotalCountOfSweepRegions())) {
+			/* allocation must keep searching all defragmentation buckets until the sweep completes, which is
+			 * when the sweep is post processed, so that it accounts for every region */
+			_concurrentSweepInProgress = true;
+			Trc_MM_SweepSchemeSegregated_concurrentSweepStarted(env->getLanguageVMThread(), regionPool->getCurrentTotalCountOfSweepRegions());
+		} else {
+			regionPool->setSweepSmallPages(false);
+			postSweep(env);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+uintptr_t
+MM_SweepSchemeSegregated::sweepQueuedSmallRegions(MM_EnvironmentBase *env, uintptr_t maxRegions)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_SizeClasses *sizeClasses = _extensions->defaultSizeClasses;
+	uintptr_t splitIndex = env->getEnvironmentId() % regionPool->getSplitAvailableListSplitCount();
+	uintptr_t sweptRegions = 0;
+
+	/* Visit the size classes round robin, like the stop-the-world sweep, so every size class soon has regions to allocate from */
+	bool progress = true;
+	while (_concurrentSweepInProgress && progress && (sweptRegions < maxRegions) && !env->isExclusiveAccessRequestWaiting()) {
+		progress = false;
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; (sizeClass <= OMR_SIZECLASSES_MAX_SMALL) && (sweptRegions < maxRegions); sizeClass++) {
+			if (0 != regionPool->getCurrentCountOfSweepRegions(sizeClass)) {
+				uintptr_t regionsPerIteration = OMR_MIN(calcSweepSmallRegionsPerIteration(sizeClasses->getNumCells(sizeClass)), maxRegions - sweptRegions);
+				uintptr_t count = sweepSmallRegionsForSizeClass(env, sizeClass, regionsPerIteration, splitIndex);
+				sweptRegions += count;
+				progress = progress || (0 != count);
+			}
+		}
+	}
+	return sweptRegions;
+}
+
+bool
+MM_SweepSchemeSegregated::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	if (!_concurrentSweepInProgress) {
+		return false;
+	}
+
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	uintptr_t remainingRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+	uintptr_t splitIndex = env->getEnvironmentId() % regionPool->getSplitAvailableListSplitCount();
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		while (0 != sweepSmallRegionsForSizeClass(env, sizeClass, UDATA_MAX, splitIndex)) {}
+	}
+
+	finishConcurrentSweep(env, remainingRegions);
+	return true;
+}
+
+bool
+MM_SweepSchemeSegregated::finishDrainedConcurrentSweep(MM_EnvironmentBase *env)
+{
+	/* nothing can be sweeping a region it dequeued while the caller has exclusive access */
+	if (!_concurrentSweepInProgress || (0 != _memoryPool->getRegionPool()->getCurrentTotalCountOfSweepRegions())) {
+		return false;
+	}
+
+	finishConcurrentSweep(env, 0);
+	return true;
+}
+
+void
+MM_SweepSchemeSegregated::finishConcurrentSweep(MM_EnvironmentBase *env, uintptr_t regionsSweptExclusively)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	Assert_MM_true(0 == regionPool->getCurrentTotalCountOfSweepRegions());
+
+	regionPool->joinBucketLists(env);
+	regionPool->setSweepSmallPages(false);
+	_concurrentSweepInProgress = false;
+
+	/* regions emptied since the pause have not been coalesced yet */
+	postSweep(env);
+
+	Trc_MM_SweepSchemeSegregated_concurrentSweepCompleted(env->getLanguageVMThread(), regionsSweptExclusively);
+}
+
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
@@ -387,7 +471,12 @@ MM_SweepSchemeSegregated::incrementalCoalesceFreeRegions(MM_EnvironmentBase *env
 	uintptr_t yieldSlackTime = resetCoalesceFreeRegionCount(env);
 	yieldFromSweep(env, yieldSlackTime);
 
-	coalesceFreeList->push(regionPool->getSingleFreeList());
+	/* The single free list is lock free and can only hand over its regions one at a time */
+	MM_FreeHeapRegionList *singleFreeList = regionPool->getSingleFreeList();
+	MM_HeapRegionDescriptorSegregated *freeRegion = NULL;
+	while (NULL != (freeRegion = singleFreeList->pop())) {
+		coalesceFreeList->push(freeRegion);
+	}
 	coalesceFreeList->push(regionPool->getMultiFreeList());
 	
 	MM_HeapRegionDescriptorSegregated *coalescing = NULL;
@@ -499,7 +588,6 @@ void
 MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *ext = env->getExtensions();
-	bool shouldUpdateOccupancy = ext->nonDeterministicSweep;
 	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
 	uintptr_t splitIndex = env->getWorkerID() % (regionPool->getSplitAvailableListSplitCount());
 
@@ -523,50 +611,61 @@ MM_SweepSchemeSegregated::incrementalSweepSmall(MM_EnvironmentBase *env)
 					break;
 				}
 				
-				MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
-				MM_HeapRegionDescriptorSegregated *currentRegion;
-				uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
-				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(numCells);
-				uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, sweepSmallRegionsPerIteration);
-				uintptr_t actualSweepRegions;
-				if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), sweepSmallRegionsPerIteration)) > 0) {
-					regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
-					regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
-					uintptr_t freedRegions = 0, processedRegions = 0;
-					MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
-					while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
-						sweepRegion(env, currentRegion);
-						if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
-							uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
-							/* Maintain average occupancy needed for nondeterministic sweep heuristic */
-							if (shouldUpdateOccupancy) {
-								regionPool->updateOccupancy(sizeClass, occupancy);
-							}
-							if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
-								/* Return full regions to full list */
-								fullList->enqueue(currentRegion);
-							} else {
-								regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
-							}
-						} else {
-							currentRegion->emptyRegionReturned(env);
-							currentRegion->setFree(1);
-							env->getRegionLocalFree()->enqueue(currentRegion);
-							freedRegions++;
-						}
-						processedRegions++;
-						
-						if (updateSweepSmallRegionCount()) {
-							yieldFromSweep(env, yieldSlackTime);
-						}
-					}
-					regionPool->addSingleFree(env, env->getRegionLocalFree());				
-					regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
-					yieldFromSweep(env, yieldSlackTime);
-				}
+				uintptr_t sweepSmallRegionsPerIteration = calcSweepSmallRegionsPerIteration(sizeClasses->getNumCells(sizeClass));
+				sweepSmallRegionsForSizeClass(env, sizeClass, sweepSmallRegionsPerIteration, splitIndex);
 			} /* end of while(currentTotalCountOfSweepRegions); */
 		}
 	}
 }
 
+/**
+ * Sweep up to maxRegions queued small regions of one size class, returning each region to the
+ * full, available or free lists according to what the sweep found.
+ * @return the number of regions swept
+ */
+uintptr_t
+MM_SweepSchemeSegregated::sweepSmallRegionsForSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t maxRegions, uintptr_t splitIndex)
+{
+	bool shouldUpdateOccupancy = _extensions->nonDeterministicSweep;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
+	MM_HeapRegionDescriptorSegregated *currentRegion;
+	uintptr_t numCells = _extensions->defaultSizeClasses->getNumCells(sizeClass);
+	uintptr_t yieldSlackTime = resetSweepSmallRegionCount(env, maxRegions);
+	uintptr_t actualSweepRegions;
+	if ((actualSweepRegions = sweepList->dequeue(env->getRegionWorkList(), maxRegions)) > 0) {
+		regionPool->decrementCurrentCountOfSweepRegions(sizeClass, actualSweepRegions);
+		regionPool->decrementCurrentTotalCountOfSweepRegions(actualSweepRegions);
+		MM_HeapRegionQueue *fullList = env->getRegionLocalFull();
+		while ((currentRegion = env->getRegionWorkList()->dequeue()) != NULL) {
+			sweepRegion(env, currentRegion);
+			if (currentRegion->getMemoryPoolACL()->getFreeCount() < numCells) {
+				uintptr_t occupancy = (currentRegion->getMemoryPoolACL()->getMarkCount() * 100) / numCells;
+				/* Maintain average occupancy needed for nondeterministic sweep heuristic */
+				if (shouldUpdateOccupancy) {
+					regionPool->updateOccupancy(sizeClass, occupancy);
+				}
+				if (currentRegion->getMemoryPoolACL()->getMarkCount() == numCells) {
+					/* Return full regions to full list */
+					fullList->enqueue(currentRegion);
+				} else {
+					regionPool->enqueueAvailable(currentRegion, sizeClass, occupancy, splitIndex);
+				}
+			} else {
+				currentRegion->emptyRegionReturned(env);
+				currentRegion->setFree(1);
+				env->getRegionLocalFree()->enqueue(currentRegion);
+			}
+
+			if (updateSweepSmallRegionCount()) {
+				yieldFromSweep(env, yieldSlackTime);
+			}
+		}
+		regionPool->addSingleFree(env, env->getRegionLocalFree());
+		regionPool->getSmallFullRegions(sizeClass)->enqueue(fullList);
+		yieldFromSweep(env, yieldSlackTime);
+	}
+	return actualSweepRegions;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -54,6 +54,7 @@ protected:
 private:
 	bool _isFixHeapForWalk;
 	bool _clearMarkMapAfterSweep; /**< If a region should be unmarked after it is swept */
+	volatile bool _concurrentSweepInProgress; /**< If small regions were left queued by the last sweep, to be swept while mutators run */
 
 	/*
 	 * Function members
@@ -67,6 +68,30 @@ public:
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
+	/**
+	 * Sweep small regions left queued by a concurrent sweep, on behalf of a background sweep thread.
+	 * The caller must hold VM access. Returns early if exclusive access is requested.
+	 * @param maxRegions the maximum number of regions to sweep
+	 * @return the number of regions swept
+	 */
+	uintptr_t sweepQueuedSmallRegions(MM_EnvironmentBase *env, uintptr_t maxRegions);
+
+	/**
+	 * Sweep any small regions still queued by a concurrent sweep and return the regions
+	 * to the state a stop-the-world sweep would have left them in. Called with exclusive VM access.
+	 * @return true if a concurrent sweep was in progress
+	 */
+	bool completeConcurrentSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Finish a concurrent sweep once the mutators and the background sweep threads have swept every region it
+	 * left queued, post processing it as the stop-the-world sweep would have. Called with exclusive VM access.
+	 * @return true if a concurrent sweep was finished, false if none was in progress or regions are still queued
+	 */
+	bool finishDrainedConcurrentSweep(MM_EnvironmentBase *env);
+
+	bool isConcurrentSweepInProgress() { return _concurrentSweepInProgress; }
+
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
 protected:
@@ -88,6 +113,7 @@ protected:
 		,_extensions(env->getExtensions())
 		,_isFixHeapForWalk(false)
 		,_clearMarkMapAfterSweep(true)
+		,_concurrentSweepInProgress(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -99,8 +125,10 @@ private:
 	void sweepLargeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
+	uintptr_t sweepSmallRegionsForSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t maxRegions, uintptr_t splitIndex);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
+	void finishConcurrentSweep(MM_EnvironmentBase *env, uintptr_t regionsSweptExclusively);
 
 	MMINLINE bool addFreeChunk(MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t *freeChunk, uintptr_t freeChunkSize, uintptr_t minimumFreeEntrySize, uintptr_t freeChunkCellCount)
 	{
@@ -46,6 +46,8 @@
 #include "HeapStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -286,6 +288,15 @@ MM_CompactScheme::initialize(MM_EnvironmentBase *env)
 void
 MM_CompactScheme::tearDown(MM_EnvironmentBase *env)
 {
+	OMR::GC::Forge *forge = env->getForge();
+
+	if (NULL != _slideChunkTable) {
+		forge->free(_slideChunkTable);
+		_slideChunkTable = NULL;
+	}
+	_extensions->memoryManager->destroyVirtualMemory(env, &_slideTablesMemoryHandle);
+	_slideWindowTable = NULL;
+	_slideBlockOffsets = NULL;
 	_delegate.tearDown(env);
 }
 
@@ -563,45 +574,71 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Sliding needs its side tables - if they can't be had, compact by evacuating sub areas */
+		_slidingCompaction = _extensions->compactSliding && createSlideChunkTable(env);
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no worker GC threads
-	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())) {
-		singleThreaded = true;
+	if (_slidingCompaction) {
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		summarizeSlideChunks(env);
+		calculateSlideDestinations(env);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 	}
 
-	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
-	env->_compactStats._setupEndTime = omrtime_hires_clock();
+	if (_slidingCompaction) {
+		/* Reset the memory pools for the rebuild of the free lists, as for a sub area compaction */
+		completeSubAreaTable(env);
 
-	/* If a single threaded compaction force compact to run on main thread. Required
-	 * to ensure all events issued on main thread.
-	 */
-	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
+		slideObjects(env, objectCount, byteCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
 
-		if (!singleThreaded) {
-			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
-			MM_AtomicOperations::sync();
-		}
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		MM_AtomicOperations::sync();
 
 		env->_compactStats._fixupStartTime = omrtime_hires_clock();
+		fixupSlidObjects(env, fixupObjectsCount);
+		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+	} else {
+		/* We force a single sub area compaction if:
+		 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+		 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+		 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+		 *  o no worker GC threads
+		 */
+		if (aggressive || (1 == env->_currentTask->getThreadCount())) {
+			singleThreaded = true;
+		}
 
-		fixupObjects(env, fixupObjectsCount);
+		env->_compactStats._setupStartTime = omrtime_hires_clock();
+		workerSetupForGC(env, singleThreaded);
+		env->_compactStats._setupEndTime = omrtime_hires_clock();
 
+		/* If a single threaded compaction force compact to run on main thread. Required
+		 * to ensure all events issued on main thread.
+		 */
+		if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+
+			if (!singleThreaded) {
+				env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+				MM_AtomicOperations::sync();
+			}
+
+			env->_compactStats._fixupStartTime = omrtime_hires_clock();
+
+			fixupObjects(env, fixupObjectsCount);
 
-		env->_compactStats._fixupEndTime = omrtime_hires_clock();
 
-		if (singleThreaded) {
-			env->_currentTask->releaseSynchronizedGCThreads(env);
+			env->_compactStats._fixupEndTime = omrtime_hires_clock();
+
+			if (singleThreaded) {
+				env->_currentTask->releaseSynchronizedGCThreads(env);
+			}
 		}
 	}
 
@@ -613,7 +650,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	MM_AtomicOperations::sync();
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		rebuildFreelist(env);
+		if (_slidingCompaction) {
+			rebuildFreelistAfterSlide(env);
+		} else {
+			rebuildFreelist(env);
+		}
 
 		MM_MemoryPool *memoryPool;
 		MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
@@ -627,7 +668,11 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	if (rebuildMarkBits) {
-		rebuildMarkbits(env);
+		if (_slidingCompaction) {
+			rebuildMarkbitsAfterSlide(env);
+		} else {
+			rebuildMarkbits(env);
+		}
 		MM_AtomicOperations::sync();
 	}
 
@@ -636,6 +681,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	env->_compactStats._movedObjects = objectCount;
 	env->_compactStats._movedBytes = byteCount;
 	env->_compactStats._fixupObjects = fixupObjectsCount;
+	env->_compactStats._sliding = _slidingCompaction;
 }
 
 void
@@ -1289,6 +1335,10 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 		return objectPtr;
 	}
 
+	if (_slidingCompaction) {
+		return getSlidForwardingPtr(objectPtr);
+	}
+
 	intptr_t index = pageIndex(objectPtr);
 	omrobjectptr_t forwardingPtr = _compactTable[index].getAddr();
 	if (forwardingPtr == 0) {
@@ -1463,6 +1513,11 @@ MM_CompactScheme::rebuildMarkbitsInSubArea(MM_EnvironmentStandard *env, MM_HeapR
 void
 MM_CompactScheme::fixHeapForWalk(MM_EnvironmentBase *env)
 {
+	/* A sliding compaction packs every region and leaves no fixup only sub areas (and no sub area table) behind */
+	if (_slidingCompaction) {
+		return;
+	}
+
 	MM_CompactFixHeapForWalkTask fixHeapForWalkTask(env, _dispatcher, this);
 	_dispatcher->run(env, &fixHeapForWalkTask);
 }
@@ -1524,4 +1579,364 @@ MM_CompactScheme::changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * en
 	return successful;
 }
 
+bool
+MM_CompactScheme::createSlideChunkTable(MM_EnvironmentStandard *env)
+{
+	OMR::GC::Forge *forge = env->getForge();
+
+	/* Regions start on a heap alignment boundary, so no mark map slot holds objects of two chunks */
+	Assert_MM_true(0 == (_extensions->heapAlignment % J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT));
+
+	if (NULL == _slideBlockOffsets) {
+		/* The window table and block offsets cover the whole heap range, so they are only allocated once */
+		uintptr_t heapRange = _heap->getMaximumPhysicalRange();
+		uintptr_t blockCount = MM_Math::roundToCeiling(J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT, heapRange) / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT;
+		uintptr_t windowCount = MM_Math::roundToCeiling(slideWindowSize, heapRange) / slideWindowSize;
+
+		uintptr_t windowTableSize = windowCount * sizeof(uintptr_t);
+		uintptr_t tablesSize = windowTableSize + (blockCount * sizeof(uint16_t));
+
+		/* Both tables are read for every object moved or fixed up, so they are metadata which may get huge pages */
+		MM_MemoryManager *memoryManager = _extensions->memoryManager;
+		if (!memoryManager->createVirtualMemoryForMetadata(env, &_slideTablesMemoryHandle, sizeof(uintptr_t), tablesSize, _extensions->compactTablePagePolicy)) {
+			return false;
+		}
+		void *tablesBase = memoryManager->getHeapBase(&_slideTablesMemoryHandle);
+		if (!memoryManager->commitMemory(&_slideTablesMemoryHandle, tablesBase, tablesSize)) {
+			memoryManager->destroyVirtualMemory(env, &_slideTablesMemoryHandle);
+			return false;
+		}
+		_slideWindowTable = (uintptr_t *)tablesBase;
+		_slideBlockOffsets = (uint16_t *)((uintptr_t)tablesBase + windowTableSize);
+		_extensions->compactTablePageSize = memoryManager->getPageSize(&_slideTablesMemoryHandle);
+	}
+
+	/* The number of chunks changes as the heap expands and contracts */
+	uintptr_t chunkCount = 0;
+	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionCounter.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		uintptr_t firstWindow = ((uintptr_t)region->getLowAddress() - _heapBase) / slideWindowSize;
+		uintptr_t lastWindow = ((uintptr_t)region->getHighAddress() - 1 - _heapBase) / slideWindowSize;
+		chunkCount += lastWindow - firstWindow + 1;
+	}
+
+	if (chunkCount > _slideChunkTableSize) {
+		if (NULL != _slideChunkTable) {
+			forge->free(_slideChunkTable);
+			_slideChunkTableSize = 0;
+		}
+		_slideChunkTable = (SlideChunk *)forge->allocate(chunkCount * sizeof(SlideChunk), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _slideChunkTable) {
+			return false;
+		}
+		_slideChunkTableSize = chunkCount;
+	}
+
+	uintptr_t i = 0;
+	GC_HeapRegionIteratorStandard regionIterator(_rootManager);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		omrobjectptr_t start = (omrobjectptr_t)region->getLowAddress();
+		omrobjectptr_t high = (omrobjectptr_t)region->getHighAddress();
+		while (start < high) {
+			uintptr_t window = ((uintptr_t)start - _heapBase) / slideWindowSize;
+			omrobjectptr_t windowEnd = (omrobjectptr_t)(_heapBase + ((window + 1) * slideWindowSize));
+
+			/* regions are in address order, so the chunks of a window are consecutive */
+			if ((0 == i) || ((((uintptr_t)_slideChunkTable[i - 1].start - _heapBase) / slideWindowSize) != window)) {
+				_slideWindowTable[window] = i;
+			}
+
+			SlideChunk *chunk = &_slideChunkTable[i];
+			chunk->region = region;
+			chunk->start = start;
+			chunk->end = OMR_MIN(windowEnd, high);
+			chunk->firstObject = NULL;
+			chunk->extentEnd = start;
+			chunk->destination = start;
+			chunk->liveBytes = 0;
+			chunk->growth = 0;
+			chunk->spanningChunk = i;
+			chunk->moved = 0;
+			chunk->offsetOverflow = false;
+
+			start = chunk->end;
+			i += 1;
+		}
+	}
+	Assert_MM_true(i == chunkCount);
+	_slideChunkCount = chunkCount;
+
+	return true;
+}
+
+void
+MM_CompactScheme::summarizeSlideChunks(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlideChunk *chunk = &_slideChunkTable[i];
+			uintptr_t liveBytes = 0;
+			uintptr_t growth = 0;
+			uintptr_t lastSlotIndex = UDATA_MAX;
+
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)chunk->start, (uintptr_t *)chunk->end);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				uintptr_t slotIndex = _markMap->getSlotIndex(objectPtr);
+				if (slotIndex != lastSlotIndex) {
+					/* first object of the mark map slot */
+					uintptr_t offset = liveBytes / J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+					if (offset > U_16_MAX) {
+						chunk->offsetOverflow = true;
+					}
+					_slideBlockOffsets[slotIndex] = (uint16_t)offset;
+					lastSlotIndex = slotIndex;
+				}
+				if (NULL == chunk->firstObject) {
+					chunk->firstObject = objectPtr;
+				}
+
+				uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+				uintptr_t objectSizeAfterMove = _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+				liveBytes += objectSizeAfterMove;
+				growth += objectSizeAfterMove - objectSize;
+				chunk->extentEnd = (omrobjectptr_t)((uintptr_t)objectPtr + objectSize);
+			}
+
+			chunk->liveBytes = liveBytes;
+			chunk->growth = growth;
+		}
+	}
+}
+
+void
+MM_CompactScheme::calculateSlideDestinations(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		uintptr_t destination = 0;
+		uintptr_t extentEnd = 0;
+		uintptr_t extentChunk = 0;
+
+		for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+			SlideChunk *chunk = &_slideChunkTable[i];
+			if (chunk->region != region) {
+				/* objects never slide out of their region */
+				region = chunk->region;
+				destination = (uintptr_t)chunk->start;
+				extentEnd = (uintptr_t)chunk->start;
+			}
+
+			chunk->destination = (omrobjectptr_t)destination;
+			if (extentEnd > (uintptr_t)chunk->start) {
+				/* the last object of an earlier chunk runs into this one */
+				chunk->spanningChunk = extentChunk;
+			}
+			if ((uintptr_t)chunk->extentEnd > extentEnd) {
+				extentEnd = (uintptr_t)chunk->extentEnd;
+				extentChunk = i;
+			}
+			destination += chunk->liveBytes;
+
+			/* An object that grows when moved must still end below where the next object starts. This holds
+			 * if the objects of the chunk move down by at least the number of bytes they grow by in total.
+			 */
+			bool movesUp = (NULL != chunk->firstObject) && (((uintptr_t)chunk->destination + chunk->growth) > (uintptr_t)chunk->firstObject);
+			if (chunk->offsetOverflow || movesUp || (destination > (uintptr_t)region->getHighAddress())) {
+				Trc_MM_CompactScheme_calculateSlideDestinations_abandoned(env->getLanguageVMThread(), chunk->start, chunk->end);
+				_slidingCompaction = false;
+				break;
+			}
+		}
+
+		_compactFrom = _slideChunkTable[0].start;
+		_compactTo = _slideChunkTable[_slideChunkCount - 1].end;
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	/* Work units are handed out in increasing order, so every chunk a thread waits for in slideChunk() is
+	 * already owned by a thread which is moving it, or is about to.
+	 */
+	for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			slideChunk(env, i, objectCount, byteCount);
+		}
+	}
+}
+
+void
+MM_CompactScheme::slideChunk(MM_EnvironmentStandard *env, uintptr_t chunkIndex, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	SlideChunk *chunk = &_slideChunkTable[chunkIndex];
+
+	if (0 != chunk->liveBytes) {
+		omrobjectptr_t destination = chunk->destination;
+		omrobjectptr_t destinationEnd = (omrobjectptr_t)((uintptr_t)destination + chunk->liveBytes);
+		uintptr_t nobjects = 0;
+		uintptr_t nbytes = 0;
+
+		/* Wait for all the chunks which still have objects in the range this one slides into. The range
+		 * starts in the chunk holding destination, or in the chunk of the object spanning into that one.
+		 */
+		for (uintptr_t i = _slideChunkTable[slideChunkIndex(destination)].spanningChunk; (i < chunkIndex) && (_slideChunkTable[i].start < destinationEnd); i++) {
+			uintptr_t spinCount = 0;
+			while (0 == _slideChunkTable[i].moved) {
+				/* yield the processor now and then, in case the thread moving the chunk is not running */
+				spinCount += 1;
+				if (0 == (spinCount % 256)) {
+					omrthread_yield();
+				} else {
+					MM_AtomicOperations::yieldCPU();
+				}
+			}
+		}
+		MM_AtomicOperations::loadSync();
+
+		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)chunk->start, (uintptr_t *)chunk->end);
+		omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
+		while (NULL != objectPtr) {
+			/* the iterator reads the size of the object it returns - get the next one before this one is moved */
+			omrobjectptr_t nextObject = markedObjectIterator.nextObject();
+			uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+			uintptr_t objectSizeAfterMove = _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+
+			if (destination != objectPtr) {
+				preObjectMove(env, objectPtr);
+				memmove(destination, objectPtr, objectSize);
+				postObjectMove(env, destination);
+				nobjects += 1;
+				nbytes += objectSizeAfterMove;
+			}
+
+			destination = (omrobjectptr_t)((uintptr_t)destination + objectSizeAfterMove);
+			objectPtr = nextObject;
+		}
+		Assert_MM_true(destination == destinationEnd);
+
+		Trc_MM_CompactScheme_slideChunk_slid(env->getLanguageVMThread(), chunk->start, chunk->end, chunk->destination, nbytes);
+		objectCount += nobjects;
+		byteCount += nbytes;
+	}
+
+	MM_AtomicOperations::storeSync();
+	chunk->moved = 1;
+}
+
+void
+MM_CompactScheme::fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount)
+{
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+
+	for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlideChunk *chunk = &_slideChunkTable[i];
+			if (0 != chunk->liveBytes) {
+				/* the objects of the chunk are now contiguous from its destination */
+				omrobjectptr_t end = (omrobjectptr_t)((uintptr_t)chunk->destination + chunk->liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, chunk->destination, end, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					objectCount++;
+					fixupObject.fixupObject(env, objectPtr);
+				}
+			}
+		}
+	}
+}
+
+omrobjectptr_t
+MM_CompactScheme::getSlidForwardingPtr(omrobjectptr_t objectPtr) const
+{
+	SlideChunk *chunk = &_slideChunkTable[slideChunkIndex(objectPtr)];
+	uintptr_t slotIndex = 0;
+	uintptr_t bitMask = 0;
+	_markMap->getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+
+	uintptr_t offset = (uintptr_t)_slideBlockOffsets[slotIndex] * J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT;
+	omrobjectptr_t forwardingPtr = (omrobjectptr_t)((uintptr_t)chunk->destination + offset);
+
+	/* walk over the objects marked ahead of this one in the slot, which have been moved in order */
+	uintptr_t precedingObjects = MM_Bits::populationCount(_markMap->getSlot(slotIndex) & (bitMask - 1));
+	for (uintptr_t i = 0; i < precedingObjects; i++) {
+		uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(forwardingPtr);
+		forwardingPtr = (omrobjectptr_t)((uintptr_t)forwardingPtr + size);
+	}
+
+	MM_CompactSchemeFixupObject::verifyForwardingPtr(objectPtr, forwardingPtr);
+	return forwardingPtr;
+}
+
+void
+MM_CompactScheme::rebuildFreelistAfterSlide(MM_EnvironmentStandard *env)
+{
+	uintptr_t i = 0;
+	while (i < _slideChunkCount) {
+		MM_HeapRegionDescriptorStandard *region = _slideChunkTable[i].region;
+		while (((i + 1) < _slideChunkCount) && (region == _slideChunkTable[i + 1].region)) {
+			i += 1;
+		}
+
+		/* all the objects of the region are packed at its bottom - the rest of it is free */
+		SlideChunk *lastChunk = &_slideChunkTable[i];
+		void *currentFreeBase = (void *)((uintptr_t)lastChunk->destination + lastChunk->liveBytes);
+		uintptr_t currentFreeSize = (uintptr_t)region->getHighAddress() - (uintptr_t)currentFreeBase;
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+
+		MM_CompactMemoryPoolState poolState;
+		poolState._memoryPool = memorySubSpace->getMemoryPool(region->getLowAddress());
+
+		if (0 != currentFreeSize) {
+			addFreeEntry(env, memorySubSpace, &poolState, currentFreeBase, currentFreeSize);
+		}
+
+		if (NULL != poolState._freeListHead) {
+			/* Terminate the free list with NULL*/
+			poolState._memoryPool->createFreeEntry(env, poolState._previousFreeEntry,
+													(uint8_t *)poolState._previousFreeEntry + poolState._previousFreeEntrySize);
+		}
+		flushPool(env, &poolState);
+
+		i += 1;
+	}
+}
+
+void
+MM_CompactScheme::rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			_markMap->setBitsInRange(env, _slideChunkTable[i].start, _slideChunkTable[i].end, true);
+		}
+	}
+
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	for (uintptr_t i = 0; i < _slideChunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			SlideChunk *chunk = &_slideChunkTable[i];
+			if (0 != chunk->liveBytes) {
+				omrobjectptr_t end = (omrobjectptr_t)((uintptr_t)chunk->destination + chunk->liveBytes);
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, chunk->destination, end, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = objectIterator.nextObject())) {
+					/* the objects of neighbouring chunks may share a mark map slot */
+					_markMap->atomicSetBit(objectPtr);
+				}
+			}
+		}
+	}
+}
+
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -122,6 +122,24 @@ private:
 		};
 	};
 
+	/* A piece of a region compacted by sliding (see MM_GCExtensionsBase::compactSliding). Chunks are
+	 * the intersection of the committed regions with windows of slideWindowSize bytes, so the chunk holding
+	 * an address is found from the window it is in. All addresses are up to, but not including, end.
+	 */
+	struct SlideChunk {
+		MM_HeapRegionDescriptorStandard *region; /**< The region the chunk is in */
+		omrobjectptr_t start;
+		omrobjectptr_t end;
+		omrobjectptr_t firstObject; /**< First marked object starting in the chunk, NULL if there is none */
+		omrobjectptr_t extentEnd; /**< End of the last marked object starting in the chunk (may be beyond end) */
+		omrobjectptr_t destination; /**< Address the first marked object of the chunk slides to */
+		uintptr_t liveBytes; /**< Size of the marked objects starting in the chunk, once moved */
+		uintptr_t growth; /**< Number of bytes the marked objects starting in the chunk grow by when moved */
+		uintptr_t spanningChunk; /**< Index of the chunk holding the object covering start (the chunk itself if there is none) */
+		volatile uintptr_t moved; /**< Set once all the objects of the chunk are at their destination */
+		bool offsetOverflow; /**< True if a block offset of the chunk did not fit in the block offset table */
+	};
+
 protected:
 	OMR_VM                 *_omrVM;
 	MM_GCExtensionsBase    *_extensions;
@@ -139,6 +157,14 @@ protected:
 	omrobjectptr_t         _compactTo;
 	MM_CompactDelegate     _delegate;
 
+	bool                   _slidingCompaction; /**< True if the current compaction slides objects rather than evacuating sub areas */
+	SlideChunk             *_slideChunkTable; /**< Chunks of the committed regions, in address order */
+	uintptr_t              _slideChunkCount; /**< Number of chunks in use in _slideChunkTable */
+	uintptr_t              _slideChunkTableSize; /**< Number of chunks _slideChunkTable can hold */
+	uintptr_t              *_slideWindowTable; /**< Index in _slideChunkTable of the first chunk of each window */
+	uint16_t               *_slideBlockOffsets; /**< Per mark map slot, offset (in mark map bit grains) of its first marked object from the destination of its chunk */
+	MM_MemoryHandle        _slideTablesMemoryHandle; /**< Memory backing _slideWindowTable and _slideBlockOffsets */
+
 public:
 
 	/*
@@ -148,6 +174,12 @@ public:
 	 */
 	ddr_constant(sizeof_page, 2 * J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT);
 
+	/*
+	 * Size of the windows the heap is split into for sliding compaction. The objects of a window are summarized,
+	 * moved and fixed up as one unit of work.
+	 */
+	enum { slideWindowSize = 256 * 1024 };
+
 private:
 	omrobjectptr_t freeChunkEnd(omrobjectptr_t chunk);
 	size_t getFreeChunkSize(omrobjectptr_t freeChunk);
@@ -302,6 +334,77 @@ protected:
 	 * @return true if the action was changed, or false if another thread already changed it to newAction
 	 */
 	bool changeSubAreaAction(MM_EnvironmentBase *env, SubAreaEntry * entry, uintptr_t newAction);
+
+	/**
+	 * Build the chunk table for a sliding compaction, allocating the side tables on first use.
+	 * Called by the main thread only.
+	 *
+	 * @param env[in] the main thread
+	 * @return true if the tables are ready, false if they could not be allocated
+	 */
+	bool createSlideChunkTable(MM_EnvironmentStandard *env);
+
+	/**
+	 * Size the marked objects of every chunk, and record the offset of the first marked object of each
+	 * mark map slot from the start of the objects of its chunk.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void summarizeSlideChunks(MM_EnvironmentStandard *env);
+
+	/**
+	 * Prefix sum the chunk live bytes of each region into chunk destinations. If any object would have
+	 * to move up (objects may grow when moved), or a block offset did not fit, sliding is abandoned for
+	 * this compaction. Nothing has been moved at that point.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void calculateSlideDestinations(MM_EnvironmentStandard *env);
+
+	/**
+	 * Slide the objects of every chunk down to their destination. A chunk is only moved once all the
+	 * chunks whose objects it would overwrite have been moved.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+	void slideChunk(MM_EnvironmentStandard *env, uintptr_t chunkIndex, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Fix up the objects of every chunk, at their destination.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects fixed up (accumulated)
+	 */
+	void fixupSlidObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount);
+	void rebuildFreelistAfterSlide(MM_EnvironmentStandard *env);
+	void rebuildMarkbitsAfterSlide(MM_EnvironmentStandard *env);
+
+	/**
+	 * Run a compaction by sliding, once the chunk destinations are known.
+	 */
+	void slideCompact(MM_EnvironmentStandard *env, bool rebuildMarkBits, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &fixupObjectsCount);
+
+	/**
+	 * Answer the new location of an object moved by a sliding compaction. The chunk gives the new location
+	 * of its first object, the block offset table that of the first object of the mark map slot, and the
+	 * remaining objects are counted from the mark bits and walked over at their new location.
+	 */
+	omrobjectptr_t getSlidForwardingPtr(omrobjectptr_t objectPtr) const;
+
+	/**
+	 * Return the index in _slideChunkTable of the chunk an address is in.
+	 */
+	MMINLINE uintptr_t slideChunkIndex(omrobjectptr_t objectPtr) const
+	{
+		uintptr_t index = _slideWindowTable[((uintptr_t)objectPtr - _heapBase) / slideWindowSize];
+		while (((index + 1) < _slideChunkCount) && (_slideChunkTable[index + 1].start <= objectPtr)) {
+			index += 1;
+		}
+		return index;
+	}
 public:
 	static MM_CompactScheme *newInstance(MM_EnvironmentBase *env, MM_MarkingScheme *markingScheme);
 	
@@ -336,6 +439,13 @@ public:
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
 		, _delegate()
+		, _slidingCompaction(false)
+		, _slideChunkTable(NULL)
+		, _slideChunkCount(0)
+		, _slideChunkTableSize(0)
+		, _slideWindowTable(NULL)
+		, _slideBlockOffsets(NULL)
+		, _slideTablesMemoryHandle()
 	{
 		_typeId = __FUNCTION__;
 	}
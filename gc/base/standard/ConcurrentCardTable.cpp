@@ -41,6 +41,7 @@
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "OMRVMThreadListIterator.hpp"
 #include "WorkStack.hpp"
 #include "WorkPacketsStandard.hpp"
 #include "MarkingScheme.hpp"
@@ -396,6 +397,10 @@ MM_ConcurrentCardTable::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpa
 				/* If attempt to shrink TLH Mark Map fails return false, no other actions required */
 				result = freeTLHMarkMapEntriesForHeapRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 				_cardTableReconfigured = true;
+				if (_recordDirtiedCards) {
+					/* Queued cards may refer to the decommitted part of the card table */
+					invalidateDirtyCardQueue();
+				}
 				if (!result) {
 					/* put tracepoint here */
 				}
@@ -471,7 +476,7 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			uintptr_t tlhMarkMapSizeRequired = calculateTLHMarkMapSize(env,cardTableSizeRequired);
 
 			MM_MemoryManager *memoryManager = _extensions->memoryManager;
-			if (!memoryManager->createVirtualMemoryForMetadata(env, &_tlhMarkMapMemoryHandle, sizeof(uintptr_t), tlhMarkMapSizeRequired)) {
+			if (!memoryManager->createVirtualMemoryForMetadata(env, &_tlhMarkMapMemoryHandle, sizeof(uintptr_t), tlhMarkMapSizeRequired, _extensions->cardTablePagePolicy)) {
 				return false;
 			}
 	
@@ -482,33 +487,63 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		if (_extensions->concurrentCardCleaningQueue && _extensions->optimizeConcurrentWB) {
+			/* The queue is activated as the write barrier is, with the mutators stopped (see activateDirtyCardQueue()).
+			 * The queue holds a fraction of the cards of the maximum heap. If more cards than that are
+			 * dirtied in a cycle the card table is scanned instead, which is cheaper at that mutation rate anyway.
+			 */
+			_dirtyCardQueueSize = _extensions->concurrentCardCleaningQueueSize;
+			if (0 == _dirtyCardQueueSize) {
+				uintptr_t cardCount = calculateCardTableSize(env, heap->getMaximumPhysicalRange());
+				_dirtyCardQueueSize = OMR_MAX(cardCount / DIRTY_CARD_QUEUE_CARDS_PER_ENTRY, DIRTY_CARD_QUEUE_MINIMUM_SIZE);
+			}
+			_dirtyCardQueue = (Card **)env->getForge()->allocate(_dirtyCardQueueSize * sizeof(Card *), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _dirtyCardQueue) {
+				return false;
+			}
+			memset(_dirtyCardQueue, 0, _dirtyCardQueueSize * sizeof(Card *));
+			if (omrthread_monitor_init_with_name(&_dirtyCardQueueMonitor, 0, "MM_ConcurrentCardTable::dirtyCardQueue")) {
+				return false;
+			}
+			_recordDirtiedCards = true;
+		}
+
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
 	
-		/* How many of the card clean phases do we need to perform ?
-		 *
-		 * If 1 pass selected then we perform just the first 2 phases;
-		 * if a 2nd pass selected then we further the further phase.
-		 */
-		switch (_extensions->cardCleaningPasses) {
-		case 0:
-			_lastCardCleanPhase = UNINITIALIZED;
-			break;
-		case 1:
-			_lastCardCleanPhase = PHASE2_COMPLETE;
-			break;
-		case 2:
-			_lastCardCleanPhase = PHASE3_COMPLETE;
-			break;
-		default:
-			assume0(0);
-			break;
-		}
+		initializeLastCardCleanPhase();
 	}
 	return initialized;
 }
 
+/**
+ * Determine the last card cleaning phase of a cycle from the number of card cleaning passes.
+ */
+void
+MM_ConcurrentCardTable::initializeLastCardCleanPhase()
+{
+	/* How many of the card clean phases do we need to perform ?
+	 *
+	 * If 1 pass selected then we perform just the first 2 phases;
+	 * if a 2nd pass selected then we further the further phase.
+	 */
+	switch (_extensions->cardCleaningPasses) {
+	case 0:
+		_lastCardCleanPhase = UNINITIALIZED;
+		break;
+	case 1:
+		_lastCardCleanPhase = PHASE2_COMPLETE;
+		break;
+	case 2:
+		_lastCardCleanPhase = PHASE3_COMPLETE;
+		break;
+	default:
+		assume0(0);
+		break;
+	}
+}
+
 /**
  * Destroy a card table object by invoking the kill method on the
  * card table, debug card table and TLH mark map objects.
@@ -525,6 +560,16 @@ MM_ConcurrentCardTable::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_cleaningRanges);
 		_cleaningRanges = NULL;
 	}
+
+	if (NULL != _dirtyCardQueue) {
+		env->getForge()->free(_dirtyCardQueue);
+		_dirtyCardQueue = NULL;
+	}
+
+	if (NULL != _dirtyCardQueueMonitor) {
+		omrthread_monitor_destroy(_dirtyCardQueueMonitor);
+		_dirtyCardQueueMonitor = NULL;
+	}
 	MM_CardTable::tearDown(env);
 }
 
@@ -595,8 +640,12 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 
 	while(baseCard <= topCard) {
 		/* If card not already dirty then dirty it */
-		if (*baseCard != (Card)CARD_DIRTY) {
+		Card oldValue = *baseCard;
+		if (oldValue != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			if (_recordingDirtiedCards && ((Card)CARD_CLEAN == oldValue)) {
+				recordDirtiedCard(env, baseCard);
+			}
 		}
 		baseCard += 1;
 	}
@@ -623,6 +672,11 @@ MM_ConcurrentCardTable::initializeCardCleaning(MM_EnvironmentBase *env)
 			_cardTableReconfigured = true;
 			_cleanAllCards = false;
 		}
+
+		/* Undo any extra passes added to the last cycle to meet the final card cleaning pause target */
+		initializeLastCardCleanPhase();
+		_extraCardCleaningPasses = 0;
+		_dirtyCardsAtLastPassCheck = UDATA_MAX;
 	}
 }
 
@@ -665,6 +719,11 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentBase *env)
 		MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange,
 											 	(uintptr_t)_currentCleaningRange,
 												(uintptr_t)_cleaningRanges);
+
+		prepareDirtyCardQueueForCleaning(env);
+		if (_drainDirtyCardQueue) {
+			_cardTableStats._dirtyCardsAtConcurrentCleaning = _dirtyCardQueueLimit - _dirtyCardQueueNext;
+		}
 		break;
 
 	case PHASE2_PREPARING:
@@ -683,7 +742,10 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentBase *env)
 		/* Remember when we started phase 3 for stats */
 		_cardTableStats.setCardCleaningPhase3Kickoff(currentFree);
 
-		reportCardCleanPass2Start(env);
+		/* Extra passes are not reported, the collector tunes the trace rate for the configured passes only */
+		if (0 == _extraCardCleaningPasses) {
+			reportCardCleanPass2Start(env);
+		}
 
 		/* Determine the cleaning ranges for 2nd pass */
 		if (_cardTableReconfigured){
@@ -692,6 +754,7 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentBase *env)
 			resetCleaningRanges(env);
 		}
 
+		prepareDirtyCardQueueForCleaning(env);
 		break;
 	default:
 		assume0(0);
@@ -790,6 +853,9 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 
 	*sizeDone = 0;
 
+	/* Make the cards this thread dirtied available for cleaning */
+	flushDirtyCardBuffer(env);
+
 	if (cardTableNeedsPreparing(currentCleaningPhase)) {
 		/* Only allow mutator threads to do initialization work; don't want
 		 * low priority concurrent helper threads holding up card cleaning.
@@ -847,7 +913,7 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	while ( cleanedSoFar < sizeToDo && currentCleaningPhase == _cardCleanPhase ) {
 
 		/* Get next dirty card; if any */
-		nextDirtyCard = getNextDirtyCard(env, _concurrentCardCleanMask, true);
+		nextDirtyCard = getNextDirtyCardToClean(env, _concurrentCardCleanMask, true);
 
 		/* If no more cards or another thread waiting on exclusive access
 		 * we are done
@@ -872,6 +938,10 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 		 * objects. Therefore we cannot be sure tracing into all active TLH's will be deferred.
 		 */
 		if (isCardInActiveTLH(env,nextDirtyCard) && !stats->getConcurrentWorkStackOverflowOcurred()) {
+			if (_drainDirtyCardQueue) {
+				/* The card is left dirty, so queue it again for final card cleaning to find */
+				recordDirtiedCard(env, nextDirtyCard);
+			}
 			continue;
 		}
 
@@ -905,9 +975,13 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	if (NULL == nextDirtyCard) {
         currentCleaningPhase = _cardCleanPhase;
         if (cardCleaningInProgress(currentCleaningPhase)) {
-			MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
-																								(uint32_t) currentCleaningPhase,
-																								(uint32_t) currentCleaningPhase + 1);
+			if ((0 != _extensions->finalCardCleaningPauseTarget) && (((uint32_t)currentCleaningPhase + 1) == (uint32_t)_lastCardCleanPhase)) {
+				completeLastCardCleaningPhase(env, currentCleaningPhase);
+			} else {
+				MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
+																									(uint32_t) currentCleaningPhase,
+																									(uint32_t) currentCleaningPhase + 1);
+			}
         }
 	}
 
@@ -918,6 +992,79 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	return true;
 }
 
+void
+MM_ConcurrentCardTable::completeLastCardCleaningPhase(MM_EnvironmentBase *env, CardCleanPhase currentPhase)
+{
+	/* Park the phase in a preparing state while the decision is made, so whichever thread ran out of
+	 * cards first, mutator or background helper, makes it alone and no thread sees card cleaning complete
+	 * in between. Other threads wait for the decision as they would for the card table to be prepared.
+	 * If the exchange fails another thread has already completed the phase or started an extra pass.
+	 */
+	if (currentPhase != (CardCleanPhase)MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
+																					(uint32_t) currentPhase,
+																					(uint32_t) PHASE2_PREPARING)) {
+		return;
+	}
+
+	CardCleanPhase nextPhase = (CardCleanPhase)((uint32_t)currentPhase + 1);
+	if (extraCardCleaningPassNeeded(env)) {
+		/* Step back to the end of phase 2 so the card table is prepared for a phase 3 pass, which re-cleans all cards */
+		_extraCardCleaningPasses += 1;
+		_cardTableStats._extraCardCleaningPasses = _extraCardCleaningPasses;
+		_lastCardCleanPhase = PHASE3_COMPLETE;
+		nextPhase = PHASE2_COMPLETE;
+	}
+	MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
+												(uint32_t) PHASE2_PREPARING,
+												(uint32_t) nextPhase);
+}
+
+bool
+MM_ConcurrentCardTable::extraCardCleaningPassNeeded(MM_EnvironmentBase *env)
+{
+	if (MAX_EXTRA_CARD_CLEANING_PASSES <= _extraCardCleaningPasses) {
+		return false;
+	}
+
+	uintptr_t dirtyCards = countDirtyCards(env);
+	uintptr_t predictedTime = _collector->predictFinalCardCleaningTime(dirtyCards);
+	_cardTableStats._predictedFinalCardCleaningTime = predictedTime;
+
+	/* Another pass only helps if the last one reduced the number of dirty cards; if cards are dirtied
+	 * faster than they are cleaned the final card cleaning pause can not be brought down this way.
+	 */
+	bool reducedDirtyCards = (dirtyCards < _dirtyCardsAtLastPassCheck);
+	_cardTableStats._lastCardCleaningPassReducedDirtyCards = reducedDirtyCards;
+	bool needed = (predictedTime > _extensions->finalCardCleaningPauseTarget) && reducedDirtyCards;
+	_dirtyCardsAtLastPassCheck = dirtyCards;
+
+	return needed;
+}
+
+uintptr_t
+MM_ConcurrentCardTable::countDirtyCards(MM_EnvironmentBase *env)
+{
+	uintptr_t dirtyCards = 0;
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		Card *lastCard = range->topCard;
+		/* Scan a slot at a time where the card table is clean, as in getNextDirtyCard() */
+		uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCard);
+		Card *card = range->baseCard;
+		while (card < lastCard) {
+			if ((0 == (uintptr_t)card % sizeof(uintptr_t)) && ((uintptr_t *)card < lastSlot) && (SLOT_ALL_CLEAN == *(uintptr_t *)card)) {
+				card += sizeof(uintptr_t);
+			} else {
+				if (0 != (*card & _finalCardCleanMask)) {
+					dirtyCards += 1;
+				}
+				card += 1;
+			}
+		}
+	}
+
+	return dirtyCards;
+}
+
 /**
  * Clean all objects in a single card
  *
@@ -953,7 +1100,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 	 */
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
-			*card = (Card)CARD_DIRTY;
+			redirtyCard(env, card);
 			/* ...and get out now */
 			return false;
 		}
@@ -999,7 +1146,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 * an exceptional circumstance.
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
-		*card = (Card)CARD_DIRTY;
+		redirtyCard(env, card);
 	}
 
 	return true;
@@ -1012,6 +1159,11 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 void
 MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 {
+	if (_recordDirtiedCards) {
+		/* All other threads are stopped, so queue the cards left in their buffers */
+		flushAllDirtyCardBuffers(env);
+	}
+
 	if (_cardTableReconfigured){
 		determineCleaningRanges(env);
 	} else {
@@ -1023,6 +1175,14 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 												(uintptr_t)_cleaningRanges);
 	/* We process all cards in one go */
 	_lastCardInPhase = _lastCard;
+
+	prepareDirtyCardQueueForCleaning(env);
+	if (_recordDirtiedCards) {
+		_cardTableStats._dirtyCardQueueDrained = _drainDirtyCardQueue;
+		_cardTableStats._dirtyCardQueueOverflowed = _dirtyCardQueueOverflowed;
+		_cardTableStats._dirtyCardsQueued = _dirtyCardQueueTop;
+		_cardTableStats._dirtyCardsAtFinalCleaning = _drainDirtyCardQueue ? (_dirtyCardQueueLimit - _dirtyCardQueueNext) : 0;
+	}
 }
 
 /**
@@ -1058,7 +1218,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCardToClean(env, _finalCardCleanMask, false)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
@@ -1100,6 +1260,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	env->_cardCleaningStats._cardsCleaned += cards;
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1726,6 +1887,203 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	return NULL;
 }
 
+/**
+ * Is card in the cleaning ranges
+ *
+ * @param card - the card to be checked
+ * @return TRUE if the card is in one of the ranges of the card table being cleaned; FALSE otherwise
+ */
+bool
+MM_ConcurrentCardTable::isCardInCleaningRanges(Card *card)
+{
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		if ((card >= range->baseCard) && (card < range->topCard)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Prepare the dirty card queue for the next phase of card cleaning.
+ *
+ * The queue is drained, rather than the card table scanned, if every card dirtied in this
+ * cycle is known to be in it and only the cards of concurrently collectable subspaces need cleaning.
+ * The phase drains the cards queued so far.
+ */
+void
+MM_ConcurrentCardTable::prepareDirtyCardQueueForCleaning(MM_EnvironmentBase *env)
+{
+	_drainDirtyCardQueue = _recordDirtiedCards && !_dirtyCardQueueOverflowed && !_cleanAllCards;
+	if (_drainDirtyCardQueue) {
+		_dirtyCardQueueLimit = OMR_MIN(_dirtyCardQueueTop, _dirtyCardQueueSize);
+	}
+}
+
+/**
+ * Get the next dirty card from the dirty card queue.
+ *
+ * A card may be queued more than once, or cleaned since it was queued, so queued cards
+ * which do not match cardMask are skipped. Cards outside the cleaning ranges are skipped too,
+ * as getNextDirtyCard() would not find them either. The ranges only catch up with a heap
+ * expansion when the next phase is prepared though, so during concurrent card cleaning such a
+ * card is queued again for a later phase, or final card cleaning, to look at.
+ *
+ * @param cardMask - mask to apply to cards to identify those cards the caller
+ * 					 is interested in
+ *
+ * @return Routine either returns address of next dirty card, NULL if no
+ * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
+ * for exclusive VM access.
+ */
+Card*
+MM_ConcurrentCardTable::getNextQueuedDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
+{
+	uintptr_t index = _dirtyCardQueueNext;
+
+	while (index < _dirtyCardQueueLimit) {
+		if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+			return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
+		}
+
+		if (index == MM_AtomicOperations::lockCompareExchange(&_dirtyCardQueueNext, index, index + 1)) {
+			Card *card = waitForQueuedDirtyCard(env, index);
+
+			if (0 != (*card & cardMask)) {
+				if (isCardInCleaningRanges(card)) {
+					return card;
+				}
+				if (concurrentCardClean) {
+					/* Entries queued from now on are beyond _dirtyCardQueueLimit, so this phase does not see the card again */
+					recordDirtiedCard(env, card);
+				}
+			}
+		}
+
+		index = _dirtyCardQueueNext;
+	}
+
+	return NULL;
+}
+
+/**
+ * Get the card in an entry of the dirty card queue. Entries are reserved before they are
+ * written, so the thread flushing its buffer to the entry may not have written it yet, in which
+ * case wait for it to do so (see flushDirtyCardBuffer()).
+ *
+ * @param index - index of the entry, which the caller has reserved for draining
+ * @return the card in the entry
+ */
+Card*
+MM_ConcurrentCardTable::waitForQueuedDirtyCard(MM_EnvironmentBase *env, uintptr_t index)
+{
+	Card * volatile *entry = (Card * volatile *)&_dirtyCardQueue[index];
+	Card *card = *entry;
+
+	if (NULL == card) {
+		omrthread_monitor_enter(_dirtyCardQueueMonitor);
+		_dirtyCardQueueWaiters += 1;
+		/* Order the update of the waiter count before the read of the entry; the flushing thread
+		 * writes the entry before it reads the waiter count, so one of us sees the other
+		 */
+		MM_AtomicOperations::sync();
+		while (NULL == (card = *entry)) {
+			omrthread_monitor_wait(_dirtyCardQueueMonitor);
+		}
+		_dirtyCardQueueWaiters -= 1;
+		omrthread_monitor_exit(_dirtyCardQueueMonitor);
+	}
+
+	return card;
+}
+
+/**
+ * Record a card which went from clean to dirty in the dirty card buffer of the thread.
+ */
+void
+MM_ConcurrentCardTable::recordDirtiedCard(MM_EnvironmentBase *env, Card *card)
+{
+	if (_recordingDirtiedCards && !_dirtyCardQueueOverflowed) {
+		MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+		if (DIRTY_CARD_BUFFER_SIZE == envStandard->_dirtyCardBufferCount) {
+			flushDirtyCardBuffer(env);
+		}
+		envStandard->_dirtyCardBuffer[envStandard->_dirtyCardBufferCount] = card;
+		envStandard->_dirtyCardBufferCount += 1;
+	}
+}
+
+void
+MM_ConcurrentCardTable::activateDirtyCardQueue(MM_EnvironmentBase *env)
+{
+	_recordingDirtiedCards = _recordDirtiedCards;
+}
+
+void
+MM_ConcurrentCardTable::flushDirtyCardBuffer(MM_EnvironmentBase *env)
+{
+	MM_EnvironmentStandard *envStandard = MM_EnvironmentStandard::getEnvironment(env);
+	uintptr_t count = envStandard->_dirtyCardBufferCount;
+
+	if (0 != count) {
+		uintptr_t top = MM_AtomicOperations::add(&_dirtyCardQueueTop, count);
+		uintptr_t index = top - count;
+		uintptr_t end = OMR_MIN(top, _dirtyCardQueueSize);
+		if (top > _dirtyCardQueueSize) {
+			/* The cards which do not fit are dropped, so the card table has to be scanned to find them */
+			invalidateDirtyCardQueue();
+		}
+		for (uintptr_t i = 0; index < end; i++, index++) {
+			_dirtyCardQueue[index] = envStandard->_dirtyCardBuffer[i];
+		}
+		envStandard->_dirtyCardBufferCount = 0;
+
+		/* Wake any thread draining the queue which reserved one of the entries before they were written */
+		MM_AtomicOperations::sync();
+		if (0 != _dirtyCardQueueWaiters) {
+			omrthread_monitor_enter(_dirtyCardQueueMonitor);
+			omrthread_monitor_notify_all(_dirtyCardQueueMonitor);
+			omrthread_monitor_exit(_dirtyCardQueueMonitor);
+		}
+	}
+}
+
+/**
+ * Flush the dirty card buffers of all threads.
+ * @note The other threads must be stopped
+ */
+void
+MM_ConcurrentCardTable::flushAllDirtyCardBuffers(MM_EnvironmentBase *env)
+{
+	GC_OMRVMThreadListIterator threadListIterator(_omrVM);
+	OMR_VMThread *omrVMThread = NULL;
+
+	while (NULL != (omrVMThread = threadListIterator.nextOMRVMThread())) {
+		flushDirtyCardBuffer(MM_EnvironmentBase::getEnvironment(omrVMThread));
+	}
+}
+
+void
+MM_ConcurrentCardTable::resetDirtyCardQueue(MM_EnvironmentBase *env)
+{
+	if (_recordDirtiedCards) {
+		GC_OMRVMThreadListIterator threadListIterator(_omrVM);
+		OMR_VMThread *omrVMThread = NULL;
+
+		while (NULL != (omrVMThread = threadListIterator.nextOMRVMThread())) {
+			MM_EnvironmentStandard::getEnvironment(omrVMThread)->_dirtyCardBufferCount = 0;
+		}
+
+		memset(_dirtyCardQueue, 0, OMR_MIN(_dirtyCardQueueTop, _dirtyCardQueueSize) * sizeof(Card *));
+		_dirtyCardQueueTop = 0;
+		_dirtyCardQueueNext = 0;
+		_dirtyCardQueueLimit = 0;
+		_recordingDirtiedCards = false;
+		_dirtyCardQueueOverflowed = false;
+		_drainDirtyCardQueue = false;
+	}
+}
+
 /**
  * Set TLH mark bits
  *
@@ -67,6 +67,10 @@
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
+
+#define DIRTY_CARD_QUEUE_CARDS_PER_ENTRY 64
+#define DIRTY_CARD_QUEUE_MINIMUM_SIZE ((uintptr_t)4096)
+#define MAX_EXTRA_CARD_CLEANING_PASSES 4
  
 /**
  * @}
@@ -153,6 +157,19 @@ private:
 	uintptr_t *_tlhMarkBits;
 	bool _cardTableReconfigured;
 	bool _cleanAllCards;
+
+	Card **_dirtyCardQueue; /**< Cards flushed from the per-thread dirty card buffers since the last global collection */
+	uintptr_t _dirtyCardQueueSize; /**< Number of entries in _dirtyCardQueue */
+	volatile uintptr_t _dirtyCardQueueTop; /**< Number of entries reserved by flushing threads (exceeds _dirtyCardQueueSize once the queue has overflowed) */
+	volatile uintptr_t _dirtyCardQueueNext; /**< Index of the next entry to be drained */
+	volatile uintptr_t _dirtyCardQueueLimit; /**< Entries below this index are drained in the current card cleaning phase */
+	volatile bool _dirtyCardQueueOverflowed; /**< True if a card dirtied in this cycle may be missing from the queue, so cards must be found by scanning the card table */
+	bool _drainDirtyCardQueue; /**< True if the current card cleaning phase drains the queue rather than scanning the card table */
+	omrthread_monitor_t _dirtyCardQueueMonitor; /**< Monitor on which threads draining the queue wait for reserved entries to be written */
+	volatile uintptr_t _dirtyCardQueueWaiters; /**< Number of threads waiting on _dirtyCardQueueMonitor */
+
+	uintptr_t _extraCardCleaningPasses; /**< Number of card cleaning passes started in this cycle to meet the final card cleaning pause target */
+	uintptr_t _dirtyCardsAtLastPassCheck; /**< Dirty cards counted when the last card cleaning pass of this cycle last completed */
 protected:
 	OMR_VM *_omrVM;
 	MM_ConcurrentGC *_collector;
@@ -161,7 +178,7 @@ protected:
 	MM_MarkingScheme *_markingScheme;
 	MM_ConcurrentCardTableStats _cardTableStats;
 	volatile CardCleanPhase	_cardCleanPhase;
-	CardCleanPhase _lastCardCleanPhase;
+	volatile CardCleanPhase _lastCardCleanPhase;
 	CleaningRange *_cleaningRanges;
 	CleaningRange * volatile _currentCleaningRange;
 	CleaningRange *_lastCleaningRange;
@@ -194,6 +211,57 @@ private:
 	void determineCleaningRanges(MM_EnvironmentBase *env);
 	void resetCleaningRanges(MM_EnvironmentBase *env);
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
+	bool isCardInCleaningRanges(Card *card);
+	void initializeLastCardCleanPhase();
+
+	/**
+	 * Complete the last card cleaning phase, or if final card cleaning is predicted to take longer than
+	 * the finalCardCleaningPauseTarget go back to the end of phase 2 so all cards are cleaned again.
+	 * Called by the mutator or background helper thread which ran out of cards.
+	 * @param currentPhase the card cleaning phase which ran out of cards
+	 */
+	void completeLastCardCleaningPhase(MM_EnvironmentBase *env, CardCleanPhase currentPhase);
+	bool extraCardCleaningPassNeeded(MM_EnvironmentBase *env);
+
+	/**
+	 * Count the cards in the cleaning ranges which final card cleaning would clean. The card table is
+	 * scanned even when the dirty card queue is drained, as the threads' buffers are not flushed yet.
+	 */
+	uintptr_t countDirtyCards(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide whether the card cleaning phase being prepared drains the dirty card queue, and if so
+	 * snapshot the entries it drains.
+	 */
+	void prepareDirtyCardQueueForCleaning(MM_EnvironmentBase *env);
+	Card *getNextQueuedDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+	Card *waitForQueuedDirtyCard(MM_EnvironmentBase *env, uintptr_t index);
+	void flushAllDirtyCardBuffers(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop draining the queue and fall back to scanning the card table for the rest of the cycle.
+	 */
+	MMINLINE void invalidateDirtyCardQueue()
+	{
+		_dirtyCardQueueOverflowed = true;
+		_dirtyCardQueueLimit = 0;
+	}
+
+	MMINLINE Card *getNextDirtyCardToClean(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
+	{
+		return _drainDirtyCardQueue ? getNextQueuedDirtyCard(env, cardMask, concurrentCardClean) : getNextDirtyCard(env, cardMask, concurrentCardClean);
+	}
+
+	/**
+	 * Re-dirty a card which was cleaned but could not be completely retraced.
+	 */
+	MMINLINE void redirtyCard(MM_EnvironmentBase *env, Card *card)
+	{
+		*card = (Card)CARD_DIRTY;
+		if (_recordDirtiedCards) {
+			recordDirtiedCard(env, card);
+		}
+	}
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
 		
@@ -235,6 +303,7 @@ protected:
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
 	virtual void prepareCardsForCleaning(MM_EnvironmentBase *env);
+	virtual void recordDirtiedCard(MM_EnvironmentBase *env, Card *card);
 	virtual bool getExclusiveCardTableAccess(MM_EnvironmentBase *env, CardCleanPhase currentPhase, bool threadAtSafePoint);
 	virtual void releaseExclusiveCardTableAccess(MM_EnvironmentBase *env);
 	
@@ -395,6 +464,28 @@ public:
 	 *
 	 */
 	bool finalCleanCards(MM_EnvironmentBase *env, uintptr_t *bytesTraced);
+
+	/**
+	 * Move the cards in the dirty card buffer of the given thread to the dirty card queue.
+	 * @param[in] env The thread owning the buffer, or any thread if the owner is stopped
+	 */
+	void flushDirtyCardBuffer(MM_EnvironmentBase *env);
+
+	/**
+	 * Empty the dirty card queue, and the dirty card buffers of all threads, at the end of a global
+	 * collection. Cards are not dirtied or queued again until the queue is next activated.
+	 * @note Called only from MM_ConcurrentGC, with exclusive VM access
+	 */
+	void resetDirtyCardQueue(MM_EnvironmentBase *env);
+
+	/**
+	 * Start queueing the cards dirtied by the write barrier, as concurrent tracing is about to start.
+	 * The cards dirtied before then need no cleaning, as no object has been traced yet.
+	 * @note Called only from MM_ConcurrentGC, with exclusive VM access, so the mutators see the
+	 * change without the write barrier having to order its card store before the check
+	 */
+	void activateDirtyCardQueue(MM_EnvironmentBase *env);
+
 	/**
 	 * Determine whether the referenced object is within a dirty card. Used if
 	 * object reference may not be in tenure or nursery.
@@ -476,6 +567,17 @@ public:
 		_tlhMarkBits(NULL),
 		_cardTableReconfigured(false),
 		_cleanAllCards(false),
+		_dirtyCardQueue(NULL),
+		_dirtyCardQueueSize(0),
+		_dirtyCardQueueTop(0),
+		_dirtyCardQueueNext(0),
+		_dirtyCardQueueLimit(0),
+		_dirtyCardQueueOverflowed(false),
+		_drainDirtyCardQueue(false),
+		_dirtyCardQueueMonitor(NULL),
+		_dirtyCardQueueWaiters(0),
+		_extraCardCleaningPasses(0),
+		_dirtyCardsAtLastPassCheck(UDATA_MAX),
 		_omrVM(env->getOmrVM()),
 		_collector(collector),
 		_extensions(MM_GCExtensionsBase::getExtensions(_omrVM)),
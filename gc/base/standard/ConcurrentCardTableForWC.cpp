@@ -90,6 +90,9 @@ MM_ConcurrentCardTableForWC::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	/* Override default card cleaning masks used by getNextDirtycard */
 	_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK_FOR_WC;
 	_finalCardCleanMask = FINAL_CARD_CLEAN_MASK_FOR_WC;
+
+	/* Cards are only cleaned once the whole card table has been prepared, so there is nothing to gain from queueing them */
+	_recordDirtiedCards = false;
 	
 	return true;
 	
@@ -38,6 +38,8 @@ MM_ConcurrentFinalCleanCardsTask::run(MM_EnvironmentBase *envBase)
 void
 MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 {
+	env->_cardCleaningStats.clear();
+
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
@@ -49,6 +51,8 @@ MM_ConcurrentFinalCleanCardsTask::setup(MM_EnvironmentBase *env)
 void
 MM_ConcurrentFinalCleanCardsTask::cleanup(MM_EnvironmentBase *env)
 {
+	_collector->mergeFinalCardCleaningStats(env);
+
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
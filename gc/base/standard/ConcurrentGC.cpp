@@ -318,7 +318,15 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		(uintptr_t)cardTable->getCardTableStats()->_dirtyCardQueueDrained,
+		(uintptr_t)cardTable->getCardTableStats()->_dirtyCardQueueOverflowed,
+		cardTable->getCardTableStats()->_dirtyCardsQueued,
+		cardTable->getCardTableStats()->_dirtyCardsAtConcurrentCleaning,
+		cardTable->getCardTableStats()->_dirtyCardsAtFinalCleaning,
+		cardTable->getCardTableStats()->_extraCardCleaningPasses,
+		cardTable->getCardTableStats()->_predictedFinalCardCleaningTime,
+		(uintptr_t)cardTable->getCardTableStats()->_lastCardCleaningPassReducedDirtyCards
 	);
 }
 
@@ -2113,8 +2121,8 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 				} else {
 					/* Register for this thread to get called back at safe point */
 					_callback->requestCallback(env);
-					/* ..and return so that thread can get to a safe point */
-					taxPaid = true;
+					/* ..and return so that thread can get to a safe point, unless the callback was run right away */
+					taxPaid = (CONCURRENT_INIT_COMPLETE == _stats.getExecutionMode());
 				}
 			} else {
 				/* TODO: Once optimizeConcurrentWB enabled by default this code will be deleted */
@@ -2210,6 +2218,9 @@ MM_ConcurrentGC::signalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env)
 			env->_cycleState = previousCycleState;
 
 			_concurrentDelegate.signalThreadsToActivateWriteBarrier(env);
+			if (NULL != _cardTable) {
+				_cardTable->activateDirtyCardQueue(env);
+			}
 			_stats.switchExecutionMode(CONCURRENT_INIT_COMPLETE, CONCURRENT_ROOT_TRACING);
 			/* Cancel any outstanding call backs on other threads as this thread has done the necessary work */
 			_callback->cancelCallback(env);
@@ -3051,6 +3062,9 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 			bool overflow = false; /* assume the worst case*/
 			uintptr_t overflowCount;
+			uintptr_t cleaningThreads = 1;
+
+			_finalCardCleaningStats.clear();
 
 			do {
 				/* remember count when we start */
@@ -3061,11 +3075,27 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 				((MM_ConcurrentCardTable *)_cardTable)->initializeFinalCardCleaning(env);
 
 				_dispatcher->run(env, &cleanCardsTask);
+				cleaningThreads = cleanCardsTask.getThreadCount();
 
 				/* Have we had a work stack overflow whilst processing card table ? */
 				overflow = (overflowCount != _stats.getConcurrentWorkStackOverflowCount());
 			} while (overflow);
 
+			/* Learn the final card cleaning time per card, which predicts the time the next final card
+			 * cleaning takes from the number of dirty cards (see finalCardCleaningPauseTarget). The threads
+			 * clean in parallel, so the time of a card is the time all threads spent over the cards cleaned
+			 * and the number of threads. Too few cards would mostly measure the cost of starting the task.
+			 */
+			if (FINAL_CARD_CLEANING_MINIMUM_SAMPLE_CARDS <= _finalCardCleaningStats._cardsCleaned) {
+				float cleaningTime = (float)omrtime_hires_delta(0, _finalCardCleaningStats._cardCleaningTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				float timePerCard = cleaningTime / (float)(_finalCardCleaningStats._cardsCleaned * cleaningThreads);
+				if (0 == _finalCardCleaningTimePerCard) {
+					_finalCardCleaningTimePerCard = timePerCard;
+				} else {
+					_finalCardCleaningTimePerCard = MM_Math::weightedAverage(_finalCardCleaningTimePerCard, timePerCard, CARD_CLEANING_HISTORY_WEIGHT);
+				}
+			}
+
 			/* reset overflow flag */
 			_markingScheme->getWorkPackets()->clearOverflowFlag();
 
@@ -3143,6 +3173,11 @@ MM_ConcurrentGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	 */
 	assume(_cardTable->isTLHMarkBitsEmpty(env),"TLH mark map not empty");
 
+	if (NULL != _cardTable) {
+		/* Cards dirtied from now on need not be cleaned until the next cycle */
+		_cardTable->resetDirtyCardQueue(env);
+	}
+
 	/* Re tune for next concurrent cycle if we have had a heap resize or we got far enough
 	 * last time. We only re-tune on a system GC in the event of a heap resize.
 	 */
@@ -3431,6 +3466,8 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
  	uintptr_t totalTraced = 0;
  	uintptr_t totalCleaned = 0;
  	uintptr_t bytesCleaned;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t cleanStartTime = omrtime_hires_clock();
 
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 
@@ -3501,6 +3538,8 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
 	flushLocalBuffers(env);
 	_stats.incFinalTraceCount(totalTraced);
 	_stats.incFinalCardCleanCount(totalCleaned);
+
+	env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
 }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
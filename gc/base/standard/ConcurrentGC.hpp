@@ -109,6 +109,7 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define INITIAL_OLD_AREA_NON_LEAF_FACTOR ((float)0.4)
 #define NON_LEAF_HISTORY_WEIGHT ((float)0.8)
 #define CARD_CLEANING_HISTORY_WEIGHT ((float)0.7)
+#define FINAL_CARD_CLEANING_MINIMUM_SAMPLE_CARDS 64
 #define CONCURRENT_HELPER_HISTORY_WEIGHT ((float)0.6) 
 #define BYTES_TRACED_IN_PASS_1_HISTORY_WEIGHT ((float)0.8)
 	
@@ -247,6 +248,8 @@ private:
 	float _maxCardCleaningFactorPass1;
 	float _maxCardCleaningFactorPass2;
 	float _cardCleaningThresholdFactor;
+	MM_CardCleaningStats _finalCardCleaningStats; /**< Card cleaning statistics of all threads for the last final card cleaning */
+	float _finalCardCleaningTimePerCard; /**< Historical average of the final card cleaning time per card cleaned, in microseconds (0 until measured) */
 
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
@@ -429,6 +432,18 @@ public:
 
 	void finalCleanCards(MM_EnvironmentBase *env);
 
+	/**
+	 * Add the card cleaning statistics of a thread which took part in final card cleaning.
+	 */
+	MMINLINE void mergeFinalCardCleaningStats(MM_EnvironmentBase *env) { _finalCardCleaningStats.merge(&env->_cardCleaningStats); }
+
+	/**
+	 * Predict how long final card cleaning would take to clean a number of dirty cards, based on
+	 * the time per card of previous final card cleanings.
+	 * @return the predicted time in microseconds, 0 if there is no history yet
+	 */
+	MMINLINE uintptr_t predictFinalCardCleaningTime(uintptr_t dirtyCards) { return (uintptr_t)((float)dirtyCards * _finalCardCleaningTimePerCard); }
+
 	/**
 	 * Flush local buffers
 	 * (local reference object buffer, work packets)
@@ -508,6 +523,8 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_finalCardCleaningStats()
+		,_finalCardCleaningTimePerCard(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
@@ -175,7 +175,8 @@ MM_ConcurrentOverflow::overflowItemInternal(MM_EnvironmentBase *env, void *item,
 	if ((PACKET_ARRAY_SPLIT_TAG != ((UDATA)item & PACKET_ARRAY_SPLIT_TAG)) && (item >= heapBase) && (item <  heapTop)) {
 	/* ..and dirty its card if it is */
 		omrobjectptr_t objectPtr = (omrobjectptr_t)item;
-		cardTable->dirtyCard(envStandard, objectPtr);
+		/* Not dirtyCard(), as the card must be dirtied even before the write barrier is */
+		cardTable->dirtyCardWithValue(envStandard, objectPtr, CARD_DIRTY);
 		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
 		globalCollector->getMarkingScheme()->getMarkingDelegate()->handleWorkPacketOverflowItem(env,objectPtr);
 	}
@@ -36,13 +36,16 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 bool
-MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount)
+MM_CopyScanCacheList::initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->cacheListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	Assert_MM_true(0 < nodeCount);
+	_nodeCount = nodeCount;
+	_sublistsPerNode = extensions->cacheListSplit;
+	Assert_MM_true(0 < _sublistsPerNode);
+	_sublistCount = _sublistsPerNode * _nodeCount;
 
 	_sublists = (struct CopyScanCacheSublist *)extensions->getForge()->allocate(sizeof(struct CopyScanCacheSublist) * _sublistCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (NULL == _sublists) {
@@ -317,35 +320,52 @@ MM_CopyScanCacheList::pushCache(MM_EnvironmentBase *env, MM_CopyScanCacheStandar
 	list->_cacheLock.release();
 }
 
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	if (NULL != list->_cacheHead) {
+		env->_scavengerStats._acquireListLockCount += 1;
+		list->_cacheLock.acquire();
+		cache = list->_cacheHead;
+		if (NULL != cache) {
+			decrementCount(list, 1);
+			list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+
+			if (NULL == list->_cacheHead) {
+				Assert_MM_true(0 == list->_entryCount);
+			}
+		}
+		list->_cacheLock.release();
+	}
+
+	return cache;
+}
+
 MM_CopyScanCacheStandard *
 MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 {
 	uintptr_t index = getSublistIndex(env);
+	uintptr_t homeNode = index / _sublistsPerNode;
+	uintptr_t offset = index % _sublistsPerNode;
 	MM_CopyScanCacheStandard *cache = NULL;
 
-	for (uintptr_t i = 0; i < _sublistCount; i++) {
-		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+	/* visit the sublists of the home node first, and only then those of the other nodes (if partitioned) */
+	for (uintptr_t node = 0; (NULL == cache) && (node < _nodeCount); node++) {
+		uintptr_t nodeBase = ((homeNode + node) % _nodeCount) * _sublistsPerNode;
 
-		if (NULL != list->_cacheHead) {
-			env->_scavengerStats._acquireListLockCount += 1;
-			list->_cacheLock.acquire();
-			cache = list->_cacheHead;
+		for (uintptr_t i = 0; i < _sublistsPerNode; i++) {
+			cache = popCacheFromSublist(env, &_sublists[nodeBase + ((offset + i) % _sublistsPerNode)]);
 			if (NULL != cache) {
-				decrementCount(list, 1);
-				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
-
-				if (NULL == list->_cacheHead) {
-					Assert_MM_true(0 == list->_entryCount);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				if (0 != node) {
+					env->_scavengerStats._remoteNodeScanCacheCount += 1;
 				}
-			}
-			list->_cacheLock.release();
-
-			if (NULL != cache) {
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				break;
 			}
 		}
-
-		index = (index + 1) % _sublistCount;
 	}
 
 	return cache;
@@ -75,6 +75,8 @@ private:
 	
 	struct CopyScanCacheSublist *_sublists;	/**< An array of CopyScanCacheSublist structures which is _sublistCount elements long */
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< the number of NUMA nodes the sublists are partitioned for (1 if not partitioned) */
+	uintptr_t _sublistsPerNode; /**< the number of consecutive sublists belonging to each node (_sublistCount / _nodeCount) */
 	
 	MM_CopyScanCacheChunk *_chunkHead; 
 	uintptr_t _incrementEntryCount;
@@ -93,7 +95,8 @@ private:
 
 	/**
 	 * Hash the specified environment to determine what sublist index
-	 * it should use
+	 * it should use. If the list is partitioned by NUMA node, the index
+	 * is within the group of sublists belonging to the node of the environment.
 	 * 
 	 * @param env the current environment
 	 * 
@@ -101,8 +104,20 @@ private:
 	 */
 	uintptr_t getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t index = env->getEnvironmentId() % _sublistsPerNode;
+		if (1 < _nodeCount) {
+			index += (MM_EnvironmentStandard::getEnvironment(env)->_scavengerNUMANodeIndex % _nodeCount) * _sublistsPerNode;
+		}
+		return index;
 	}
+
+	/**
+	 * Pop a cache entry from the specified sublist.
+	 * @param env[in] the current GC thread
+	 * @param list[in] the sublist to pop from
+	 * @return the cache entry, or NULL if the sublist is empty
+	 */
+	MM_CopyScanCacheStandard *popCacheFromSublist(MM_EnvironmentBase *env, CopyScanCacheSublist *list);
 	
 	/**
 	 * Increment the sublist counter by the specified amount
@@ -126,7 +141,14 @@ private:
 
 protected:
 public:
-	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount);
+	/**
+	 * Initialize the list.
+	 * @param env[in] the current thread
+	 * @param cachedEntryCount[in] optional shared count of non-empty sublists, may be NULL
+	 * @param nodeCount[in] the number of NUMA nodes to partition the sublists for (1 for no partitioning)
+	 * @return true on success, false otherwise
+	 */
+	bool initialize(MM_EnvironmentBase *env, volatile uintptr_t *cachedEntryCount, uintptr_t nodeCount = 1);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
 	/**
@@ -189,6 +211,8 @@ public:
 
 	/**
 	 * Pop a cache entry from this list.
+	 * If the list is partitioned by NUMA node, the sublists of the node of the current thread
+	 * are searched first, and entries of other nodes are only taken if the local ones are empty.
 	 * @param env[in] the current GC thread
 	 * @return the cache entry, or NULL if the list is empty
 	 */
@@ -202,6 +226,8 @@ public:
 		, _allocationInHeap(false)
 		, _sublists(NULL)
 		, _sublistCount(0)
+		, _nodeCount(1)
+		, _sublistsPerNode(0)
 		, _chunkHead(NULL)
 		, _incrementEntryCount(0)
 		, _totalAllocatedEntryCount(0)
@@ -24,6 +24,9 @@
 
 #include "omrcfg.h"
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#include "ConcurrentCardTable.hpp"
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -95,6 +98,13 @@ MM_EnvironmentStandard::flushNonAllocationCaches()
 void
 MM_EnvironmentStandard::flushGCCaches(bool final)
 {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	if (0 != _dirtyCardBufferCount) {
+		/* Only the concurrent card table records dirtied cards */
+		((MM_ConcurrentCardTable *)getExtensions()->cardTable)->flushDirtyCardBuffer(this);
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (getExtensions()->concurrentScavenger) {
 		if (MUTATOR_THREAD == getThreadType()) {
@@ -32,6 +32,7 @@
 #include "j9nongenerated.h"
 #include "omrport.h"
 #include "modronopt.h"
+#include "omrmodroncore.h"
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -39,6 +40,10 @@
 
 class MM_CopyScanCacheStandard;
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define DIRTY_CARD_BUFFER_SIZE 64
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Env
@@ -66,6 +71,13 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _scavengerNUMANodeIndex; /**< index (into the NUMA affinity leaders) of the node this thread works for in a NUMA partitioned scavenge, 0 if not partitioned */
+	uintptr_t _scavengerNUMAPreviousNode; /**< j9NodeNumber of the affinity this thread had before a NUMA partitioned scavenge rebound it (0 for no affinity) */
+	bool _scavengerNUMARebound; /**< true if this thread's affinity was changed for the current NUMA partitioned scavenge and must be restored at its end */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	Card *_dirtyCardBuffer[DIRTY_CARD_BUFFER_SIZE]; /**< Cards this thread dirtied which are not yet flushed to the dirty card queue (concurrentCardCleaningQueue) */
+	uintptr_t _dirtyCardBufferCount; /**< Number of cards in _dirtyCardBuffer */
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 protected:
 
@@ -98,6 +110,12 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_scavengerNUMANodeIndex(0)
+		,_scavengerNUMAPreviousNode(0)
+		,_scavengerNUMARebound(false)
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_dirtyCardBufferCount(0)
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "ut_j9mm.h"
+#include "ModronAssertions.h"
+
+#include "NurseryPreZeroer.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+
+MM_NurseryPreZeroer *
+MM_NurseryPreZeroer::newInstance(MM_EnvironmentBase *env)
+{
+	MM_NurseryPreZeroer *preZeroer = (MM_NurseryPreZeroer *)env->getForge()->allocate(sizeof(MM_NurseryPreZeroer), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != preZeroer) {
+		new (preZeroer) MM_NurseryPreZeroer(env);
+		if (!preZeroer->initialize(env)) {
+			preZeroer->kill(env);
+			preZeroer = NULL;
+		}
+	}
+	return preZeroer;
+}
+
+MM_NurseryPreZeroer::MM_NurseryPreZeroer(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _low(0)
+	, _current(0)
+	, _high(0)
+	, _zeroingChunk(false)
+	, _threadState(THREAD_NONE)
+{
+	_typeId = __FUNCTION__;
+}
+
+void
+MM_NurseryPreZeroer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_NurseryPreZeroer::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_NurseryPreZeroer::monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+	return true;
+}
+
+void
+MM_NurseryPreZeroer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		shutDown();
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+void
+MM_NurseryPreZeroer::shutDown()
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_RUNNING == _threadState) {
+		_threadState = THREAD_SHUTDOWN_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_NONE != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	_low = 0;
+	_current = 0;
+	_high = 0;
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_NurseryPreZeroer::startZeroing(MM_EnvironmentBase *env, MM_MemorySubSpace *survivorSubSpace)
+{
+	MM_MemoryPool *memoryPool = survivorSubSpace->getMemoryPool();
+	bool const compressed = env->compressObjectReferences();
+
+	/* After a successful scavenge survivor space is empty, so this is normally the whole of it */
+	MM_HeapLinkedFreeHeader *largestEntry = NULL;
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+	while (NULL != freeEntry) {
+		if ((NULL == largestEntry) || (freeEntry->getSize() > largestEntry->getSize())) {
+			largestEntry = freeEntry;
+		}
+		freeEntry = freeEntry->getNext(compressed);
+	}
+
+	omrthread_monitor_enter(_monitor);
+	Assert_MM_false(_zeroingChunk);
+	if (THREAD_NONE == _threadState) {
+		/* The first time round - the scavenger is created after the collectors are started up */
+		startThread();
+	}
+	if ((THREAD_RUNNING == _threadState) && (NULL != largestEntry)) {
+		_low = (uintptr_t)largestEntry;
+		_current = (uintptr_t)largestEntry + sizeof(MM_HeapLinkedFreeHeader);
+		_high = (uintptr_t)largestEntry->afterEnd();
+		omrthread_monitor_notify_all(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_NurseryPreZeroer::stopZeroing(MM_EnvironmentBase *env, uintptr_t *low, uintptr_t *high)
+{
+	omrthread_monitor_enter(_monitor);
+	while (_zeroingChunk) {
+		omrthread_monitor_wait(_monitor);
+	}
+	*low = _low;
+	*high = _current;
+	Trc_MM_NurseryPreZeroer_stopZeroing(env->getLanguageVMThread(), _current - _low, _high - _current);
+	_low = 0;
+	_current = 0;
+	_high = 0;
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_NurseryPreZeroer::waitUntilZeroed()
+{
+	omrthread_monitor_enter(_monitor);
+	while ((THREAD_RUNNING == _threadState) && (_current < _high)) {
+		omrthread_monitor_wait(_monitor);
+	}
+	bool zeroed = (0 != _high) && (_current == _high);
+	omrthread_monitor_exit(_monitor);
+	return zeroed;
+}
+
+void
+MM_NurseryPreZeroer::startThread()
+{
+	omrthread_t thread = NULL;
+	_threadState = THREAD_RUNNING;
+	if (0 != createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN, 0, preZeroThreadProc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		/* Zeroing ahead is only an optimization, the TLHs are cleared when handed out instead */
+		_threadState = THREAD_FAILED;
+	}
+}
+
+int J9THREAD_PROC
+MM_NurseryPreZeroer::preZeroThreadProc(void *info)
+{
+	MM_NurseryPreZeroer *preZeroer = (MM_NurseryPreZeroer *)info;
+	preZeroer->preZeroThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_NurseryPreZeroer::preZeroThreadEntryPoint()
+{
+	omrthread_monitor_enter(_monitor);
+	while (THREAD_RUNNING == _threadState) {
+		if (_current < _high) {
+			uintptr_t chunkLow = _current;
+			uintptr_t chunkHigh = OMR_MIN(_high, chunkLow + PREZERO_CHUNK_SIZE);
+			_zeroingChunk = true;
+			omrthread_monitor_exit(_monitor);
+			OMRZeroMemory((void *)chunkLow, chunkHigh - chunkLow);
+			omrthread_monitor_enter(_monitor);
+			_zeroingChunk = false;
+			_current = chunkHigh;
+			omrthread_monitor_notify_all(_monitor);
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	_threadState = THREAD_NONE;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(NURSERYPREZEROER_HPP_)
+#define NURSERYPREZEROER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MemorySubSpace;
+
+/**
+ * Zeroes the free memory of survivor space between scavenges, on a minimum priority background thread, so
+ * the mutators do not have to clear the batch cleared TLHs carved from it once it has become allocate space.
+ *
+ * Survivor space is not used by anyone between scavenges, so it can be zeroed without synchronizing with
+ * the mutators. The scavenger stops the thread when a collection starts, and gets the range zeroed so far:
+ * copying into survivor space writes objects only at the start of the free entries it allocates from,
+ * so once the scavenge is done, the free memory left in that range is still zero apart from the headers of
+ * the free entries, which are at the start of any TLH carved from them.
+ */
+class MM_NurseryPreZeroer : public MM_BaseVirtual
+{
+/* Data members & types */
+public:
+protected:
+private:
+	enum {
+		PREZERO_CHUNK_SIZE = 256 * 1024, /**< Most bytes zeroed between checks for a stop request */
+	};
+
+	enum ThreadState {
+		THREAD_NONE = 0,
+		THREAD_RUNNING,
+		THREAD_SHUTDOWN_REQUESTED,
+		THREAD_FAILED, /**< The thread could not be created, nothing is zeroed */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< Protects the range and the thread state */
+	uintptr_t _low; /**< Start of the free entry being zeroed, 0 if none */
+	uintptr_t _current; /**< Everything in [_low, _current) is zero apart from the free entry header */
+	uintptr_t _high; /**< End of the free entry being zeroed */
+	bool _zeroingChunk; /**< True while the thread zeroes the chunk at _current without holding the monitor */
+	ThreadState _threadState; /**< State of the background thread */
+
+/* Methods */
+public:
+	static MM_NurseryPreZeroer *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background thread. Memory left to zero is not zeroed.
+	 */
+	void shutDown();
+
+	/**
+	 * Start zeroing the largest free entry of survivor space, starting the background thread if need be. Must be
+	 * called with exclusive access, after the survivor space of the next scavenge is known (the flip and any
+	 * resize are done).
+	 */
+	void startZeroing(MM_EnvironmentBase *env, MM_MemorySubSpace *survivorSubSpace);
+
+	/**
+	 * Stop zeroing, waiting for the chunk being zeroed. Must be called with exclusive access.
+	 * @param[out] low start of the range zeroed since startZeroing()
+	 * @param[out] high end of the range zeroed since startZeroing(), equal to low if nothing was zeroed
+	 */
+	void stopZeroing(MM_EnvironmentBase *env, uintptr_t *low, uintptr_t *high);
+
+	/**
+	 * Wait until the background thread has zeroed all of the range given by startZeroing(), or is no longer running.
+	 * @return true if there was a range to zero and all of it was zeroed
+	 */
+	bool waitUntilZeroed();
+
+	MM_NurseryPreZeroer(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Create the background thread. The monitor must be held.
+	 */
+	void startThread();
+
+	static int J9THREAD_PROC preZeroThreadProc(void *info);
+	void preZeroThreadEntryPoint();
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+#endif /* NURSERYPREZEROER_HPP_ */
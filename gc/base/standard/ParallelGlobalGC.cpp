@@ -722,7 +722,10 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if (!_extensions->concurrentSweep)
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		{
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -1643,6 +1646,9 @@ MM_ParallelGlobalGC::reportGCIncrementStart(MM_EnvironmentBase *env)
 		Assert_MM_unreachable();
 	}
 
+	/* task stats cover this increment only */
+	_extensions->dispatcher->clearTaskStats(env);
+
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_START(
 		_extensions->privateHookInterface,
 		env->getOmrVMThread(),
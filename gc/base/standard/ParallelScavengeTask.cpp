@@ -59,6 +59,9 @@ MM_ParallelScavengeTask::setup(MM_EnvironmentBase *env)
 void
 MM_ParallelScavengeTask::cleanup(MM_EnvironmentBase *env)
 {
+	MM_ScavengerStats *scavengerStats = &env->_scavengerStats;
+	addCompletedWork(scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes);
+
 	if (env->isMainThread()) {
 		Assert_MM_true(_cycleState == env->_cycleState);
 	} else {
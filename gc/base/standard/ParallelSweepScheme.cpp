@@ -341,14 +341,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = _extensions->heapMapRunFinder.findNonEmptySlot(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -518,11 +511,24 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		/* Check if the map slot is part of a candidate free list entry */
 		sweepMarkMapBody(markMapCurrent, markMapChunkTop, markMapFreeHead, heapSlotFreeCount, heapSlotFreeCurrent, heapSlotFreeHead);
 		if (0 == heapSlotFreeCount) {
-			darkMatterCandidates += 1;
-			if (0 == (darkMatterCandidates % darkMatterSampleRate)) {
-				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent, heapSlotFreeCurrent);
+			/* Skip the whole run of map slots with objects in them. Each is a dark matter candidate, and every
+			 * darkMatterSampleRate'th one is sampled.
+			 */
+			uintptr_t *markMapLiveTop = _extensions->heapMapRunFinder.findEmptySlot(markMapCurrent + 1, markMapChunkTop);
+			uintptr_t liveSlotCount = markMapLiveTop - markMapCurrent;
+			uintptr_t nextSample = darkMatterSampleRate - (darkMatterCandidates % darkMatterSampleRate);
+			while (nextSample <= liveSlotCount) {
+				uintptr_t sampleIndex = nextSample - 1;
+				darkMatterBytes += performSamplingCalculations(sweepChunk, markMapCurrent + sampleIndex, heapSlotFreeCurrent + (J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * sampleIndex));
 				darkMatterSamples += 1;
+				nextSample += darkMatterSampleRate;
 			}
+			darkMatterCandidates += liveSlotCount;
+
+			/* Proceed to the first empty map slot after the run */
+			heapSlotFreeCurrent += J9MODRON_HEAP_SLOTS_PER_MARK_SLOT * liveSlotCount;
+			markMapCurrent = markMapLiveTop;
+			continue;
 		} else {
 			/* There is at least a single free slot in the mark map - check the head and tail */
 			sweepMarkMapHead(markMapFreeHead, markMapChunkBase, heapSlotFreeHead, heapSlotFreeCount);
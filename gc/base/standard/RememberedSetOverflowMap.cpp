@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "RememberedSetOverflowMap.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MarkMap.hpp"
+#include "MarkingScheme.hpp"
+#include "MemoryManager.hpp"
+#include "ParallelGlobalGC.hpp"
+
+MM_RememberedSetOverflowMap *
+MM_RememberedSetOverflowMap::newInstance(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_RememberedSetOverflowMap *overflowMap = (MM_RememberedSetOverflowMap *)env->getForge()->allocate(sizeof(MM_RememberedSetOverflowMap), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != overflowMap) {
+		new(overflowMap) MM_RememberedSetOverflowMap(env, extensions->heap->getMaximumPhysicalRange());
+		if (!overflowMap->initialize(env)) {
+			overflowMap->kill(env);
+			overflowMap = NULL;
+		}
+	}
+	return overflowMap;
+}
+
+bool
+MM_RememberedSetOverflowMap::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_HeapMap::initialize(env)) {
+		return false;
+	}
+
+	/* The scavenger is not told when tenure space grows or shrinks, so commit the map for the whole heap */
+	_heapTop = (void *)((uintptr_t)_heapBase + _maxHeapSize);
+	if (!_extensions->memoryManager->commitMemory(&_heapMapMemoryHandle, _heapMapBits, getMaximumHeapMapSize(env))) {
+		return false;
+	}
+
+	_cardCount = (_maxHeapSize + OVERFLOW_CARD_SIZE - 1) >> OVERFLOW_CARD_SIZE_SHIFT;
+	_cards = (uint8_t *)env->getForge()->allocate(_cardCount, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	memset(_cards, 0, _cardCount);
+
+	return true;
+}
+
+void
+MM_RememberedSetOverflowMap::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cards) {
+		env->getForge()->free(_cards);
+		_cards = NULL;
+	}
+
+	MM_HeapMap::tearDown(env);
+}
+
+bool
+MM_RememberedSetOverflowMap::isEmpty()
+{
+	for (uintptr_t cardIndex = 0; cardIndex < _cardCount; cardIndex++) {
+		if (isCardDirty(cardIndex)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+MM_RememberedSetOverflowMap::clear(MM_EnvironmentBase *env)
+{
+	for (uintptr_t cardIndex = 0; cardIndex < _cardCount; cardIndex++) {
+		if (isCardDirty(cardIndex)) {
+			clearCardBits(env, cardIndex);
+			clearCard(cardIndex);
+		}
+	}
+}
+
+void
+MM_RememberedSetOverflowMap::removeUnmarkedObjects(MM_EnvironmentBase *env)
+{
+	MM_MarkMap *markMap = ((MM_ParallelGlobalGC *)_extensions->getGlobalCollector())->getMarkingScheme()->getMarkMap();
+	Assert_MM_true(_heapMapBaseDelta == markMap->getHeapMapBaseRegionRounded());
+
+	/* Only the mark map of the tenure space is committed, and only tenured objects are remembered */
+	uintptr_t const tenureLow = (uintptr_t)_extensions->heapBaseForBarrierRange0;
+	uintptr_t const tenureHigh = tenureLow + _extensions->heapSizeForBarrierRange0;
+	uintptr_t const bytesPerSlot = (uintptr_t)1 << _heapMapIndexShift;
+
+	for (uintptr_t cardIndex = 0; cardIndex < _cardCount; cardIndex++) {
+		if (isCardDirty(cardIndex)) {
+			bool retained = false;
+			uintptr_t high = (uintptr_t)getCardHigh(cardIndex);
+			for (uintptr_t address = (uintptr_t)getCardLow(cardIndex); address < high; address += bytesPerSlot) {
+				uintptr_t slotIndex = (address - _heapMapBaseDelta) >> _heapMapIndexShift;
+				uintptr_t slot = getSlot(slotIndex);
+				if (0 != slot) {
+					if ((tenureLow <= address) && ((address + bytesPerSlot) <= tenureHigh)) {
+						slot &= markMap->getSlot(slotIndex);
+					} else {
+						slot = 0;
+					}
+					setSlot(slotIndex, slot);
+					retained = retained || (0 != slot);
+				}
+			}
+			if (!retained) {
+				clearCard(cardIndex);
+			}
+		}
+	}
+}
+
+void
+MM_RememberedSetOverflowMap::clearCardBits(MM_EnvironmentBase *env, uintptr_t cardIndex)
+{
+	uintptr_t const bytesPerSlot = (uintptr_t)1 << _heapMapIndexShift;
+	uintptr_t baseIndex = ((uintptr_t)getCardLow(cardIndex) - _heapMapBaseDelta) >> _heapMapIndexShift;
+	uintptr_t topIndex = ((uintptr_t)getCardHigh(cardIndex) - _heapMapBaseDelta + bytesPerSlot - 1) >> _heapMapIndexShift;
+	memset(&_heapMapBits[baseIndex], 0, (topIndex - baseIndex) * sizeof(uintptr_t));
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
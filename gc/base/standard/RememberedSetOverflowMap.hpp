@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(REMEMBEREDSETOVERFLOWMAP_HPP_)
+#define REMEMBEREDSETOVERFLOWMAP_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "HeapMap.hpp"
+
+/**
+ * Records the remembered objects which did not fit in the remembered set, so an overflowed remembered set can be
+ * scanned without walking the tenure space (see MM_RSOverflow).
+ *
+ * Objects are recorded by setting their bit in a heap map of their own, so recording an object twice is harmless,
+ * and the card (OVERFLOW_CARD_SIZE bytes of the heap) holding each recorded object is flagged, so the map is scanned by card
+ * and clean cards are skipped. The whole map is committed up front, but only the pages holding recorded objects are
+ * ever touched.
+ */
+class MM_RememberedSetOverflowMap : public MM_HeapMap
+{
+/* Data members & types */
+public:
+	enum {
+		OVERFLOW_CARD_SIZE_SHIFT = 15, /**< Each card covers 32KB of the heap */
+		OVERFLOW_CARD_SIZE = (1 << OVERFLOW_CARD_SIZE_SHIFT),
+	};
+
+protected:
+private:
+	uint8_t *_cards; /**< One byte per card of the heap, non-zero if an object in the card may be recorded */
+	uintptr_t _cardCount; /**< Number of cards covering the heap */
+
+/* Methods */
+public:
+	static MM_RememberedSetOverflowMap *newInstance(MM_EnvironmentBase *env);
+
+	/**
+	 * Record a remembered object. May be called by several threads at once.
+	 */
+	MMINLINE void
+	addObject(omrobjectptr_t objectPtr)
+	{
+		atomicSetBit(objectPtr);
+		uint8_t *card = &_cards[cardIndexForAddress(objectPtr)];
+		if (0 == *card) {
+			*card = 1;
+		}
+	}
+
+	/**
+	 * Forget a recorded object. Only the thread which owns the object's card may call this.
+	 */
+	MMINLINE void removeObject(omrobjectptr_t objectPtr) { clearBit(objectPtr); }
+
+	MMINLINE uintptr_t getCardCount() { return _cardCount; }
+	MMINLINE bool isCardDirty(uintptr_t cardIndex) { return 0 != _cards[cardIndex]; }
+	MMINLINE void clearCard(uintptr_t cardIndex) { _cards[cardIndex] = 0; }
+	MMINLINE uintptr_t *getCardLow(uintptr_t cardIndex) { return (uintptr_t *)(_heapMapBaseDelta + (cardIndex << OVERFLOW_CARD_SIZE_SHIFT)); }
+	MMINLINE uintptr_t *getCardHigh(uintptr_t cardIndex) { return (uintptr_t *)OMR_MIN(_heapMapBaseDelta + ((cardIndex + 1) << OVERFLOW_CARD_SIZE_SHIFT), (uintptr_t)_heapTop); }
+
+	/**
+	 * @return true if no card is dirty
+	 */
+	bool isEmpty();
+
+	/**
+	 * Forget every recorded object.
+	 */
+	void clear(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the recorded objects which the global collection that just completed found dead, and any
+	 * recorded outside the tenure space. Must be called while the global collector's mark map is valid.
+	 */
+	void removeUnmarkedObjects(MM_EnvironmentBase *env);
+
+	MM_RememberedSetOverflowMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+		: MM_HeapMap(env, maxHeapSize)
+		, _cards(NULL)
+		, _cardCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	MMINLINE uintptr_t cardIndexForAddress(void *address) { return ((uintptr_t)address - _heapMapBaseDelta) >> OVERFLOW_CARD_SIZE_SHIFT; }
+
+	/**
+	 * Clear the map bits of the card.
+	 */
+	void clearCardBits(MM_EnvironmentBase *env, uintptr_t cardIndex);
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETOVERFLOWMAP_HPP_ */
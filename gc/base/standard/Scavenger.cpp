@@ -59,14 +59,18 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceRegionIterator.hpp"
 #include "MemorySubSpaceRegionIteratorStandard.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
+#include "NurseryPreZeroer.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
@@ -76,6 +80,7 @@
 #include "ParallelDispatcher.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RememberedSetOverflowMap.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
@@ -105,9 +110,21 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
-/* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
+/* If scavenger hot field depth copying and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
+/* Every level of child depth copying keeps an object scanner on the stack of the copying thread */
+#define DEPTH_COPY_CHILDREN_MAX 8
+
+/* A NUMA copy reserve chunk is at most this fraction of the survivor space per node */
+#define NUMA_COPY_RESERVE_SURVIVOR_FRACTION 4
+
+/* Most remembered set slots scanned per chunk claimed from a puddle, so large puddles are shared between threads */
+#define REMEMBERED_SET_CHUNK_SLOTS 256
+
+/* Cards of the remembered set overflow map scanned or pruned per work unit */
+#define REMEMBERED_SET_OVERFLOW_MAP_CARDS_PER_WORK_UNIT 64
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -228,10 +245,31 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	uintptr_t scanListNodeCount = 1;
+	if (_extensions->scavengerNUMAPartitioning) {
+		scanListNodeCount = OMR_MAX(1, _extensions->_numaManager.getAffinityLeaderCount());
+	}
+
+	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount, scanListNodeCount)) {
 		return false;
 	}
 
+	/* Concurrent Scavenger copies from mutator threads, which are not assigned to a node */
+	if ((1 < scanListNodeCount) && !_extensions->isConcurrentScavengerEnabled()) {
+		_numaCopyReserves = (NUMACopyReserve *)_extensions->getForge()->allocate(sizeof(NUMACopyReserve) * scanListNodeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _numaCopyReserves) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < scanListNodeCount; i++) {
+			new (&_numaCopyReserves[i]) NUMACopyReserve();
+			if (!_numaCopyReserves[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_numaCopyReserves[]._lock")) {
+				_numaCopyReserveCount = i;
+				return false;
+			}
+		}
+		_numaCopyReserveCount = scanListNodeCount;
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -284,6 +322,32 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
 
+	if ((MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL == _extensions->scavengerScanOrdering) && _extensions->hierarchicalDepthCopy) {
+		_depthCopyChildrenMax = OMR_MIN(_extensions->depthCopyMax, DEPTH_COPY_CHILDREN_MAX);
+	}
+
+	if (0 != _extensions->fvtest_rememberedSetMaximumSize) {
+		_extensions->rememberedSet.setMaxSize(_extensions->fvtest_rememberedSetMaximumSize);
+	}
+
+	/* Concurrent Scavenger scans the remembered set while mutators remember objects, so it keeps the full tenure walk on overflow */
+	if (_extensions->scavengerRememberedSetOverflowMap && !_extensions->isConcurrentScavengerEnabled()) {
+		_rememberedSetOverflowMap = MM_RememberedSetOverflowMap::newInstance(env);
+		if (NULL == _rememberedSetOverflowMap) {
+			return false;
+		}
+	}
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* Pre-zeroed memory only saves clearing batch cleared TLHs; Concurrent Scavenger copies into survivor space while mutators run */
+	if (_extensions->preZeroNurseryInBackground && (0 != _extensions->batchClearTLH) && !_extensions->isConcurrentScavengerEnabled()) {
+		_nurseryPreZeroer = MM_NurseryPreZeroer::newInstance(env);
+		if (NULL == _nurseryPreZeroer) {
+			return false;
+		}
+	}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
 		if (!_mainGCThread.initialize(this, true, true, true)) {
@@ -304,6 +368,27 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _rememberedSetOverflowMap) {
+		_rememberedSetOverflowMap->kill(env);
+		_rememberedSetOverflowMap = NULL;
+	}
+
+	if (NULL != _numaCopyReserves) {
+		for (uintptr_t i = 0; i < _numaCopyReserveCount; i++) {
+			_numaCopyReserves[i]._lock.tearDown();
+		}
+		_extensions->getForge()->free(_numaCopyReserves);
+		_numaCopyReserves = NULL;
+		_numaCopyReserveCount = 0;
+	}
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _nurseryPreZeroer) {
+		_nurseryPreZeroer->kill(env);
+		_nurseryPreZeroer = NULL;
+	}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -351,6 +436,11 @@ MM_Scavenger::collectorShutdown(MM_GCExtensionsBase* extensions)
 		_mainGCThread.shutdown();
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _nurseryPreZeroer) {
+		_nurseryPreZeroer->shutDown();
+	}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 }
 
 /****************************************
@@ -373,6 +463,15 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 
 	_doneIndex = 0;
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _nurseryPreZeroer) {
+		/* Survivor space must not be zeroed once objects are copied into it */
+		_nurseryPreZeroer->stopZeroing(env, &_preZeroedSurvivorLow, &_preZeroedSurvivorHigh);
+		_extensions->preZeroedNurseryLow = 0;
+		_extensions->preZeroedNurseryHigh = 0;
+	}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
 	restoreMainThreadTenureTLHRemainders(env);
 
 	/* Reinitialize the copy scan caches */
@@ -440,8 +539,16 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (NULL != _numaCopyReserves) {
+		/* reserves are refilled with TLHs, and small nurseries must not be hoarded by the reserves of a few nodes */
+		uintptr_t survivorSize = (uintptr_t)_survivorSpaceTop - (uintptr_t)_survivorSpaceBase;
+		_numaCopyReserveSize = OMR_MIN(_extensions->tlhMaximumSize, survivorSize / (_numaCopyReserveCount * NUMA_COPY_RESERVE_SURVIVOR_FRACTION));
+		_numaCopyReserveSize = MM_Math::roundToCeiling(_objectAlignmentInBytes, OMR_MAX(_numaCopyReserveSize, _extensions->scavengerScanCacheMinimumSize));
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
+	_isRememberedSetOverflowRecordedAtTheBeginning = (NULL != _rememberedSetOverflowMap) && _extensions->isRememberedSetOverflowRecorded();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
@@ -462,6 +569,10 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	/* record that this thread is participating in this cycle */
 	env->_scavengerStats._gcCount = _extensions->scavengerStats._gcCount;
 
+	if (_extensions->scavengerNUMAPartitioning) {
+		assignNUMANode(env);
+	}
+
 	/* Reset the local remembered set fragment */
 	env->_scavengerRememberedSet.count = 0;
 	env->_scavengerRememberedSet.fragmentCurrent = NULL;
@@ -479,6 +590,48 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
 }
 
+void
+MM_Scavenger::assignNUMANode(MM_EnvironmentStandard *env)
+{
+	uintptr_t leaderCount = 0;
+	J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+
+	if (1 < leaderCount) {
+		uintptr_t nodeIndex = env->getWorkerID() % leaderCount;
+		env->_scavengerNUMANodeIndex = nodeIndex;
+
+		/* Only bind GC worker threads; the main thread may be a mutator whose affinity is not ours to change */
+		if ((GC_WORKER_THREAD == env->getThreadType())
+			&& _extensions->_numaManager.isPhysicalNUMASupported()
+			&& _extensions->_numaManager.shouldSetCPUAffinity()
+		) {
+			uintptr_t j9NodeNumber = leaders[nodeIndex].j9NodeNumber;
+			uintptr_t previousNode = 0;
+			uintptr_t previousNodeCount = 1;
+			/* an affinity spanning several nodes could not be restored from a single node number, so leave such threads alone */
+			if (env->getNumaAffinity(&previousNode, &previousNodeCount) && (1 == previousNodeCount) && (j9NodeNumber != previousNode)) {
+				if (env->setNumaAffinity(&j9NodeNumber, 1)) {
+					env->_scavengerNUMAPreviousNode = previousNode;
+					env->_scavengerNUMARebound = true;
+				}
+			}
+		}
+	} else {
+		env->_scavengerNUMANodeIndex = 0;
+	}
+}
+
+void
+MM_Scavenger::restoreNUMAAffinity(MM_EnvironmentStandard *env)
+{
+	if (env->_scavengerNUMARebound) {
+		/* node 0 stands for all nodes, which restores the default affinity */
+		env->setNumaAffinity(&env->_scavengerNUMAPreviousNode, 1);
+		env->_scavengerNUMAPreviousNode = 0;
+		env->_scavengerNUMARebound = false;
+	}
+}
+
 uintptr_t
 MM_Scavenger::calculateMaxCacheCount(uintptr_t activeMemorySize)
 {
@@ -754,6 +907,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 {
 	finalGCStats->_rememberedSetOverflow |= scavStats->_rememberedSetOverflow;
 	finalGCStats->_causedRememberedSetOverflow |= scavStats->_causedRememberedSetOverflow;
+	finalGCStats->_rememberedSetOverflowMapCards += scavStats->_rememberedSetOverflowMapCards;
+	finalGCStats->_rememberedSetOverflowMapObjects += scavStats->_rememberedSetOverflowMapObjects;
+	finalGCStats->_rememberedSetOverflowMapRecovered |= scavStats->_rememberedSetOverflowMapRecovered;
 	finalGCStats->_scanCacheOverflow |= scavStats->_scanCacheOverflow;
 	finalGCStats->_scanCacheAllocationFromHeap |= scavStats->_scanCacheAllocationFromHeap;
 	finalGCStats->_scanCacheAllocationDurationDuringSavenger = OMR_MAX(finalGCStats->_scanCacheAllocationDurationDuringSavenger, scavStats->_scanCacheAllocationDurationDuringSavenger);
@@ -781,6 +937,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
+	finalGCStats->_childDepthCopyCount += scavStats->_childDepthCopyCount;
+	finalGCStats->_remoteNodeScanCacheCount += scavStats->_remoteNodeScanCacheCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
 	finalGCStats->_totalDeepStructures += scavStats->_totalDeepStructures;
@@ -800,6 +959,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
+	finalGCStats->_semiSpaceAllocationCountNodeLocal += scavStats->_semiSpaceAllocationCountNodeLocal;
+	finalGCStats->_tenureSpaceAllocationCountNodeLocal += scavStats->_tenureSpaceAllocationCountNodeLocal;
 
 	/* TODO: Fix this. Not true when merging Main GC threads stats for standard (non CS) Scavenger.
 	   Assert_MM_true(finalGCStats->_flipHistoryNewIndex == scavStats->_flipHistoryNewIndex); */
@@ -879,6 +1040,24 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 		scavStats->_releaseFreeListCount,
 		scavStats->_acquireScanListCount,
 		scavStats->_releaseScanListCount);
+
+	if (_extensions->isScavengerHotFieldDepthCopyEnabled()) {
+		Trc_MM_ParallelScavenger_hotFieldCopyStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getWorkerID(),
+			scavStats->_hotFieldCopyCount,
+			scavStats->_childDepthCopyCount,
+			scavStats->_aliasToCopyCacheCount);
+	}
+
+	if (_extensions->scavengerNUMAPartitioning) {
+		Trc_MM_ParallelScavenger_numaStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getWorkerID(),
+			MM_EnvironmentStandard::getEnvironment(env)->_scavengerNUMANodeIndex,
+			scavStats->_remoteNodeScanCacheCount,
+			scavStats->_acquireScanListCount);
+	}
 }
 
 void
@@ -1169,10 +1348,15 @@ retry:
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
-				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if ((NULL != _numaCopyReserves) && allocateFromNUMACopyReserve(env, false, cacheSize, scanCacheSize, addrBase, addrTop, NULL)) {
+					allocateResult = true;
+					env->_scavengerStats._semiSpaceAllocationCountNodeLocal += 1;
+				} else {
+					MM_AllocateDescription allocDescription(0, 0, false, true);
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1291,16 +1475,21 @@ retry:
 				}
 				env->_scavengerStats._tenureSpaceAllocationCountLarge += 1;
 			} else {
-				MM_AllocateDescription allocDescription(0, 0, false, true);
-				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if ((NULL != _numaCopyReserves) && allocateFromNUMACopyReserve(env, true, cacheSize, scanCacheSize, addrBase, addrTop, &satisfiedInLOA)) {
+					allocateResult = true;
+					env->_scavengerStats._tenureSpaceAllocationCountNodeLocal += 1;
+				} else {
+					MM_AllocateDescription allocDescription(0, 0, false, true);
+					allocDescription.setCollectorAllocateExpandOnFailure(true);
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
-				if (allocateResult && allocDescription.isLOAAllocation()) {
-					satisfiedInLOA = true;
-				}
+					if (allocateResult && allocDescription.isLOAAllocation()) {
+						satisfiedInLOA = true;
+					}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+				}
 				env->_scavengerStats._tenureSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1756,8 +1945,13 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 		}
 
-		/* depth copy the hot fields of an object if scavenger dynamicBreadthFirstScanOrdering is enabled */
+		/* depth copy the hot fields of an object if scavenger dynamicBreadthFirstScanOrdering (or hierarchicalDepthCopy) is enabled */
 		depthCopyHotFields(env, forwardedHeader, destinationObjectPtr);
+
+		/* then the rest of its children if hierarchicalDepthCopy is enabled (only within the scavenge task, not from mutator read barriers) */
+		if ((env->_hotFieldCopyDepthCount < _depthCopyChildrenMax) && (NULL != env->_currentTask)) {
+			depthCopyChildren(env, forwardedHeader, destinationObjectPtr);
+		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
 		 * we might have created a TLH remainder from previous cache just before reserving this space. This space eventaully can create another remainder.
@@ -1812,12 +2006,46 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 		MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
 		if (!forwardHeaderHotField.isForwardedPointer()) {
 			env->_hotFieldCopyDepthCount += 1;
-			copyObject(env, &forwardHeaderHotField);
+			if (NULL != copyObject(env, &forwardHeaderHotField)) {
+				env->_scavengerStats._hotFieldCopyCount += 1;
+			}
 			env->_hotFieldCopyDepthCount -= 1;
 		}
 	}
 }
 
+void
+MM_Scavenger::depthCopyChildren(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr)
+{
+	/* the elements of an array are left to the scan, which can split it between threads */
+	if (_extensions->objectModel.isIndexable(forwardedHeader)) {
+		return;
+	}
+
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = getObjectScanner(env, destinationObjectPtr, &objectScannerState, GC_ObjectScanner::scanHeap | GC_ObjectScanner::copyAhead);
+	if ((NULL == objectScanner) || objectScanner->isLeafObject()) {
+		return;
+	}
+
+	bool const compressed = _extensions->compressObjectReferences();
+	env->_hotFieldCopyDepthCount += 1;
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+		if (isObjectInEvacuateMemory(objectPtr)) {
+			/* the hot fields have been copied already, and the slot itself is updated when the object is scanned */
+			MM_ForwardedHeader forwardHeaderChild(objectPtr, compressed);
+			if (!forwardHeaderChild.isForwardedPointer()) {
+				if (NULL != copyObject(env, &forwardHeaderChild)) {
+					env->_scavengerStats._childDepthCopyCount += 1;
+				}
+			}
+		}
+	}
+	env->_hotFieldCopyDepthCount -= 1;
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2548,6 +2776,14 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 	abandonSurvivorTLHRemainder(env);
 	abandonTenureTLHRemainder(env, true);
 
+	if (NULL != _numaCopyReserves) {
+		/* the reserves are shared by the threads of a node, so they are abandoned once all threads are done copying */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+			abandonNUMACopyReserves(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	}
+
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
 		if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
@@ -2575,6 +2811,10 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	/* No matter what happens, always sum up the gc stats */
 	mergeThreadGCStats(env);
+
+	if (_extensions->scavengerNUMAPartitioning) {
+		restoreNUMAAffinity(env);
+	}
 }
 
 /****************************************
@@ -2614,12 +2854,19 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
-			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
+		MM_SublistFragment fragment((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		if(!_extensions->rememberedSet.allocate(env, &fragment)) {
+			/* Failed to allocate a fragment - record the object in the overflow map if there is one, set the remembered set overflow state and exit */
 			if (!_isRememberedSetInOverflowAtTheBeginning) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
 			}
-			setRememberedSetOverflowState();
+			if (NULL != _rememberedSetOverflowMap) {
+				_rememberedSetOverflowMap->addObject(objectPtr);
+				_extensions->setRememberedSetOverflowRecordedState();
+			} else {
+				setRememberedSetOverflowState();
+			}
 			return ;
 		}
 	}
@@ -2788,6 +3035,10 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 
 		clearRememberedSetLists(env);
+		if (NULL != _rememberedSetOverflowMap) {
+			/* The walk below finds the recorded objects too */
+			_rememberedSetOverflowMap->clear(env);
+		}
 
 		/* Creation of this class will Abort Global Collector */
 		MM_RSOverflow rememberedSetOverflow(env);
@@ -2819,7 +3070,12 @@ void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
 	if(isRememberedSetInOverflowState()) {
-		pruneRememberedSetOverflow(env);
+		if ((NULL != _rememberedSetOverflowMap) && _extensions->isRememberedSetOverflowRecorded()) {
+			pruneRememberedSetList(env);
+			pruneRememberedSetOverflowMap(env);
+		} else {
+			pruneRememberedSetOverflow(env);
+		}
 	} else {
 		pruneRememberedSetList(env);
 	}
@@ -2844,6 +3100,9 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		if (NULL != _rememberedSetOverflowMap) {
+			_rememberedSetOverflowMap->clear(env);
+		}
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -3056,16 +3315,17 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
-	/* Remembered set walk */
+	/* Remembered set walk, by chunks so that a large puddle is shared between threads */
 	MM_SublistPuddle *puddle = NULL;
-	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+	uintptr_t *chunkTop = NULL;
+	omrobjectptr_t *slotPtr = NULL;
+	while (NULL != (slotPtr = (omrobjectptr_t *)_extensions->rememberedSet.popPreviousPuddleChunk(&puddle, REMEMBERED_SET_CHUNK_SLOTS, &chunkTop))) {
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_startPuddle(env->getLanguageVMThread(), puddle);
 		uintptr_t numElements = 0;
-		GC_SublistSlotIterator remSetSlotIterator(puddle);
-		omrobjectptr_t *slotPtr;
-		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
+		for (; slotPtr < (omrobjectptr_t *)chunkTop; slotPtr++) {
 			omrobjectptr_t objectPtr = *slotPtr;
 
+			/* Empty slots are left for pruneRememberedSetList() to remove, as removing them here would move slots between chunks */
 			if(NULL != objectPtr) {
 				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 				numElements += 1;
@@ -3086,8 +3346,6 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 					/* We want to remember this object after all; clear the flag for removal. */
 					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
 				}
-			} else {
-				remSetSlotIterator.removeSlot();
 			}
 		}
 
@@ -3097,6 +3355,95 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_Scavenger::scavengeRememberedSetOverflowMap(MM_EnvironmentStandard *env)
+{
+	uintptr_t cardCount = _rememberedSetOverflowMap->getCardCount();
+	uintptr_t dirtyCards = 0;
+	uintptr_t numElements = 0;
+
+	for (uintptr_t cardBase = 0; cardBase < cardCount; cardBase += REMEMBERED_SET_OVERFLOW_MAP_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t cardTop = OMR_MIN(cardBase + REMEMBERED_SET_OVERFLOW_MAP_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t cardIndex = cardBase; cardIndex < cardTop; cardIndex++) {
+				if (_rememberedSetOverflowMap->isCardDirty(cardIndex)) {
+					dirtyCards += 1;
+					/*
+					 * Scan any remembered objects, but don't adjust their remembered bit.
+					 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+					 */
+					MM_HeapMapIterator objectIterator(_extensions, _rememberedSetOverflowMap, _rememberedSetOverflowMap->getCardLow(cardIndex), _rememberedSetOverflowMap->getCardHigh(cardIndex), false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						numElements += 1;
+						scavengeRememberedObject(env, objectPtr);
+					}
+				}
+			}
+		}
+	}
+
+	env->_scavengerStats._rememberedSetOverflowMapCards += dirtyCards;
+	env->_scavengerStats._rememberedSetOverflowMapObjects += numElements;
+	Trc_MM_ParallelScavenger_scavengeRememberedSetOverflowMap(env->getLanguageVMThread(), dirtyCards, numElements);
+}
+
+void
+MM_Scavenger::pruneRememberedSetOverflowMap(MM_EnvironmentStandard *env)
+{
+	uintptr_t cardCount = _rememberedSetOverflowMap->getCardCount();
+
+	for (uintptr_t cardBase = 0; cardBase < cardCount; cardBase += REMEMBERED_SET_OVERFLOW_MAP_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t cardTop = OMR_MIN(cardBase + REMEMBERED_SET_OVERFLOW_MAP_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t cardIndex = cardBase; cardIndex < cardTop; cardIndex++) {
+				if (_rememberedSetOverflowMap->isCardDirty(cardIndex)) {
+					bool cardStillRemembers = false;
+					MM_HeapMapIterator objectIterator(_extensions, _rememberedSetOverflowMap, _rememberedSetOverflowMap->getCardLow(cardIndex), _rememberedSetOverflowMap->getCardHigh(cardIndex), false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+						/* Check if object still has nursery references, direct or indirect */
+						bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+						/* Unconditionally remember object if it was recently referenced */
+						if (!shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+							Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+							shouldBeRemembered = true;
+						}
+
+						if (shouldBeRemembered) {
+							cardStillRemembers = true;
+						} else {
+							_extensions->objectModel.clearRemembered(objectPtr);
+							_rememberedSetOverflowMap->removeObject(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+							if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference()) {
+								/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set. */
+								oldToOldReferenceCreated(env, objectPtr);
+							}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+						}
+					}
+					if (!cardStillRemembers) {
+						_rememberedSetOverflowMap->clearCard(cardIndex);
+					}
+				}
+			}
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		if (_rememberedSetOverflowMap->isEmpty()) {
+			/* Every remembered object fits in the RS lists again */
+			clearRememberedSetOverflowState();
+			env->_scavengerStats._rememberedSetOverflowMapRecovered = 1;
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
@@ -3105,6 +3452,11 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
+		if (_isRememberedSetOverflowRecordedAtTheBeginning) {
+			/* The remembered objects which did not fit in the RS lists are in the overflow map; no need to walk tenure space */
+			scavengeRememberedSetList(env);
+			scavengeRememberedSetOverflowMap(env);
+		} else
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* For CS, in case of OF, we deal with both direct and indirect refs with only one pass. */
 		if (!IS_CONCURRENT_ENABLED || (concurrent_phase_roots == _concurrentPhase))
@@ -3480,6 +3832,102 @@ MM_Scavenger::abandonTenureTLHRemainder(MM_EnvironmentStandard *env, bool preser
 	}
 }
 
+bool
+MM_Scavenger::allocateFromNUMACopyReserve(MM_EnvironmentStandard *env, bool tenure, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, bool *inLOA)
+{
+	uintptr_t nodeIndex = env->_scavengerNUMANodeIndex % _numaCopyReserveCount;
+	NUMACopyReserve *reserve = &_numaCopyReserves[nodeIndex];
+	MM_MemorySubSpace *subSpace = tenure ? _tenureMemorySubSpace : _survivorMemorySubSpace;
+	void **alloc = tenure ? &reserve->_tenureAlloc : &reserve->_survivorAlloc;
+	void **top = tenure ? &reserve->_tenureTop : &reserve->_survivorTop;
+	bool result = false;
+
+	reserve->_lock.acquire();
+
+	if (((uintptr_t)*top - (uintptr_t)*alloc) < minimumSize) {
+		/* The reserve can not hold the copy, replace it with a new chunk from the shared pool */
+		if (NULL != *alloc) {
+			uintptr_t discardBytes = (uintptr_t)*top - (uintptr_t)*alloc;
+			if (tenure) {
+				env->_scavengerStats._tenureDiscardBytes += discardBytes;
+			} else {
+				env->_scavengerStats._flipDiscardBytes += discardBytes;
+			}
+			subSpace->abandonHeapChunk(*alloc, *top);
+			*alloc = NULL;
+			*top = NULL;
+		}
+
+		MM_AllocateDescription allocDescription(0, 0, false, true);
+		allocDescription.setCollectorAllocateExpandOnFailure(tenure);
+		void *chunkBase = NULL;
+		void *chunkTop = NULL;
+		if (NULL != subSpace->collectorAllocateTLH(env, this, &allocDescription, _numaCopyReserveSize, chunkBase, chunkTop)) {
+			*alloc = chunkBase;
+			*top = chunkTop;
+			if (tenure) {
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+				reserve->_tenureInLOA = allocDescription.isLOAAllocation();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+			}
+			bindNUMACopyReserve(env, nodeIndex, chunkBase, chunkTop);
+		}
+	}
+
+	uintptr_t available = (uintptr_t)*top - (uintptr_t)*alloc;
+	if (available >= minimumSize) {
+		addrBase = *alloc;
+		addrTop = (void *)((uintptr_t)addrBase + OMR_MIN(available, maximumSize));
+		*alloc = addrTop;
+		if (NULL != inLOA) {
+			*inLOA = tenure && reserve->_tenureInLOA;
+		}
+		result = true;
+	}
+
+	reserve->_lock.release();
+
+	return result;
+}
+
+void
+MM_Scavenger::bindNUMACopyReserve(MM_EnvironmentStandard *env, uintptr_t nodeIndex, void *base, void *top)
+{
+	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+		uintptr_t pageSize = _extensions->heap->getPageSize();
+		uintptr_t low = MM_Math::roundToCeiling(pageSize, (uintptr_t)base);
+		uintptr_t high = MM_Math::roundToFloor(pageSize, (uintptr_t)top);
+
+		/* Only whole pages can be bound, the partial pages at the ends stay where they are */
+		if ((nodeIndex < leaderCount) && (low < high)) {
+			_extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle(), leaders[nodeIndex].j9NodeNumber, (void *)low, high - low);
+		}
+	}
+}
+
+void
+MM_Scavenger::abandonNUMACopyReserves(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; i < _numaCopyReserveCount; i++) {
+		NUMACopyReserve *reserve = &_numaCopyReserves[i];
+		if (NULL != reserve->_survivorAlloc) {
+			env->_scavengerStats._flipDiscardBytes += (uintptr_t)reserve->_survivorTop - (uintptr_t)reserve->_survivorAlloc;
+			_survivorMemorySubSpace->abandonHeapChunk(reserve->_survivorAlloc, reserve->_survivorTop);
+			reserve->_survivorAlloc = NULL;
+			reserve->_survivorTop = NULL;
+		}
+		if (NULL != reserve->_tenureAlloc) {
+			env->_scavengerStats._tenureDiscardBytes += (uintptr_t)reserve->_tenureTop - (uintptr_t)reserve->_tenureAlloc;
+			_tenureMemorySubSpace->abandonHeapChunk(reserve->_tenureAlloc, reserve->_tenureTop);
+			reserve->_tenureAlloc = NULL;
+			reserve->_tenureTop = NULL;
+			reserve->_tenureInLOA = false;
+		}
+	}
+}
+
 void
 MM_Scavenger::finalReturnCopyCachesToFreeList(MM_EnvironmentStandard *env)
 {
@@ -4047,6 +4495,12 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			omrtty_printf("{SCAV: Handle RS overflow}\n");
 #endif /* OMR_SCAVENGER_TRACE_BACKOUT */
 
+			if (NULL != _rememberedSetOverflowMap) {
+				/* The overflow list is rebuilt by walking old space below, which finds the recorded objects too */
+				_rememberedSetOverflowMap->clear(env);
+				setRememberedSetOverflowState();
+			}
+
 			if (IS_CONCURRENT_ENABLED) {
 				/* All heap fixup will occur during or after global GC */
 				clearRememberedSetLists(env);
@@ -4214,6 +4668,15 @@ MM_Scavenger::mainThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_AllocateD
 			/* Build free list in evacuate profile. Perform resize. */
 			_activeSubSpace->mainTeardownForSuccessfulGC(env);
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+			if (NULL != _nurseryPreZeroer) {
+				/* What was zeroed of survivor space is allocate space now, and the new survivor space is free until the next scavenge */
+				_extensions->preZeroedNurseryLow = _preZeroedSurvivorLow;
+				_extensions->preZeroedNurseryHigh = _preZeroedSurvivorHigh;
+				_nurseryPreZeroer->startZeroing(env, _activeSubSpace->getMemorySubSpaceSurvivor());
+			}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
 			/* Defer to collector language interface */
 			_delegate.mainThreadGarbageCollect_scavengeSuccess(env);
 
@@ -4781,6 +5244,19 @@ MM_Scavenger::globalCollectionStart(MM_EnvironmentBase *env)
 
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _nurseryPreZeroer) {
+		/* Sweeping the nursery returns dead objects to the free lists, and compaction may move objects anywhere,
+		 * so nothing zeroed is trusted until the next successful scavenge.
+		 */
+		uintptr_t unusedLow = 0;
+		uintptr_t unusedHigh = 0;
+		_nurseryPreZeroer->stopZeroing(env, &unusedLow, &unusedHigh);
+		_extensions->preZeroedNurseryLow = 0;
+		_extensions->preZeroedNurseryHigh = 0;
+	}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 }
 
 void
@@ -4794,6 +5270,22 @@ MM_Scavenger::globalCollectionComplete(MM_EnvironmentBase *env)
 	_extensions->scavengerStats._nextScavengeWillPercolate = false;
 	setFailedTenureLargestObject(0);
 	_countSinceForcingGlobalGC = 0;
+
+	if ((NULL != _rememberedSetOverflowMap) && isRememberedSetInOverflowState()) {
+		bool objectsMoved = false;
+#if defined(OMR_GC_MODRON_COMPACTION)
+		objectsMoved = (COMPACT_NONE != _extensions->globalGCStats.compactStats._compactReason)
+			&& (COMPACT_PREVENTED_NONE == _extensions->globalGCStats.compactStats._compactPreventedReason);
+#endif /* OMR_GC_MODRON_COMPACTION */
+		if (objectsMoved || !_extensions->isRememberedSetOverflowRecorded()) {
+			/* The recorded objects can no longer be trusted, fall back to walking old space */
+			_rememberedSetOverflowMap->clear(env);
+			setRememberedSetOverflowState();
+		} else {
+			/* Forget the recorded objects which died, their memory is free now */
+			_rememberedSetOverflowMap->removeUnmarkedObjects(env);
+		}
+	}
 }
 
 void
@@ -4888,6 +5380,9 @@ MM_Scavenger::reportGCIncrementStart(MM_EnvironmentStandard *env)
 		Assert_MM_unreachable();
 	}
 
+	/* task stats cover this increment only */
+	_extensions->dispatcher->clearTaskStats(env);
+
 	TRIGGER_J9HOOK_MM_PRIVATE_GC_INCREMENT_START(
 		_extensions->privateHookInterface,
 		env->getOmrVMThread(),
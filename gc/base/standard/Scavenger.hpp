@@ -38,6 +38,7 @@
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MainGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -52,8 +53,10 @@ class MM_HeapRegionManager;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
+class MM_NurseryPreZeroer;
 class MM_ParallelDispatcher;
 class MM_PhysicalSubArena;
+class MM_RememberedSetOverflowMap;
 class MM_RSOverflow;
 class MM_SublistPool;
 
@@ -75,6 +78,13 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	bool _isRememberedSetOverflowRecordedAtTheBeginning; /**< RS Overflow at the beginning of the scavenge was recorded in _rememberedSetOverflowMap, so the RS lists are still valid */
+	MM_RememberedSetOverflowMap *_rememberedSetOverflowMap; /**< Remembered objects which did not fit in the RS lists (NULL unless scavengerRememberedSetOverflowMap) */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	MM_NurseryPreZeroer *_nurseryPreZeroer; /**< Zeroes survivor space between scavenges (NULL unless preZeroNurseryInBackground) */
+	uintptr_t _preZeroedSurvivorLow; /**< Range of survivor space zeroed before this scavenge, which becomes allocate space if it succeeds */
+	uintptr_t _preZeroedSurvivorHigh;
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -114,6 +124,31 @@ private:
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
+	uintptr_t _depthCopyChildrenMax; /**< Levels of children copied right after a copied object (hierarchical scan ordering with hierarchicalDepthCopy only, 0 if disabled) */
+
+	/**
+	 * Copy destination memory reserved for the GC threads of one NUMA node in a NUMA partitioned scavenge.
+	 * Copy caches are carved from the reserves of the copying thread's node, which are bound to the memory of the node.
+	 */
+	struct NUMACopyReserve {
+		MM_LightweightNonReentrantLock _lock; /**< Lock for carving from and refilling the reserves */
+		void *_survivorAlloc; /**< base and top pointers of the unused part of the survivor reserve */
+		void *_survivorTop;
+		void *_tenureAlloc; /**< base and top pointers of the unused part of the tenure reserve */
+		void *_tenureTop;
+		bool _tenureInLOA; /**< true, if the tenure reserve is in LOA */
+
+		NUMACopyReserve()
+			: _survivorAlloc(NULL)
+			, _survivorTop(NULL)
+			, _tenureAlloc(NULL)
+			, _tenureTop(NULL)
+			, _tenureInLOA(false)
+		{}
+	};
+	NUMACopyReserve *_numaCopyReserves; /**< One copy reserve per NUMA node (NULL unless the scavenge is NUMA partitioned over more than one node) */
+	uintptr_t _numaCopyReserveCount; /**< Number of elements in _numaCopyReserves */
+	uintptr_t _numaCopyReserveSize; /**< Size of the chunks the copy reserves are refilled with in the current scavenge */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
@@ -280,6 +315,16 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/**
+	 * Copy the children of an object which has just been copied right after it and its hot fields, depth first,
+	 * so that a parent and its subtree land next to each other in the copy caches instead of wherever the scan
+	 * finds them. Children are enumerated by the delegate's object scanner, instantiated with the copyAhead flag.
+	 * Valid if scavenger hierarchical scan ordering is enabled with hierarchicalDepthCopy.
+	 * @param forwardedHeader Forwarded header of the object
+	 * @param destinationObjectPtr The copy of the object
+	 */
+	void depthCopyChildren(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -337,6 +382,17 @@ public:
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Scan the remembered objects recorded in the overflow map, in parallel by card.
+	 */
+	void scavengeRememberedSetOverflowMap(MM_EnvironmentStandard *env);
+
+	/**
+	 * Forget the objects recorded in the overflow map which no longer need remembering, and clear the RS
+	 * overflow state if none are left. Ends with a sync point.
+	 */
+	void pruneRememberedSetOverflowMap(MM_EnvironmentStandard *env);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -468,6 +524,32 @@ public:
 	 */
 	void abandonSurvivorTLHRemainder(MM_EnvironmentStandard *env);
 	void abandonTenureTLHRemainder(MM_EnvironmentStandard *env, bool preserveRemainders = false);
+
+	/**
+	 * Carve a copy cache from the survivor or tenure copy reserve of the NUMA node of the thread, refilling the
+	 * reserve from the shared memory pool if it can not hold the copy. The memory of a new reserve chunk is bound
+	 * to the node (if physical NUMA is supported), so pages first touched by the copy are placed on the node.
+	 * @param env[in] the current thread
+	 * @param tenure[in] true to carve from the tenure reserve, false for the survivor reserve
+	 * @param minimumSize[in] the size of the object to be copied
+	 * @param maximumSize[in] the preferred size of the copy cache
+	 * @param addrBase[out] base of the carved memory
+	 * @param addrTop[out] top of the carved memory
+	 * @param inLOA[out] set to true if the carved tenure memory is in LOA (may be NULL)
+	 * @return true if memory was carved from the reserve, false if the caller must fall back to the shared pool
+	 */
+	bool allocateFromNUMACopyReserve(MM_EnvironmentStandard *env, bool tenure, uintptr_t minimumSize, uintptr_t maximumSize, void* &addrBase, void* &addrTop, bool *inLOA);
+
+	/**
+	 * Bind the memory of a new copy reserve chunk to the NUMA node it is reserved for.
+	 * Pages already resident keep their placement, only pages faulted in later are affected.
+	 */
+	void bindNUMACopyReserve(MM_EnvironmentStandard *env, uintptr_t nodeIndex, void *base, void *top);
+
+	/**
+	 * Called at the end of the scavenge, once no thread copies anymore, to abandon the unused tails of the NUMA copy reserves.
+	 */
+	void abandonNUMACopyReserves(MM_EnvironmentStandard *env);
 	
 	MMINLINE bool activateSurvivorCopyScanCache(MM_EnvironmentStandard *env);
 	MMINLINE bool activateTenureCopyScanCache(MM_EnvironmentStandard *env);
@@ -647,6 +729,22 @@ protected:
 	virtual void mainSetupForGC(MM_EnvironmentStandard *env);
 	virtual void workerSetupForGC(MM_EnvironmentStandard *env);
 
+	/**
+	 * Assign the thread to a NUMA node for a NUMA partitioned scavenge (scavengerNUMAPartitioning).
+	 * GC worker threads are spread round robin over the affinity leaders, and bound to the node they are assigned
+	 * (if physical NUMA is supported), so that the survivor and tenure memory they first touch, and the scan caches
+	 * they produce and preferentially consume, are local to the node.
+	 * @param env[in] The thread participating in the scavenge
+	 */
+	void assignNUMANode(MM_EnvironmentStandard *env);
+
+	/**
+	 * Restore the affinity a GC worker thread had before assignNUMANode() bound it to its node, so the
+	 * binding does not leak into work the thread does outside of the scavenge.
+	 * @param env[in] The thread participating in the scavenge
+	 */
+	void restoreNUMAAffinity(MM_EnvironmentStandard *env);
+
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 
@@ -685,6 +783,10 @@ public:
 
 	MM_ScavengerDelegate* getDelegate() { return &_delegate; }
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	MM_NurseryPreZeroer *getNurseryPreZeroer() { return _nurseryPreZeroer; }
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
 	/* Read Barrier Verifier specific methods */
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
 	virtual void scavenger_poisonSlots(MM_EnvironmentBase *env);
@@ -892,6 +994,13 @@ public:
 		, _delegate(env)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _isRememberedSetOverflowRecordedAtTheBeginning(false)
+		, _rememberedSetOverflowMap(NULL)
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		, _nurseryPreZeroer(NULL)
+		, _preZeroedSurvivorLow(0)
+		, _preZeroedSurvivorHigh(0)
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
@@ -920,6 +1029,10 @@ public:
 		, _waitingCountAliasThreshold(0)
 		, _waitingCount(0)
 		, _cacheLineAlignment(0)
+		, _depthCopyChildrenMax(0)
+		, _numaCopyReserves(NULL)
+		, _numaCopyReserveCount(0)
+		, _numaCopyReserveSize(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
 #endif
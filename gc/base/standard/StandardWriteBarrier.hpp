@@ -28,6 +28,7 @@
 #include "CardTable.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
@@ -48,7 +49,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -61,12 +62,17 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		}
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->segregatedYoungCollection) {
+		extensions->getGlobalCollector()->generationalWriteBarrier(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 	if (extensions->concurrentMark) {
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) */
 }
 
 /**
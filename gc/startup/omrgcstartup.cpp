@@ -35,6 +35,7 @@
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
 #include "HeapMemorySubSpaceIterator.hpp"
+#include "HeapPretoucher.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "MemoryPool.hpp"
@@ -220,6 +221,9 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 	if (!extensions->dispatcher->startUpThreads()) {
 		extensions->dispatcher->shutDownThreads();
 		rc = OMR_ERROR_INTERNAL;
+	} else if ((NULL != extensions->heapPretoucher) && !extensions->heapPretoucher->startUp(MM_EnvironmentBase::getEnvironment(omrVMThread))) {
+		extensions->dispatcher->shutDownThreads();
+		rc = OMR_ERROR_INTERNAL;
 	}
 
 	return rc;
@@ -231,6 +235,10 @@ OMR_GC_ShutdownDispatcherThreads(OMR_VMThread* omrVMThread)
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
 	omr_error_t rc = OMR_ERROR_NONE;
 
+	if (NULL != extensions->heapPretoucher) {
+		extensions->heapPretoucher->shutDown();
+	}
+
 	if (NULL != extensions->dispatcher) {
 		extensions->dispatcher->shutDownThreads();
 		extensions->dispatcher->kill(MM_EnvironmentBase::getEnvironment(omrVMThread));
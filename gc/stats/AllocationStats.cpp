@@ -35,6 +35,7 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhAllocatedPreZeroed = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -59,6 +60,7 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhAllocatedPreZeroed, stats->_tlhAllocatedPreZeroed);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -42,6 +42,7 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhAllocatedPreZeroed; 	/**< The amount of fresh TLH memory which was pre-zeroed nursery, and so was not cleared. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -94,6 +95,7 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhAllocatedPreZeroed(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
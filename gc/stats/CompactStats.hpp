@@ -50,6 +50,7 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	bool _sliding; /**< True if the objects were slid rather than evacuated from sub areas */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
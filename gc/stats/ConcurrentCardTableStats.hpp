@@ -49,6 +49,16 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	bool _dirtyCardQueueDrained; /**< True if final card cleaning drained the dirty card queue rather than scanning the card table */
+	bool _dirtyCardQueueOverflowed; /**< True if the dirty card queue overflowed in the cycle, so final card cleaning scanned the card table */
+	uintptr_t _dirtyCardsQueued; /**< Number of cards queued in the cycle (concurrentCardCleaningQueue), a card may be queued more than once */
+	uintptr_t _dirtyCardsAtConcurrentCleaning; /**< Number of queued cards to clean when concurrent card cleaning started */
+	uintptr_t _dirtyCardsAtFinalCleaning; /**< Number of queued cards left to clean when final card cleaning started */
+
+	uintptr_t _extraCardCleaningPasses; /**< Number of card cleaning passes added to the cycle to meet the final card cleaning pause target */
+	uintptr_t _predictedFinalCardCleaningTime; /**< Final card cleaning time, in microseconds, predicted when the last card cleaning pass completed (0 if not predicted) */
+	bool _lastCardCleaningPassReducedDirtyCards; /**< False if the last card cleaning pass left as many dirty cards as the one before, in which case no more passes are run */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +85,18 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+
+		/* Dirty card queue counts */
+		_dirtyCardQueueDrained = false;
+		_dirtyCardQueueOverflowed = false;
+		_dirtyCardsQueued = 0;
+		_dirtyCardsAtConcurrentCleaning = 0;
+		_dirtyCardsAtFinalCleaning = 0;
+
+		/* Final card cleaning pause target */
+		_extraCardCleaningPasses = 0;
+		_predictedFinalCardCleaningTime = 0;
+		_lastCardCleaningPassReducedDirtyCards = true;
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -129,7 +151,15 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		_dirtyCardQueueDrained(false),
+		_dirtyCardQueueOverflowed(false),
+		_dirtyCardsQueued(0),
+		_dirtyCardsAtConcurrentCleaning(0),
+		_dirtyCardsAtFinalCleaning(0),
+		_extraCardCleaningPasses(0),
+		_predictedFinalCardCleaningTime(0),
+		_lastCardCleaningPassReducedDirtyCards(true)
 	{};
 };
 
@@ -35,6 +35,8 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_rememberedObjectsScanned = 0;
+	_youngMark = false;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -52,6 +54,7 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_rememberedObjectsScanned += statsToMerge->_rememberedObjectsScanned;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
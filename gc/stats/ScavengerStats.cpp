@@ -34,6 +34,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	_gcCount(UDATA_MAX)
 	,_rememberedSetOverflow(0)
 	,_causedRememberedSetOverflow(0)
+	,_rememberedSetOverflowMapCards(0)
+	,_rememberedSetOverflowMapObjects(0)
+	,_rememberedSetOverflowMapRecovered(0)
 	,_scanCacheOverflow(0)
 	,_scanCacheAllocationFromHeap(0)
 	,_scanCacheAllocationDurationDuringSavenger(0)
@@ -53,6 +56,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
 	,_aliasToCopyCacheCount(0)
+	,_hotFieldCopyCount(0)
+	,_childDepthCopyCount(0)
+	,_remoteNodeScanCacheCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
 	,_workStallCount(0)
@@ -88,6 +94,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_semiSpaceAllocationCountSmall(0)
 	,_tenureSpaceAllocationCountLarge(0)
 	,_tenureSpaceAllocationCountSmall(0)
+	,_semiSpaceAllocationCountNodeLocal(0)
+	,_tenureSpaceAllocationCountNodeLocal(0)
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
@@ -139,6 +147,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	
 	_rememberedSetOverflow = 0;
 	_causedRememberedSetOverflow = 0;
+	_rememberedSetOverflowMapCards = 0;
+	_rememberedSetOverflowMapObjects = 0;
+	_rememberedSetOverflowMapRecovered = 0;
 	_scanCacheOverflow = 0;
 	_scanCacheAllocationFromHeap = 0;
 	_scanCacheAllocationDurationDuringSavenger = 0;
@@ -165,6 +176,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
+	_hotFieldCopyCount = 0;
+	_childDepthCopyCount = 0;
+	_remoteNodeScanCacheCount = 0;
 	_arraySplitCount = 0;
 	_arraySplitAmount = 0;
 	_workStallCount = 0;
@@ -191,6 +205,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_semiSpaceAllocationCountSmall = 0;
 	_tenureSpaceAllocationCountLarge = 0;
 	_tenureSpaceAllocationCountSmall = 0;
+	_semiSpaceAllocationCountNodeLocal = 0;
+	_tenureSpaceAllocationCountNodeLocal = 0;
 
 	_tenureExpandedBytes = 0;
 	_tenureExpandedCount = 0;
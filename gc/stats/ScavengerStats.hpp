@@ -57,6 +57,9 @@ public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
 	uintptr_t _rememberedSetOverflow;
 	uintptr_t _causedRememberedSetOverflow;
+	uintptr_t _rememberedSetOverflowMapCards; /**< The number of dirty cards of the remembered set overflow map scanned (scavengerRememberedSetOverflowMap only) */
+	uintptr_t _rememberedSetOverflowMapObjects; /**< The number of remembered objects scanned from the remembered set overflow map (scavengerRememberedSetOverflowMap only) */
+	uintptr_t _rememberedSetOverflowMapRecovered; /**< 1 if the remembered set overflow map was emptied by pruning, ending the overflow (scavengerRememberedSetOverflowMap only) */
 	uintptr_t _scanCacheOverflow;
 	uintptr_t _scanCacheAllocationFromHeap;
 	uint64_t  _scanCacheAllocationDurationDuringSavenger;
@@ -85,6 +88,9 @@ public:
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
 	uintptr_t _aliasToCopyCacheCount;
+	uintptr_t _hotFieldCopyCount; /**< The number of objects depth copied right after their parent through its hot fields */
+	uintptr_t _childDepthCopyCount; /**< The number of objects depth copied right after their parent, ahead of its scan, other than through hot fields (hierarchicalDepthCopy only) */
+	uintptr_t _remoteNodeScanCacheCount; /**< The number of scan caches taken from the scan list of another NUMA node (NUMA partitioned scavenge only) */
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
@@ -139,6 +145,8 @@ public:
 	uintptr_t _semiSpaceAllocationCountSmall;
 	uintptr_t _tenureSpaceAllocationCountLarge;
 	uintptr_t _tenureSpaceAllocationCountSmall;
+	uintptr_t _semiSpaceAllocationCountNodeLocal; /**< The number of survivor copy caches carved from the copy reserve of the thread's NUMA node (NUMA partitioned scavenge only) */
+	uintptr_t _tenureSpaceAllocationCountNodeLocal; /**< The number of tenure copy caches carved from the copy reserve of the thread's NUMA node (NUMA partitioned scavenge only) */
 
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
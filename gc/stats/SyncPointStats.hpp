@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(SYNCPOINTSTATS_HPP_)
+#define SYNCPOINTSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "AtomicOperations.hpp"
+#include "Base.hpp"
+
+/**
+ * Time GC threads spent waiting at each synchronization point of parallel tasks.
+ * Synchronization points are identified by their UNIQUE_ID string, which is a constant, so entries
+ * are keyed by the address of the id. The table is fixed size; waits at synchronization points
+ * that do not fit are counted in _overflowCount only.
+ * @note This class is intended to have a single global instance
+ * @ingroup GC_Stats
+ */
+class MM_SyncPointStats : public MM_Base
+{
+public:
+	enum {
+		entryCount = 64 /**< Number of distinct synchronization points that can be recorded */
+	};
+
+	struct Entry {
+		const char * volatile _id; /**< UNIQUE_ID of the synchronization point, NULL if the entry is free */
+		volatile uintptr_t _arrivals; /**< Number of times a thread arrived at the synchronization point */
+		volatile uint64_t _waitTime; /**< Total time (hi-res ticks) threads waited at the synchronization point */
+		volatile uint64_t _maxWaitTime; /**< Longest time (hi-res ticks) a thread waited at the synchronization point */
+	};
+
+	Entry _entries[entryCount];
+	volatile uintptr_t _overflowCount; /**< Number of waits not recorded since the table was full */
+
+	/**
+	 * Record that a thread waited at a synchronization point. May be called concurrently by all GC threads.
+	 * @param id the UNIQUE_ID of the synchronization point
+	 * @param waitTime the time (hi-res ticks) the thread waited
+	 */
+	MMINLINE void
+	record(const char *id, uint64_t waitTime)
+	{
+		uintptr_t index = (((uintptr_t)id) >> 3) % entryCount;
+		for (uintptr_t probe = 0; probe < entryCount; probe++) {
+			Entry *entry = &_entries[index];
+			const char *entryId = entry->_id;
+			if (NULL == entryId) {
+				entryId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&entry->_id, (uintptr_t)NULL, (uintptr_t)id);
+				if (NULL == entryId) {
+					entryId = id;
+				}
+			}
+			if (id == entryId) {
+				MM_AtomicOperations::add(&entry->_arrivals, 1);
+				MM_AtomicOperations::addU64(&entry->_waitTime, waitTime);
+				uint64_t maxWaitTime = entry->_maxWaitTime;
+				while (waitTime > maxWaitTime) {
+					maxWaitTime = MM_AtomicOperations::lockCompareExchangeU64(&entry->_maxWaitTime, maxWaitTime, waitTime);
+				}
+				return;
+			}
+			index = (index + 1) % entryCount;
+		}
+		MM_AtomicOperations::add(&_overflowCount, 1);
+	}
+
+	/**
+	 * Reset all entries. Must not be called while GC threads may be recording.
+	 */
+	void
+	clear()
+	{
+		for (uintptr_t i = 0; i < entryCount; i++) {
+			_entries[i]._id = NULL;
+			_entries[i]._arrivals = 0;
+			_entries[i]._waitTime = 0;
+			_entries[i]._maxWaitTime = 0;
+		}
+		_overflowCount = 0;
+	}
+
+	MM_SyncPointStats() :
+		MM_Base()
+		, _overflowCount(0)
+	{
+		clear();
+	}
+};
+
+#endif /* SYNCPOINTSTATS_HPP_ */
@@ -387,6 +387,7 @@ MM_SublistPool::clear(MM_EnvironmentBase *env)
 	_list = NULL;
 	_allocPuddle = NULL;
 	_previousList = NULL;
+	_previousListScanCurrent = NULL;
 	_count = 0;
 }
 
@@ -428,17 +429,7 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 
 	/* return returnedPuddle to the list of used puddles */
 	if (NULL != returnedPuddle) {
-		Assert_MM_true(NULL == returnedPuddle->getNext());
-		returnedPuddle->setNext(_list);
-		_list = returnedPuddle;
-
-		/* It's illegal to have a non-empty list without an _allocPuddle. If 
-		 * this is the only puddle in the pool, make it the _allocPuddle. 
-		 */
-		if (NULL == _allocPuddle) {
-			_allocPuddle = returnedPuddle;
-			Assert_MM_true(NULL == _allocPuddle->getNext());
-		}
+		returnPuddle(returnedPuddle);
 	}
 
 	/* pop an element from the previous list */
@@ -452,3 +443,71 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+uintptr_t *
+MM_SublistPool::popPreviousPuddleChunk(MM_SublistPuddle **puddle, uintptr_t maxSlots, uintptr_t **chunkTop)
+{
+	uintptr_t *result = NULL;
+
+	omrthread_monitor_enter(_mutex);
+
+	/* return the processed chunk, and its puddle once every chunk of it has been claimed and returned */
+	MM_SublistPuddle *returnedPuddle = *puddle;
+	if (NULL != returnedPuddle) {
+		Assert_MM_true(0 < returnedPuddle->_pendingChunks);
+		returnedPuddle->_pendingChunks -= 1;
+		if ((0 == returnedPuddle->_pendingChunks) && (returnedPuddle != _previousList)) {
+			returnPuddle(returnedPuddle);
+		}
+		*puddle = NULL;
+	}
+
+	/* claim the next chunk of the head of the previous list, popping it once it is fully claimed */
+	MM_SublistPuddle *head = NULL;
+	while ((NULL == result) && (NULL != (head = _previousList))) {
+		if (NULL == _previousListScanCurrent) {
+			_previousListScanCurrent = head->_listBase;
+		}
+		uintptr_t *headTop = head->_listCurrent;
+		if (_previousListScanCurrent < headTop) {
+			result = _previousListScanCurrent;
+			_previousListScanCurrent = (((uintptr_t)(headTop - result)) > maxSlots) ? (result + maxSlots) : headTop;
+			head->_pendingChunks += 1;
+			*puddle = head;
+			*chunkTop = _previousListScanCurrent;
+		}
+		if (_previousListScanCurrent == headTop) {
+			_previousList = head->getNext();
+			head->setNext(NULL);
+			_previousListScanCurrent = NULL;
+			if (0 == head->_pendingChunks) {
+				/* the puddle had no slots to claim */
+				returnPuddle(head);
+			}
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+/**
+ * Return a puddle popped from the previous list to the list of used puddles.
+ * The caller must hold the mutex.
+ */
+void
+MM_SublistPool::returnPuddle(MM_SublistPuddle *puddle)
+{
+	Assert_MM_true(NULL == puddle->getNext());
+	puddle->setNext(_list);
+	_list = puddle;
+
+	/* It's illegal to have a non-empty list without an _allocPuddle. If 
+	 * this is the only puddle in the pool, make it the _allocPuddle. 
+	 */
+	if (NULL == _allocPuddle) {
+		_allocPuddle = puddle;
+		Assert_MM_true(NULL == _allocPuddle->getNext());
+	}
+}
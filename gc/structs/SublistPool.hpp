@@ -65,6 +65,7 @@ private:
 	OMR::GC::AllocationCategory::Enum _allocCategory;
 	
 	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	uintptr_t *_previousListScanCurrent; /**< First slot of the head of _previousList not yet claimed by #popPreviousPuddleChunk(), NULL if none of it has been claimed */
 	
 protected:
 public:
@@ -75,6 +76,7 @@ public:
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
 	void freePuddles(MM_EnvironmentBase *env, MM_SublistPuddle *list);
+	void returnPuddle(MM_SublistPuddle *puddle);
 
 protected:
 public:
@@ -125,6 +127,20 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Claim a chunk of at most maxSlots slots from the puddles which were active when #startProcessingSublist()
+	 * was called, so that a large puddle can be processed by several threads. A puddle is returned to the list
+	 * of puddles once every chunk of it has been returned.
+	 * This is protected by a lock, so may safely be called by multiple threads.
+	 *
+	 * @param puddle[in/out] on entry the puddle of a chunk which has already been processed, or NULL; on
+	 * return the puddle of the claimed chunk
+	 * @param maxSlots the most slots to claim
+	 * @param chunkTop[out] the first slot after the claimed chunk
+	 * @return the first slot of the claimed chunk, or NULL if every slot has been claimed
+	 */
+	uintptr_t *popPreviousPuddleChunk(MM_SublistPuddle **puddle, uintptr_t maxSlots, uintptr_t **chunkTop);
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -136,6 +152,7 @@ public:
 		, _count(0)
 		, _allocCategory(OMR::GC::AllocationCategory::OTHER)
 		, _previousList(NULL)
+		, _previousListScanCurrent(NULL)
 	{}
 
 	friend class GC_SublistIterator;
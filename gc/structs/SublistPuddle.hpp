@@ -62,6 +62,8 @@ private:
 
 	uintptr_t _size;
 
+	uintptr_t _pendingChunks; /**< Chunks of the puddle claimed by MM_SublistPool::popPreviousPuddleChunk() and not yet returned */
+
 protected:
 public:
 	
@@ -96,6 +98,7 @@ public:
 
 	MM_SublistPuddle() {}
 
+	friend class MM_SublistPool;
 	friend class GC_SublistIterator;
 	friend class GC_SublistSlotIterator;
 };
@@ -0,0 +1,658 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+
+#include <string.h>
+
+#include "AtomicOperations.hpp"
+#include "CollectionStatistics.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseEventLog.hpp"
+#include "VerboseManager.hpp"
+
+static void verboseEventLogCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogSystemGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogSystemGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogAllocationFailureStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogAllocationFailureEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventLogHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void verboseEventLogCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void verboseEventLogScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+MM_VerboseEventLog *
+MM_VerboseEventLog::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename, uintptr_t records)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseEventLog *eventLog = (MM_VerboseEventLog *)extensions->getForge()->allocate(sizeof(MM_VerboseEventLog), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != eventLog) {
+		new(eventLog) MM_VerboseEventLog(extensions, manager);
+		if (!eventLog->initialize(env, filename, records)) {
+			eventLog->kill(env);
+			eventLog = NULL;
+		}
+	}
+	return eventLog;
+}
+
+MM_VerboseEventLog::MM_VerboseEventLog(MM_GCExtensionsBase *extensions, MM_VerboseManager *manager)
+	: MM_Base()
+	, _extensions(extensions)
+	, _omrVM(NULL)
+	, _mmPrivateHooks(NULL)
+	, _mmOmrHooks(NULL)
+	, _manager(manager)
+	, _records(NULL)
+	, _sequences(NULL)
+	, _recordMask(0)
+	, _enqueuePosition(0)
+	, _dequeuePosition(0)
+	, _droppedRecords(0)
+	, _reportedDroppedRecords(0)
+	, _writeRequested(false)
+	, _fileDescriptor(-1)
+	, _monitor(NULL)
+	, _threadState(THREAD_NONE)
+{
+}
+
+void
+MM_VerboseEventLog::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	_extensions->getForge()->free(this);
+}
+
+bool
+MM_VerboseEventLog::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t records)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	_omrVM = env->getOmrVM();
+	_mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	_mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+
+	/* the writing thread is woken every quarter of the buffer, so keep it large enough for that to be meaningful */
+	uintptr_t capacity = 64;
+	while (capacity < records) {
+		capacity <<= 1;
+	}
+	_records = (MM_VerboseEventRecord *)_extensions->getForge()->allocate(capacity * sizeof(MM_VerboseEventRecord), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_sequences = (volatile uintptr_t *)_extensions->getForge()->allocate(capacity * sizeof(uintptr_t), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == _records) || (NULL == _sequences)) {
+		return false;
+	}
+	for (uintptr_t slot = 0; slot < capacity; slot++) {
+		_sequences[slot] = slot;
+	}
+	_recordMask = capacity - 1;
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseEventLog::monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+
+	_fileDescriptor = omrfile_open(filename, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _fileDescriptor) {
+		return false;
+	}
+
+	MM_VerboseEventLogHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, VERBOSE_EVENT_LOG_MAGIC, sizeof(header.magic));
+	header.version = VERBOSE_EVENT_LOG_VERSION;
+	header.recordSize = sizeof(MM_VerboseEventRecord);
+	header.hiresFrequency = omrtime_hires_frequency();
+	header.creationTime = omrtime_hires_clock();
+	header.creationTimeMillis = omrtime_current_time_millis();
+	if ((intptr_t)sizeof(header) != omrfile_write(_fileDescriptor, &header, sizeof(header))) {
+		return false;
+	}
+
+	omrthread_t thread = NULL;
+	_threadState = THREAD_RUNNING;
+	if (0 != createThreadWithCategory(&thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0, writerThreadProc, (void *)this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD)) {
+		_threadState = THREAD_NONE;
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_VerboseEventLog::tearDown(MM_EnvironmentBase *env)
+{
+	closeStream(env);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+	if (NULL != _sequences) {
+		_extensions->getForge()->free((void *)_sequences);
+		_sequences = NULL;
+	}
+	if (NULL != _records) {
+		_extensions->getForge()->free(_records);
+		_records = NULL;
+	}
+}
+
+void
+MM_VerboseEventLog::closeStream(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		if (THREAD_RUNNING == _threadState) {
+			_threadState = THREAD_SHUTDOWN_REQUESTED;
+			omrthread_monitor_notify_all(_monitor);
+			while (THREAD_NONE != _threadState) {
+				omrthread_monitor_wait(_monitor);
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	if (-1 != _fileDescriptor) {
+		/* the writing thread is gone, pick up what it left behind */
+		writeRecords();
+		omrfile_close(_fileDescriptor);
+		_fileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseEventLog::enableVerbose()
+{
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseEventLogCycleStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseEventLogCycleEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseEventLogGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseEventLogGCEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* Exclusive */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, verboseEventLogExclusiveStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, verboseEventLogExclusiveEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* GCLaunch */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SYSTEM_GC_START, verboseEventLogSystemGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SYSTEM_GC_END, verboseEventLogSystemGCEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_START, verboseEventLogAllocationFailureStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_END, verboseEventLogAllocationFailureEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* GCOps */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseEventLogMarkEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseEventLogSweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseEventLogCompactEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseEventLogScavengeEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/* Heap resize */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseEventLogHeapResize, OMR_GET_CALLSITE(), (void *)this);
+}
+
+void
+MM_VerboseEventLog::disableVerbose()
+{
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseEventLogCycleStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseEventLogCycleEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseEventLogGCStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseEventLogGCEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, verboseEventLogExclusiveStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, verboseEventLogExclusiveEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SYSTEM_GC_START, verboseEventLogSystemGCStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SYSTEM_GC_END, verboseEventLogSystemGCEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_START, verboseEventLogAllocationFailureStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_ALLOCATION_FAILURE_END, verboseEventLogAllocationFailureEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseEventLogMarkEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseEventLogSweepEnd, NULL);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseEventLogCompactEnd, NULL);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseEventLogScavengeEnd, NULL);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseEventLogHeapResize, NULL);
+}
+
+void
+MM_VerboseEventLog::report(MM_EnvironmentBase *env, VerboseEventType type, uint16_t flags, uint64_t timestamp, uint64_t data0, uint64_t data1, uint64_t data2, uint64_t data3, uint64_t data4)
+{
+	/* claim a slot: a slot is free for position p once its sequence is p, and holds a record once it is p + 1 */
+	uintptr_t position = _enqueuePosition;
+	while (true) {
+		intptr_t difference = (intptr_t)(_sequences[position & _recordMask] - position);
+		if (0 == difference) {
+			uintptr_t oldPosition = MM_AtomicOperations::lockCompareExchange(&_enqueuePosition, position, position + 1);
+			if (oldPosition == position) {
+				break;
+			}
+			position = oldPosition;
+		} else if (difference < 0) {
+			/* the writing thread is a whole buffer behind */
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return;
+		} else {
+			position = _enqueuePosition;
+		}
+	}
+
+	MM_VerboseEventRecord *record = &_records[position & _recordMask];
+	record->type = (uint16_t)type;
+	record->flags = flags;
+	record->timestamp = timestamp;
+	if (NULL != env->_cycleState) {
+		record->cycleType = (uint32_t)env->_cycleState->_type;
+		record->contextId = env->_cycleState->_verboseContextID;
+	} else {
+		record->cycleType = 0;
+		record->contextId = 0;
+	}
+	record->data[0] = data0;
+	record->data[1] = data1;
+	record->data[2] = data2;
+	record->data[3] = data3;
+	record->data[4] = data4;
+	MM_AtomicOperations::storeSync();
+	_sequences[position & _recordMask] = position + 1;
+
+	/* wake the writing thread every quarter of the buffer, unless it is already awake or busy */
+	if ((0 == ((position + 1) & (_recordMask >> 2))) && !_writeRequested) {
+		if (0 == omrthread_monitor_try_enter(_monitor)) {
+			_writeRequested = true;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_exit(_monitor);
+		}
+	}
+}
+
+uint64_t
+MM_VerboseEventLog::durationInMicroseconds(uint64_t startTime, uint64_t endTime)
+{
+	if (endTime < startTime) {
+		return 0;
+	}
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	return omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+void
+MM_VerboseEventLog::writeRecords()
+{
+	uintptr_t count = 0;
+	while (true) {
+		uintptr_t slot = _dequeuePosition & _recordMask;
+		if (_sequences[slot] != (_dequeuePosition + 1)) {
+			break;
+		}
+		MM_AtomicOperations::loadSync();
+		_writeBatch[count] = _records[slot];
+		count += 1;
+		/* the copy must be complete before the slot can be claimed for the next lap */
+		MM_AtomicOperations::storeSync();
+		_sequences[slot] = _dequeuePosition + _recordMask + 1;
+		_dequeuePosition += 1;
+		if (VERBOSE_EVENT_LOG_WRITE_BATCH == count) {
+			flushWriteBatch(count);
+			count = 0;
+		}
+	}
+
+	uintptr_t droppedRecords = _droppedRecords;
+	if (droppedRecords != _reportedDroppedRecords) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		MM_VerboseEventRecord *record = &_writeBatch[count];
+		memset(record, 0, sizeof(MM_VerboseEventRecord));
+		record->type = VERBOSE_EVENT_RECORDS_DROPPED;
+		record->timestamp = omrtime_hires_clock();
+		record->data[0] = droppedRecords - _reportedDroppedRecords;
+		count += 1;
+		_reportedDroppedRecords = droppedRecords;
+	}
+
+	if (0 != count) {
+		flushWriteBatch(count);
+	}
+}
+
+void
+MM_VerboseEventLog::flushWriteBatch(uintptr_t count)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	if (-1 != _fileDescriptor) {
+		omrfile_write(_fileDescriptor, _writeBatch, count * sizeof(MM_VerboseEventRecord));
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseEventLog::writerThreadProc(void *info)
+{
+	MM_VerboseEventLog *eventLog = (MM_VerboseEventLog *)info;
+	eventLog->writerThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseEventLog::writerThreadEntryPoint()
+{
+	omrthread_monitor_enter(_monitor);
+	while (THREAD_RUNNING == _threadState) {
+		_writeRequested = false;
+		omrthread_monitor_exit(_monitor);
+		writeRecords();
+		omrthread_monitor_enter(_monitor);
+		if ((THREAD_RUNNING == _threadState) && !_writeRequested) {
+			omrthread_monitor_wait_timed(_monitor, VERBOSE_EVENT_LOG_FLUSH_MILLIS, 0);
+		}
+	}
+	_threadState = THREAD_NONE;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseEventLog::handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+
+	env->_cycleState->_verboseContextID = _manager->getIdAndIncrement();
+	report(env, VERBOSE_EVENT_CYCLE_START, 0, event->timestamp);
+}
+
+void
+MM_VerboseEventLog::handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_CYCLE_END, 0, event->timestamp);
+}
+
+void
+MM_VerboseEventLog::handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementStartEvent* event = (MM_GCIncrementStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+
+	report(env, VERBOSE_EVENT_INCREMENT_START, 0, event->timestamp, stats->_totalHeapSize, stats->_totalFreeHeapSize);
+}
+
+void
+MM_VerboseEventLog::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementEndEvent* event = (MM_GCIncrementEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+
+	/* process times are in nanoseconds */
+	int64_t userTime = (stats->_endProcessTimes._userTime - stats->_startProcessTimes._userTime) / 1000;
+	int64_t systemTime = (stats->_endProcessTimes._systemTime - stats->_startProcessTimes._systemTime) / 1000;
+
+	report(env, VERBOSE_EVENT_INCREMENT_END, 0, event->timestamp, stats->_totalHeapSize, stats->_totalFreeHeapSize,
+			durationInMicroseconds(stats->_startTime, stats->_endTime), (userTime < 0) ? 0 : userTime, (systemTime < 0) ? 0 : systemTime);
+}
+
+void
+MM_VerboseEventLog::handleExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ExclusiveAccessAcquireEvent* event = (MM_ExclusiveAccessAcquireEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_EXCLUSIVE_START, 0, event->timestamp,
+			durationInMicroseconds(0, event->exclusiveAccessTime), durationInMicroseconds(0, event->meanIdleTime), event->haltedThreads);
+}
+
+void
+MM_VerboseEventLog::handleExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ExclusiveAccessReleaseEvent* event = (MM_ExclusiveAccessReleaseEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_EXCLUSIVE_END, 0, event->timestamp);
+}
+
+void
+MM_VerboseEventLog::handleSystemGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_SystemGCStartEvent* event = (MM_SystemGCStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_SYSTEM_GC_START, 0, event->timestamp, event->gcCode);
+}
+
+void
+MM_VerboseEventLog::handleSystemGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_SystemGCEndEvent* event = (MM_SystemGCEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_SYSTEM_GC_END, 0, event->timestamp);
+}
+
+void
+MM_VerboseEventLog::handleAllocationFailureStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_AllocationFailureStartEvent* event = (MM_AllocationFailureStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_ALLOCATION_FAILURE_START, 0, event->timestamp, event->requestedBytes, event->tenure ? 1 : 0);
+}
+
+void
+MM_VerboseEventLog::handleAllocationFailureEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_AllocationFailureEndEvent* event = (MM_AllocationFailureEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	report(env, VERBOSE_EVENT_ALLOCATION_FAILURE_END, 0, event->timestamp);
+}
+
+void
+MM_VerboseEventLog::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_MarkEndEvent* event = (MM_MarkEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
+
+	report(env, VERBOSE_EVENT_MARK_END, 0, event->timestamp, durationInMicroseconds(markStats->_startTime, markStats->_endTime),
+			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+}
+
+void
+MM_VerboseEventLog::handleSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+
+	report(env, VERBOSE_EVENT_SWEEP_END, 0, event->timestamp, durationInMicroseconds(sweepStats->_startTime, sweepStats->_endTime));
+}
+
+void
+MM_VerboseEventLog::handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapResizeEvent* event = (MM_HeapResizeEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	if (0 != event->amount) {
+		report(env, VERBOSE_EVENT_HEAP_RESIZE, 0, event->timestamp, event->resizeType, event->amount, event->subSpaceType, event->reason,
+				durationInMicroseconds(0, event->timeTaken));
+	}
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_VerboseEventLog::handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompactEndEvent* event = (MM_CompactEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	MM_CompactStats *compactStats = &_extensions->globalGCStats.compactStats;
+
+	report(env, VERBOSE_EVENT_COMPACT_END, 0, event->timestamp, durationInMicroseconds(compactStats->_startTime, compactStats->_endTime),
+			compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_compactReason, compactStats->_compactPreventedReason);
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_VerboseEventLog::handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ScavengeEndEvent* event = (MM_ScavengeEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_ScavengerStats *scavengerStats = &_extensions->incrementScavengerStats;
+	uint16_t flags = 0;
+
+	if (event->cycleEnd) {
+		flags |= VERBOSE_EVENT_FLAG_SCAVENGE_CYCLE_END;
+	}
+	if (scavengerStats->_backout) {
+		flags |= VERBOSE_EVENT_FLAG_SCAVENGE_BACKOUT;
+	}
+	if (scavengerStats->_rememberedSetOverflow) {
+		flags |= VERBOSE_EVENT_FLAG_SCAVENGE_REMEMBERED_SET_OVERFLOW;
+	}
+	if ((0 != scavengerStats->_failedFlipCount) || (0 != scavengerStats->_failedTenureCount)) {
+		flags |= VERBOSE_EVENT_FLAG_SCAVENGE_FAILED_COPY;
+	}
+
+	report(env, VERBOSE_EVENT_SCAVENGE_END, flags, event->timestamp, durationInMicroseconds(scavengerStats->_startTime, scavengerStats->_endTime),
+			scavengerStats->_flipCount, scavengerStats->_flipBytes, scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes);
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+static void
+verboseEventLogCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleCycleStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleCycleEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleGCStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleGCEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleExclusiveStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleExclusiveEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogSystemGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleSystemGCStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogSystemGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleSystemGCEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogAllocationFailureStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleAllocationFailureStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogAllocationFailureEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleAllocationFailureEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleMarkEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleSweepEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventLogHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleHeapResize(hook, eventNum, eventData);
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void
+verboseEventLogCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleCompactEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void
+verboseEventLogScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventLog *)userData)->handleScavengeEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTLOG_HPP_)
+#define VERBOSEEVENTLOG_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrthread.h"
+
+#include "Base.hpp"
+#include "VerboseEventRecord.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_VerboseManager;
+
+/**
+ * Binary verbose GC output (see verboseEventLog), an alternative to the XML output for collectors with short,
+ * frequent pauses.
+ *
+ * The hooks which the XML output handlers format into strings on the GC thread are instead reduced to fixed size
+ * records (see VerboseEventRecord.hpp), which are copied into a lock-free ring buffer. A background thread drains
+ * the buffer to the log file, in batches, whenever it is a quarter full or every VERBOSE_EVENT_LOG_FLUSH_MILLIS.
+ * Reporting an event never blocks and never does I/O: if the buffer is full the record is dropped and counted,
+ * and the background thread writes a VERBOSE_EVENT_RECORDS_DROPPED record once it catches up.
+ *
+ * The ring buffer is a bounded multiple producer queue in which each slot carries a sequence number, so producers
+ * only contend on the compare and swap of the enqueue position, and the single consumer never writes it.
+ */
+class MM_VerboseEventLog : public MM_Base
+{
+/* Data members & types */
+public:
+protected:
+private:
+	enum {
+		VERBOSE_EVENT_LOG_FLUSH_MILLIS = 100, /**< Longest time a record waits in the buffer */
+		VERBOSE_EVENT_LOG_WRITE_BATCH = 256, /**< Records written per file write */
+	};
+
+	enum ThreadState {
+		THREAD_NONE = 0,
+		THREAD_RUNNING,
+		THREAD_SHUTDOWN_REQUESTED,
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	OMR_VM *_omrVM;
+	J9HookInterface** _mmPrivateHooks; /**< Pointers to the internal Hook interface */
+	J9HookInterface** _mmOmrHooks; /**< Pointers to the OMR Hook interface */
+	MM_VerboseManager *_manager;
+
+	MM_VerboseEventRecord *_records; /**< Ring buffer, a power of 2 number of records */
+	volatile uintptr_t *_sequences; /**< Sequence number of each slot of the ring buffer */
+	uintptr_t _recordMask; /**< Number of records in the ring buffer - 1 */
+	volatile uintptr_t _enqueuePosition; /**< Position of the next record reported */
+	uintptr_t _dequeuePosition; /**< Position of the next record to write, only used by the writing thread */
+	volatile uintptr_t _droppedRecords; /**< Number of records dropped because the buffer was full */
+	uintptr_t _reportedDroppedRecords; /**< Number of dropped records written to the log so far */
+	volatile bool _writeRequested; /**< True if the writing thread has been woken since it last drained the buffer */
+
+	intptr_t _fileDescriptor; /**< Log file, -1 once closed */
+	omrthread_monitor_t _monitor; /**< Protects the thread state */
+	ThreadState _threadState; /**< State of the writing thread */
+	MM_VerboseEventRecord _writeBatch[VERBOSE_EVENT_LOG_WRITE_BATCH]; /**< Records drained from the buffer, waiting to be written */
+
+/* Methods */
+public:
+	/**
+	 * Open the log file and start the writing thread.
+	 * @param filename the log file, truncated if it exists
+	 * @param records number of records in the ring buffer, rounded up to a power of 2
+	 * @return the log, or NULL if the file could not be opened or the thread could not be started
+	 */
+	static MM_VerboseEventLog *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename, uintptr_t records);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Hook the GC events which are recorded.
+	 */
+	void enableVerbose();
+
+	/**
+	 * Unhook the GC events which are recorded.
+	 */
+	void disableVerbose();
+
+	/**
+	 * Stop the writing thread, write the records left in the buffer and close the log file.
+	 */
+	void closeStream(MM_EnvironmentBase *env);
+
+	void handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleSystemGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleSystemGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleAllocationFailureStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleAllocationFailureEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	void handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	void handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	MM_VerboseEventLog(MM_GCExtensionsBase *extensions, MM_VerboseManager *manager);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t records);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Copy a record into the ring buffer, or drop it if the buffer is full. Never blocks.
+	 */
+	void report(MM_EnvironmentBase *env, VerboseEventType type, uint16_t flags, uint64_t timestamp, uint64_t data0 = 0, uint64_t data1 = 0, uint64_t data2 = 0, uint64_t data3 = 0, uint64_t data4 = 0);
+
+	/**
+	 * @return the time between two timestamps in microseconds, 0 if the clock went backwards
+	 */
+	uint64_t durationInMicroseconds(uint64_t startTime, uint64_t endTime);
+
+	/**
+	 * Write the records in the ring buffer to the log file. Only called by one thread at a time.
+	 */
+	void writeRecords();
+
+	/**
+	 * Write the records of the write batch to the log file.
+	 */
+	void flushWriteBatch(uintptr_t count);
+
+	static int J9THREAD_PROC writerThreadProc(void *info);
+	void writerThreadEntryPoint();
+};
+
+#endif /* VERBOSEEVENTLOG_HPP_ */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTRECORD_HPP_)
+#define VERBOSEEVENTRECORD_HPP_
+
+#include "omrcomp.h"
+
+/**
+ * Layout of the binary verbose GC event log written by MM_VerboseEventLog (see verboseEventLog).
+ *
+ * The log is a MM_VerboseEventLogHeader followed by fixed size MM_VerboseEventRecord records, in the byte order
+ * of the machine which wrote it. Records are written in the order in which they were reported, which is not
+ * strictly the order of their timestamps when several threads report events at once. The layout is shared with
+ * the decoder in perftest/gctest, so any change to it must bump VERBOSE_EVENT_LOG_VERSION.
+ */
+
+#define VERBOSE_EVENT_LOG_MAGIC "OMRGCEVT"
+#define VERBOSE_EVENT_LOG_VERSION 1
+
+typedef struct MM_VerboseEventLogHeader {
+	char magic[8]; /**< VERBOSE_EVENT_LOG_MAGIC, not NUL terminated */
+	uint32_t version; /**< VERBOSE_EVENT_LOG_VERSION */
+	uint32_t recordSize; /**< sizeof(MM_VerboseEventRecord) */
+	uint64_t hiresFrequency; /**< Ticks per second of the record timestamps */
+	uint64_t creationTime; /**< Timestamp (in ticks) of the log creation */
+	uint64_t creationTimeMillis; /**< Wall clock time (in ms since the epoch) of the log creation */
+	uint64_t reserved;
+} MM_VerboseEventLogHeader;
+
+/**
+ * Record types. The meaning of the data words of each type is given next to it.
+ */
+typedef enum {
+	VERBOSE_EVENT_NONE = 0,
+	VERBOSE_EVENT_CYCLE_START, /**< - */
+	VERBOSE_EVENT_CYCLE_END, /**< - */
+	VERBOSE_EVENT_INCREMENT_START, /**< heap bytes, free heap bytes */
+	VERBOSE_EVENT_INCREMENT_END, /**< heap bytes, free heap bytes, duration (us), user time (us), system time (us) */
+	VERBOSE_EVENT_EXCLUSIVE_START, /**< time to get exclusive access (us), mean idle time (us), halted threads */
+	VERBOSE_EVENT_EXCLUSIVE_END, /**< - */
+	VERBOSE_EVENT_SYSTEM_GC_START, /**< gc code */
+	VERBOSE_EVENT_SYSTEM_GC_END, /**< - */
+	VERBOSE_EVENT_ALLOCATION_FAILURE_START, /**< requested bytes, 1 if the allocation was from tenure */
+	VERBOSE_EVENT_ALLOCATION_FAILURE_END, /**< - */
+	VERBOSE_EVENT_MARK_END, /**< duration (us), objects marked, objects scanned, bytes scanned */
+	VERBOSE_EVENT_SWEEP_END, /**< duration (us) */
+	VERBOSE_EVENT_COMPACT_END, /**< duration (us), objects moved, bytes moved, compact reason, compact prevented reason */
+	VERBOSE_EVENT_SCAVENGE_END, /**< duration (us), objects flipped, bytes flipped, objects tenured, bytes tenured */
+	VERBOSE_EVENT_HEAP_RESIZE, /**< resize type, bytes, subspace type, reason, duration (us) */
+	VERBOSE_EVENT_RECORDS_DROPPED, /**< number of records dropped because the ring buffer was full */
+	VERBOSE_EVENT_TYPE_COUNT
+} VerboseEventType;
+
+/**
+ * Flags of VERBOSE_EVENT_SCAVENGE_END records.
+ */
+#define VERBOSE_EVENT_FLAG_SCAVENGE_CYCLE_END 0x1
+#define VERBOSE_EVENT_FLAG_SCAVENGE_BACKOUT 0x2
+#define VERBOSE_EVENT_FLAG_SCAVENGE_REMEMBERED_SET_OVERFLOW 0x4
+#define VERBOSE_EVENT_FLAG_SCAVENGE_FAILED_COPY 0x8
+
+#define VERBOSE_EVENT_RECORD_DATA_COUNT 5
+
+typedef struct MM_VerboseEventRecord {
+	uint16_t type; /**< VerboseEventType */
+	uint16_t flags; /**< Type specific flags */
+	uint32_t cycleType; /**< OMR_GC_CYCLE_TYPE_* of the cycle in progress, 0 if none */
+	uint64_t timestamp; /**< Time of the event in ticks */
+	uint64_t contextId; /**< Identifier of the cycle in progress, 0 if none */
+	uint64_t data[VERBOSE_EVENT_RECORD_DATA_COUNT]; /**< Type specific data */
+} MM_VerboseEventRecord;
+
+#endif /* VERBOSEEVENTRECORD_HPP_ */
@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "AdaptiveTaskThreading.hpp"
 #include "AllocateDescription.hpp"
 #include "AllocationStats.hpp"
 #include "CycleState.hpp"
@@ -28,9 +29,11 @@
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
+#include "HeapPretoucher.hpp"
 #include "HeapRegionManager.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
+#include "TreeBarrier.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -265,6 +268,19 @@ MM_VerboseHandlerOutput::getConcurrentTerminationReason(MM_ConcurrentPhaseStatsB
 	return reasonForTermination;
 }
 
+const char *
+MM_VerboseHandlerOutput::getMetadataPagePolicyString(MM_GCExtensionsBase::MetadataPagePolicy pagePolicy)
+{
+	switch (pagePolicy) {
+	case MM_GCExtensionsBase::METADATA_PAGE_POLICY_HUGE:
+		return "huge";
+	case MM_GCExtensionsBase::METADATA_PAGE_POLICY_TRANSPARENT:
+		return "transparent";
+	default:
+		return "default";
+	}
+}
+
 void
 MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_VerboseBuffer *buffer)
 {
@@ -308,6 +324,22 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", getPageTypeString(_extensions->heap->getPageFlags()));
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", _extensions->requestedPageSize);
 	buffer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", getPageTypeString(_extensions->requestedPageFlags));
+	buffer->formatAndOutput(env, 1, "<attribute name=\"metadataPageSize\" value=\"0x%zx\" />", _extensions->gcmetadataPageSize);
+	if (0 != _extensions->heapMapPageSize) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"heapMapPageSize\" value=\"0x%zx\" />", _extensions->heapMapPageSize);
+		buffer->formatAndOutput(env, 1, "<attribute name=\"heapMapPagePolicy\" value=\"%s\" />", getMetadataPagePolicyString(_extensions->heapMapPagePolicy));
+	}
+	if (0 != _extensions->cardTablePageSize) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"cardTablePageSize\" value=\"0x%zx\" />", _extensions->cardTablePageSize);
+		buffer->formatAndOutput(env, 1, "<attribute name=\"cardTablePagePolicy\" value=\"%s\" />", getMetadataPagePolicyString(_extensions->cardTablePagePolicy));
+	}
+	if (NULL != _extensions->heapPretoucher) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"pretouchedBytes\" value=\"0x%zx\" />", _extensions->heapPretoucher->getPretouchedBytes());
+	}
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/* the compact tables are only allocated by the first compaction, which reports the page size they got */
+	buffer->formatAndOutput(env, 1, "<attribute name=\"compactTablePagePolicy\" value=\"%s\" />", getMetadataPagePolicyString(_extensions->compactTablePagePolicy));
+#endif /* OMR_GC_MODRON_COMPACTION */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", _extensions->gcThreadCount);
 
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
@@ -328,6 +360,7 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
+	buffer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSearchCursors\" value=\"%s\" />", _extensions->splitFreeListSearchCursors ? "true" : "false");
 	buffer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", _extensions->_numaManager.getAffinityLeaderCount());
 
 	outputInitializedInnerStanza(env, buffer);
@@ -830,6 +863,9 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (_extensions->preZeroNurseryInBackground) {
+			writer->formatAndOutput(env, 1, "<tlh-prezeroed bytes=\"%zu\" />", systemStats->_tlhAllocatedPreZeroed);
+		}
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -854,6 +890,53 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 }
 
 
+void
+MM_VerboseHandlerOutput::outputSyncPointStats(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_SyncPointStats *syncPointStats = &_extensions->syncPointStats;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	for (uintptr_t i = 0; i < MM_SyncPointStats::entryCount; i++) {
+		MM_SyncPointStats::Entry *entry = &syncPointStats->_entries[i];
+		if (NULL != entry->_id) {
+			uint64_t waitTime = omrtime_hires_delta(0, entry->_waitTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t maxWaitTime = omrtime_hires_delta(0, entry->_maxWaitTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(env, indent, "<sync-point id=\"%s\" arrivals=\"%zu\" waitms=\"%llu.%03.3llu\" maxwaitms=\"%llu.%03.3llu\" />",
+				entry->_id, entry->_arrivals, waitTime / 1000, waitTime % 1000, maxWaitTime / 1000, maxWaitTime % 1000);
+		}
+	}
+	if (0 != syncPointStats->_overflowCount) {
+		writer->formatAndOutput(env, indent, "<sync-point-overflow arrivals=\"%zu\" />", syncPointStats->_overflowCount);
+	}
+}
+
+void
+MM_VerboseHandlerOutput::outputSyncBarrierStats(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_TreeBarrier *barrier = _extensions->dispatcher->getSynchronizeBarrier();
+
+	writer->formatAndOutput(env, indent, "<sync-barrier type=\"tree\" fanin=\"%zu\" levels=\"%zu\" episodes=\"%zu\" arrivals=\"%zu\" parks=\"%zu\" />",
+		barrier->getFanIn(), barrier->getMaxLevels(), barrier->getEpisodes(), barrier->getArrivals(), barrier->getParks());
+}
+
+void
+MM_VerboseHandlerOutput::outputTaskThreadCounts(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_AdaptiveTaskThreading *adaptiveTaskThreading = _extensions->dispatcher->getAdaptiveTaskThreading();
+
+	for (uintptr_t i = 0; i < MM_AdaptiveTaskThreading::entryCount; i++) {
+		MM_AdaptiveTaskThreading::Entry *entry = adaptiveTaskThreading->getEntry(i);
+		if ((NULL != entry) && (0 != entry->_reportedRuns)) {
+			writer->formatAndOutput(env, indent, "<task-threads task=\"%s\" runs=\"%zu\" threads=\"%zu\" work=\"%zu\" timems=\"%llu.%03.3llu\" predictedus=\"%llu\" previousthreads=\"%zu\" previouspredictedus=\"%llu\" />",
+				entry->_taskName, entry->_reportedRuns, entry->_lastThreadCount, entry->_lastWork, entry->_lastTime / 1000, entry->_lastTime % 1000,
+				entry->_predictedThreadTime, entry->_previousRecommendedThreadCount, entry->_previousPredictedThreadTime);
+		}
+	}
+}
+
 void
 MM_VerboseHandlerOutput::handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
@@ -913,6 +996,15 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	if (_extensions->syncPointStatsEnabled) {
+		outputSyncPointStats(env, _manager->getIndentLevel() + 1);
+	}
+	if (NULL != _extensions->dispatcher->getSynchronizeBarrier()) {
+		outputSyncBarrierStats(env, _manager->getIndentLevel() + 1);
+	}
+	if (NULL != _extensions->dispatcher->getAdaptiveTaskThreading()) {
+		outputTaskThreadCounts(env, _manager->getIndentLevel() + 1);
+	}
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
@@ -199,6 +199,27 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output the time GC threads waited at each synchronization point of parallel tasks since the start of the GC.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputSyncPointStats(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output the episodes, arrivals and parks of the synchronization tree barrier since the start of the GC.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputSyncBarrierStats(MM_EnvironmentBase *env, uintptr_t indent);
+
+	/**
+	 * Output the thread count picked by adaptive task threading for each task type run since the start of the GC.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputTaskThreadCounts(MM_EnvironmentBase *env, uintptr_t indent);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
@@ -391,6 +412,13 @@ public:
 	 */ 
 	virtual const char *getConcurrentTerminationReason(MM_ConcurrentPhaseStatsBase *stats);
 
+	/**
+	 * Get the name of a GC metadata page policy.
+	 * @param pagePolicy page policy
+	 * @return string representing the page policy
+	 */
+	const char *getMetadataPagePolicyString(MM_GCExtensionsBase::MetadataPagePolicy pagePolicy);
+
 	/**
 	 * Handle any output or data tracking for the initialized phase of verbose GC.
 	 * Called during initialization of GC, stanza printed to all writers via writer chain.
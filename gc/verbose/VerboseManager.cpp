@@ -28,6 +28,7 @@
 #include "GCExtensionsBase.hpp"
 #include "VerboseManager.hpp"
 
+#include "VerboseEventLog.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseWriter.hpp"
@@ -104,6 +105,11 @@ void
 MM_VerboseManager::tearDown(MM_EnvironmentBase *env)
 {
 	disableVerboseGC();
+
+	if (NULL != _eventLog) {
+		_eventLog->kill(env);
+		_eventLog = NULL;
+	}
 	
 	if(NULL != _verboseHandlerOutput) {
 		_verboseHandlerOutput->kill(env);
@@ -133,6 +139,10 @@ MM_VerboseManager::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 void
 MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 {
+	if (NULL != _eventLog) {
+		_eventLog->closeStream(env);
+	}
+
 	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
 	while(NULL != writer) {
 		writer->closeStream(env);
@@ -144,7 +154,11 @@ void
 MM_VerboseManager::enableVerboseGC()
 {
 	if (!_hooksAttached) {
-		_verboseHandlerOutput->enableVerbose();
+		if (NULL != _eventLog) {
+			_eventLog->enableVerbose();
+		} else {
+			_verboseHandlerOutput->enableVerbose();
+		}
 		_hooksAttached = true;
 	}
 }
@@ -153,7 +167,11 @@ void
 MM_VerboseManager::disableVerboseGC()
 {
 	if (_hooksAttached) {
-		_verboseHandlerOutput->disableVerbose();
+		if (NULL != _eventLog) {
+			_eventLog->disableVerbose();
+		} else {
+			_verboseHandlerOutput->disableVerbose();
+		}
 		_hooksAttached = false;
 	}
 }
@@ -186,7 +204,7 @@ uintptr_t
 MM_VerboseManager::countActiveOutputHandlers()
 {
 	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
-	uintptr_t count = 0;
+	uintptr_t count = (NULL != _eventLog) ? 1 : 0;
 
 	while(NULL != writer) {
 		if(writer->isActive()) {
@@ -260,6 +278,20 @@ MM_VerboseManager::configureVerboseGC(OMR_VM *omrVM, char *filename, uintptr_t f
 
 	WriterType type = parseWriterType(&env, filename, fileCount, iterations);
 
+	if (env.getExtensions()->verboseEventLog
+		&& ((VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS == type) || (VERBOSE_WRITER_FILE_LOGGING_BUFFERED == type))
+	) {
+		/* binary records are only written to a file, and only to the first one configured. Fall back to the XML
+		 * output if it cannot be opened.
+		 */
+		if ((NULL == _eventLog) && !_hooksAttached) {
+			_eventLog = MM_VerboseEventLog::newInstance(&env, this, filename, env.getExtensions()->verboseEventLogRecords);
+		}
+		if (NULL != _eventLog) {
+			return true;
+		}
+	}
+
 	writer = findWriterInChain(type);
 
 	if (NULL != writer) {
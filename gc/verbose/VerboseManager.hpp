@@ -30,6 +30,7 @@
 #include "VerboseWriter.hpp"
 
 class MM_EnvironmentBase;
+class MM_VerboseEventLog;
 class MM_VerboseHandlerOutput;
 class MM_VerboseWriterChain;
 
@@ -50,6 +51,7 @@ private:
 protected:
 	MM_VerboseWriterChain* _writerChain; /**< The chain of writers for new verbose */
 	MM_VerboseHandlerOutput *_verboseHandlerOutput;  /**< New verbose format output handler */
+	MM_VerboseEventLog *_eventLog; /**< Binary output, replaces the writer chain and the output handler when verboseEventLog is enabled */
 
 public:
 	
@@ -118,6 +120,7 @@ public:
 
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	MM_VerboseHandlerOutput* getVerboseHandlerOutput() { return _verboseHandlerOutput; }
+	MM_VerboseEventLog* getEventLog() { return _eventLog; }
 
 	virtual void handleFileOpenError(MM_EnvironmentBase *env, char *fileName) {}
 
@@ -125,6 +128,7 @@ public:
 		: MM_VerboseManagerBase(omrVM)
 		, _writerChain(NULL)
 		, _verboseHandlerOutput(NULL)
+		, _eventLog(NULL)
 	{
 	}
 };
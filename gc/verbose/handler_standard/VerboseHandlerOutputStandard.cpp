@@ -278,6 +278,17 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+	if (extensions->segregatedYoungCollection) {
+		writer->formatAndOutput(env, 1, "<young-mark young=\"%s\" rememberedobjects=\"%zu\" />",
+				markStats->_youngMark ? "true" : "false", markStats->_rememberedObjectsScanned);
+	}
+
+	if (extensions->workPacketStealing) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-stealing packetsStolen=\"%zu\" stealFailures=\"%zu\" />",
+				workPacketStats->workPacketsStolen, workPacketStats->workPacketStealFailures);
+	}
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -350,8 +361,9 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" fixupcount=\"%zu\" sliding=\"%s\" reason=\"%s\" tablepagesize=\"0x%zx\" />",
+				compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_fixupObjects, compactStats->_sliding ? "true" : "false",
+				getCompactionReasonAsString(compactStats->_compactReason), _extensions->compactTablePageSize);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -410,6 +422,15 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (extensions->scavengerNUMAPartitioning) {
+		writer->formatAndOutput(env, 1, "<numa-scavenge nodes=\"%zu\" nodelocalsurvivorcaches=\"%zu\" nodelocaltenurecaches=\"%zu\" remotescancaches=\"%zu\" />",
+				extensions->_numaManager.getAffinityLeaderCount(), scavengerStats->_semiSpaceAllocationCountNodeLocal,
+				scavengerStats->_tenureSpaceAllocationCountNodeLocal, scavengerStats->_remoteNodeScanCacheCount);
+	}
+	if (extensions->isScavengerHotFieldDepthCopyEnabled()) {
+		writer->formatAndOutput(env, 1, "<hot-field-copy objects=\"%zu\" children=\"%zu\" depthmax=\"%zu\" />",
+				scavengerStats->_hotFieldCopyCount, scavengerStats->_childDepthCopyCount, extensions->depthCopyMax);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -424,6 +445,11 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 			writer->formatAndOutput(env, 1, "<warning details=\"remembered set overflow triggered\" />");
 		}
 	}
+	if (extensions->scavengerRememberedSetOverflowMap && (scavengerStats->_rememberedSetOverflow || scavengerStats->_causedRememberedSetOverflow)) {
+		writer->formatAndOutput(env, 1, "<remembered-set-overflow-map cards=\"%zu\" objects=\"%zu\" recovered=\"%s\" />",
+				scavengerStats->_rememberedSetOverflowMapCards, scavengerStats->_rememberedSetOverflowMapObjects,
+				(0 != scavengerStats->_rememberedSetOverflowMapRecovered) ? "true" : "false");
+	}
 	if(scavengerStats->_scanCacheOverflow) {
 		writer->formatAndOutput(env, 1, "<warning details=\"scan cache overflow (new chunk allocation acquired durationms=%zu, fromHeap=%s)\" />", scavengerStats->_scanCacheAllocationDurationDuringSavenger, (0 != scavengerStats->_scanCacheAllocationFromHeap)?"true":"false");
 	}
@@ -541,6 +567,18 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
 			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
 
+	if (_extensions->concurrentCardCleaningQueue && _extensions->optimizeConcurrentWB) {
+		writer->formatAndOutput(
+				env, 1, "<dirty-card-queue drained=\"%s\" overflowed=\"%s\" cardsQueued=\"%zu\" cardsAtConcurrentCleaning=\"%zu\" cardsAtFinalCleaning=\"%zu\" />",
+				(0 != event->dirtyCardQueueDrained) ? "true" : "false", (0 != event->dirtyCardQueueOverflowed) ? "true" : "false", event->dirtyCardsQueued, event->dirtyCardsAtConcurrentCleaning, event->dirtyCardsAtFinalCleaning);
+	}
+	if (0 != _extensions->finalCardCleaningPauseTarget) {
+		writer->formatAndOutput(
+				env, 1, "<pause-target targetms=\"%.3f\" predictedms=\"%.3f\" extraPasses=\"%zu\" lastPassReducedCards=\"%s\" />",
+				(double)_extensions->finalCardCleaningPauseTarget / 1000.0, (double)event->predictedFinalCardCleaningTime / 1000.0, event->extraCardCleaningPasses,
+				(0 != event->lastCardCleaningPassReducedDirtyCards) ? "true" : "false");
+	}
+
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
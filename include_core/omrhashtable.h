@@ -51,6 +51,7 @@ extern "C" {
 #define J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32	0x00000004	/*!< Allocate table elements using the malloc32 function */
 #define J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION	0x00000008	/*!< Allow space optimized hashTable, some functions not supported */
 #define J9HASH_TABLE_DO_NOT_REHASH	0x00000010	/*!< Do not rehash the table while set */
+#define J9HASH_TABLE_CONCURRENT	0x00000020	/*!< Allow lookups, additions and removals from several threads at once */
 
 /*
  * This used to include a cast to uintptr_t, but ddrgen doesn't
@@ -91,6 +92,7 @@ extern "C" {
 
 struct J9HashTable; /* Forward struct declaration */
 struct J9AVLTreeNode; /* Forward struct declaration */
+struct J9HashTableConcurrentData; /* Forward struct declaration */
 typedef uintptr_t (*J9HashTableHashFn)(void *entry, void *userData);  /* Forward struct declaration */
 typedef uintptr_t (*J9HashTableEqualFn)(void *leftEntry, void *rightEntry, void *userData);  /* Forward struct declaration */
 typedef intptr_t (*J9HashTableComparatorFn)(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struct J9AVLTreeNode *rightNode);  /* Forward struct declaration */
@@ -120,6 +122,7 @@ typedef struct J9HashTable {
 	void *equalFnUserData;
 	void *hashFnUserData;
 	struct J9HashTable *previous;
+	struct J9HashTableConcurrentData *concurrentData;
 } J9HashTable;
 
 typedef struct J9HashTableState {
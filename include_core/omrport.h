@@ -863,6 +863,9 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_NOIPT  "NOIPT"
 #define OMRPORT_CTLDATA_TIME_CLEAR_TICK_TOCK  "TIME_CLEAR_TICK_TOCK"
 #define OMRPORT_CTLDATA_MEM_CATEGORIES_SET  "MEM_CATEGORIES_SET"
+#define OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS  "MEM_CATEGORIES_EXACT_COUNTERS"
+#define OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR  "MEM_SMALL_BLOCK_ALLOCATOR"
+#define OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATED  "MEM_SMALL_BLOCK_ALLOCATED"
 #define OMRPORT_CTLDATA_AIX_PROC_ATTR  "AIX_PROC_ATTR"
 #define OMRPORT_CTLDATA_ALLOCATE32_COMMIT_SIZE  "ALLOCATE32_COMMIT_SIZE"
 #define OMRPORT_CTLDATA_NOSUBALLOC32BITMEM  "NOSUBALLOC32BITMEM"
@@ -48,6 +48,9 @@ extern "C" {
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* Flags for omrthread_rwmutex_init */
+#define J9THREAD_RWMUTEX_SCALABLE_READERS	0x1 /* Readers do not enter a shared monitor, and pending writers hold off new readers */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
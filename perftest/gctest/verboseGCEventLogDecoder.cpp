@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+#include "omrport.h"
+
+#include "verboseGCEventLogDecoder.hpp"
+
+#define RECORDS_PER_READ 256
+
+static const char *EVENT_TYPE_NAMES[VERBOSE_EVENT_TYPE_COUNT] = {
+	"none",
+	"cycle-start",
+	"cycle-end",
+	"gc-start",
+	"gc-end",
+	"exclusive-start",
+	"exclusive-end",
+	"sys-start",
+	"sys-end",
+	"af-start",
+	"af-end",
+	"mark",
+	"sweep",
+	"compact",
+	"scavenge",
+	"heap-resize",
+	"records-dropped"
+};
+
+/* names of the data words of each record type, NULL for the unused ones */
+static const char *EVENT_DATA_NAMES[VERBOSE_EVENT_TYPE_COUNT][VERBOSE_EVENT_RECORD_DATA_COUNT] = {
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "heapBytes", "freeBytes", NULL, NULL, NULL },
+	{ "heapBytes", "freeBytes", "durationus", "usertimeus", "systemtimeus" },
+	{ "exclusiveaccessus", "meanidleus", "haltedThreads", NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "gcCode", NULL, NULL, NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "requestedBytes", "tenure", NULL, NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "durationus", "objectsMarked", "objectsScanned", "bytesScanned", NULL },
+	{ "durationus", NULL, NULL, NULL, NULL },
+	{ "durationus", "objectsMoved", "bytesMoved", "reason", "preventedReason" },
+	{ "durationus", "objectsFlipped", "bytesFlipped", "objectsTenured", "bytesTenured" },
+	{ "resizeType", "bytes", "subSpaceType", "reason", "durationus" },
+	{ "count", NULL, NULL, NULL, NULL }
+};
+
+static const char *
+getCycleTypeName(uint32_t cycleType)
+{
+	switch (cycleType) {
+	case OMR_GC_CYCLE_TYPE_DEFAULT:
+		return "default";
+	case OMR_GC_CYCLE_TYPE_GLOBAL:
+		return "global";
+	case OMR_GC_CYCLE_TYPE_SCAVENGE:
+		return "scavenge";
+	default:
+		return "unknown";
+	}
+}
+
+static uint64_t
+ticksToMicroseconds(uint64_t ticks, uint64_t frequency)
+{
+	return ((ticks / frequency) * 1000000) + (((ticks % frequency) * 1000000) / frequency);
+}
+
+const char *
+getVerboseGCEventTypeName(uint32_t type)
+{
+	if ((VERBOSE_EVENT_NONE == type) || (VERBOSE_EVENT_TYPE_COUNT <= type)) {
+		return NULL;
+	}
+	return EVENT_TYPE_NAMES[type];
+}
+
+static bool
+readHeader(intptr_t fd, MM_VerboseEventLogHeader *header, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	if ((intptr_t)sizeof(MM_VerboseEventLogHeader) != omrfile_read(fd, header, sizeof(MM_VerboseEventLogHeader))) {
+		return false;
+	}
+	return 0 == memcmp(header->magic, VERBOSE_EVENT_LOG_MAGIC, sizeof(header->magic));
+}
+
+bool
+isVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	MM_VerboseEventLogHeader header;
+	bool result = false;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 != fd) {
+		result = readHeader(fd, &header, portLibrary);
+		omrfile_close(fd);
+	}
+	return result;
+}
+
+static void
+printRecord(MM_VerboseEventRecord *record, MM_VerboseEventLogHeader *header, OMRPortLibrary *portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t time = (record->timestamp < header->creationTime) ? 0 : ticksToMicroseconds(record->timestamp - header->creationTime, header->hiresFrequency);
+
+	omrtty_printf("{\"type\":\"%s\",\"timeus\":%llu,\"cycleType\":\"%s\",\"contextId\":%llu",
+			EVENT_TYPE_NAMES[record->type], time, getCycleTypeName(record->cycleType), record->contextId);
+	if (VERBOSE_EVENT_SCAVENGE_END == record->type) {
+		omrtty_printf(",\"cycleEnd\":%s,\"backout\":%s,\"rememberedSetOverflow\":%s,\"failedCopy\":%s",
+				(0 != (record->flags & VERBOSE_EVENT_FLAG_SCAVENGE_CYCLE_END)) ? "true" : "false",
+				(0 != (record->flags & VERBOSE_EVENT_FLAG_SCAVENGE_BACKOUT)) ? "true" : "false",
+				(0 != (record->flags & VERBOSE_EVENT_FLAG_SCAVENGE_REMEMBERED_SET_OVERFLOW)) ? "true" : "false",
+				(0 != (record->flags & VERBOSE_EVENT_FLAG_SCAVENGE_FAILED_COPY)) ? "true" : "false");
+	}
+	for (uintptr_t i = 0; i < VERBOSE_EVENT_RECORD_DATA_COUNT; i++) {
+		const char *name = EVENT_DATA_NAMES[record->type][i];
+		if (NULL != name) {
+			omrtty_printf(",\"%s\":%llu", name, record->data[i]);
+		}
+	}
+	omrtty_printf("}\n");
+}
+
+int32_t
+readVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary, bool printRecords, VerboseGCEventLogSummary *summary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	MM_VerboseEventLogHeader header;
+	MM_VerboseEventRecord records[RECORDS_PER_READ];
+
+	memset(summary, 0, sizeof(VerboseGCEventLogSummary));
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		omrtty_printf("Error opening file : %s\n", fileName);
+		return -1;
+	}
+	if (!readHeader(fd, &header, portLibrary)
+		|| (VERBOSE_EVENT_LOG_VERSION != header.version)
+		|| (sizeof(MM_VerboseEventRecord) != header.recordSize)
+		|| (0 == header.hiresFrequency)
+	) {
+		omrtty_printf("Not a supported verbose GC event log : %s\n", fileName);
+		omrfile_close(fd);
+		return -1;
+	}
+
+	intptr_t bytesRead = 0;
+	while (0 < (bytesRead = omrfile_read(fd, records, sizeof(records)))) {
+		/* a partial record at the end of the file is the sign of a log still being written */
+		uintptr_t count = (uintptr_t)bytesRead / sizeof(MM_VerboseEventRecord);
+		for (uintptr_t i = 0; i < count; i++) {
+			MM_VerboseEventRecord *record = &records[i];
+			if ((VERBOSE_EVENT_NONE == record->type) || (VERBOSE_EVENT_TYPE_COUNT <= record->type)) {
+				summary->unknownRecords += 1;
+				continue;
+			}
+			summary->records += 1;
+			summary->recordsOfType[record->type] += 1;
+			switch (record->type) {
+			case VERBOSE_EVENT_INCREMENT_END:
+				summary->pauses += 1;
+				summary->totalPauseTime += record->data[2];
+				if (summary->maxPauseTime < record->data[2]) {
+					summary->maxPauseTime = record->data[2];
+				}
+				break;
+			case VERBOSE_EVENT_CYCLE_START:
+				if (OMR_GC_CYCLE_TYPE_SCAVENGE == record->cycleType) {
+					summary->scavenges += 1;
+				} else if (OMR_GC_CYCLE_TYPE_GLOBAL == record->cycleType) {
+					summary->globals += 1;
+				}
+				break;
+			case VERBOSE_EVENT_RECORDS_DROPPED:
+				summary->droppedRecords += record->data[0];
+				break;
+			default:
+				break;
+			}
+			if (printRecords) {
+				printRecord(record, &header, portLibrary);
+			}
+		}
+	}
+	omrfile_close(fd);
+
+	return 0;
+}
+
+int32_t
+decodeVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary, bool printRecords)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	VerboseGCEventLogSummary summary;
+
+	if (0 != readVerboseGCEventLog(fileName, portLibrary, printRecords, &summary)) {
+		return -1;
+	}
+
+	omrtty_printf("{\"summary\":\"%s\",\"records\":%llu,\"droppedRecords\":%llu,\"unknownRecords\":%llu,\"scavenges\":%llu,\"globals\":%llu,"
+			"\"pauses\":%llu,\"totalPauseus\":%llu,\"avgPauseus\":%llu,\"maxPauseus\":%llu}\n",
+			fileName, summary.records, summary.droppedRecords, summary.unknownRecords, summary.scavenges, summary.globals,
+			summary.pauses, summary.totalPauseTime, (0 == summary.pauses) ? 0 : (summary.totalPauseTime / summary.pauses), summary.maxPauseTime);
+
+	return 0;
+}
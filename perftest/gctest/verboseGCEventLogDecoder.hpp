@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCEVENTLOGDECODER_HPP_)
+#define VERBOSEGCEVENTLOGDECODER_HPP_
+
+#include "omrport.h"
+
+#include "VerboseEventRecord.hpp"
+
+/**
+ * Counts of the records of a binary verbose GC event log.
+ */
+typedef struct VerboseGCEventLogSummary {
+	uint64_t records; /**< Records of a known type */
+	uint64_t droppedRecords; /**< Records the writer dropped, as reported by its VERBOSE_EVENT_RECORDS_DROPPED records */
+	uint64_t unknownRecords; /**< Records of no or of an unknown type */
+	uint64_t recordsOfType[VERBOSE_EVENT_TYPE_COUNT]; /**< Records of each type */
+	uint64_t scavenges;
+	uint64_t globals;
+	uint64_t pauses;
+	uint64_t totalPauseTime; /**< In microseconds */
+	uint64_t maxPauseTime; /**< In microseconds */
+} VerboseGCEventLogSummary;
+
+/**
+ * @return true if the file is a binary verbose GC event log (see MM_VerboseEventLog) rather than an XML log
+ */
+bool isVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary);
+
+/**
+ * @return the name of a record type as it is printed by decodeVerboseGCEventLog, NULL for an unknown type
+ */
+const char *getVerboseGCEventTypeName(uint32_t type);
+
+/**
+ * Read a binary verbose GC event log and count its records into summary. Each record is printed as a JSON
+ * object on a line of its own if printRecords is true.
+ * @return 0 on success, -1 if the file could not be read or is not an event log of a supported version
+ */
+int32_t readVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary, bool printRecords, VerboseGCEventLogSummary *summary);
+
+/**
+ * Decode a binary verbose GC event log. Each record is printed as a JSON object on a line of its own if
+ * printRecords is true, followed by a JSON summary of the GC pauses in the log.
+ * @return 0 on success, -1 if the file could not be read or is not an event log of a supported version
+ */
+int32_t decodeVerboseGCEventLog(const char *fileName, OMRPortLibrary *portLibrary, bool printRecords);
+
+#endif /* VERBOSEGCEVENTLOGDECODER_HPP_ */
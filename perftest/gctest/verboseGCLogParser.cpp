@@ -33,8 +33,11 @@
 #include "omrport.h"
 #include "omrthread.h"
 
+#include "verboseGCEventLogDecoder.hpp"
+
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
+const char* XPATH_GET_ALL_COMPACT_TIME = "/verbosegc/gc-op[@type='compact']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
@@ -43,7 +46,11 @@ const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
-int main(void)
+/**
+ * With no arguments, summarize the verbose GC logs (XML or binary event logs) left in the current directory by
+ * the perf tests, and delete them. With arguments, decode each binary event log given to JSON lines.
+ */
+int main(int argc, char **argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -66,6 +73,18 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
+	if (1 < argc) {
+		int32_t result = 0;
+		for (int i = 1; i < argc; i++) {
+			if (0 != decodeVerboseGCEventLog(argv[i], &portLibrary, true)) {
+				result = -1;
+			}
+		}
+		portLibrary.port_shutdown_library(&portLibrary);
+		omrthread_detach(NULL);
+		return result;
+	}
+
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
 	if(rcFile == (uintptr_t)-1) {
@@ -75,7 +94,11 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			if (isVerboseGCEventLog(resultBuffer, &portLibrary)) {
+				decodeVerboseGCEventLog(resultBuffer, &portLibrary, false);
+			} else {
+				analyze(resultBuffer, portLibrary);
+			}
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -107,11 +130,13 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
+	std::vector<double> compact_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
+	pugi::xpath_node_set compactTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
 
@@ -123,6 +148,10 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minSweep = 0;
 	double avgSweep = 0;
 
+	double maxCompact = 0;
+	double minCompact = 0;
+	double avgCompact = 0;
+
 	double maxExpand = 0;
 	double minExpand = 0;
 	double avgExpand = 0;
@@ -156,6 +185,13 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    sweep_values.push_back(value);
 	}
 
+	compactTimes = doc.select_nodes(XPATH_GET_ALL_COMPACT_TIME);
+	for (pugi::xpath_node_set::const_iterator it = compactTimes.begin(); it != compactTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("timems").as_double();
+	    compact_values.push_back(value);
+	}
+
 	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
 	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
@@ -182,6 +218,12 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgSweep = getAvg(sweep_values);
 	}
 
+	if (!compact_values.empty()) {
+		maxCompact = *std::max_element(compact_values.begin(), compact_values.end());
+		minCompact = *std::min_element(compact_values.begin(), compact_values.end());
+		avgCompact = getAvg(compact_values);
+	}
+
 	if (!expand_values.empty()) {
 		maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
 		minExpand = *std::min_element(expand_values.begin(), expand_values.end());
@@ -194,14 +236,14 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		avgGCDuration = getAvg(gcduration_values);
 	}
 
-	omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-	omrtty_printf("-------------------------------------------------------------------\n");
-	omrtty_printf("Max     : %f        %f        %f        %f\n",
-						maxMark, maxSweep, maxExpand, maxGCDuration);
+	omrtty_printf("            Mark           Sweep          Compact        Expand        GCDuration\n");
+	omrtty_printf("----------------------------------------------------------------------------------\n");
+	omrtty_printf("Max     : %f        %f        %f        %f        %f\n",
+						maxMark, maxSweep, maxCompact, maxExpand, maxGCDuration);
 
-	omrtty_printf("Min     : %f        %f        %f        %f\n",
-								minMark, minSweep, minExpand, minGCDuration);
+	omrtty_printf("Min     : %f        %f        %f        %f        %f\n",
+								minMark, minSweep, minCompact, minExpand, minGCDuration);
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
-								avgMark, avgSweep, avgExpand, avgGCDuration);
+	omrtty_printf("Average : %f        %f        %f        %f        %f\n\n",
+								avgMark, avgSweep, avgCompact, avgExpand, avgGCDuration);
 }
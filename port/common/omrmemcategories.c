@@ -33,6 +33,12 @@
  * Memory categories are used to break down native memory usage under
  * areas a language programmer would understand.
  */
+#if defined(LINUX)
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif /* !defined(_GNU_SOURCE) */
+#include <sched.h>
+#endif /* defined(LINUX) */
 #include <stdlib.h>
 #include <string.h>
 
@@ -59,6 +65,142 @@ OMRMEM_CATEGORY_1_CHILD("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY, OMRMEM_CAT
 OMRMEM_CATEGORY_NO_CHILDREN("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY);
 #endif /* OMR_ENV_DATA64 */
 
+/*
+ * The counters of most categories are sharded: each shard holds a pair of counters for every category
+ * which has claimed a slot, and allocations and frees update the shard of the CPU they run on (or, where
+ * the CPU cannot be found cheaply, of the thread's stack), so threads allocating at the same time do not
+ * contend for the same cache lines. The shards are only summed when the categories are walked.
+ *
+ * A category claims a slot the first time it is updated, and keeps it for the life of the process. The
+ * counters of a category which finds no free slot, and of every category while exact counters are
+ * enabled (OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS), are the liveBytes and liveAllocations fields of
+ * the category itself. A walk reports the sum of both, so the mode can be changed at any time.
+ *
+ * Categories are shared by every port library in the process, so their shards are too.
+ */
+#define OMRMEM_CATEGORY_SHARD_COUNT 32
+#define OMRMEM_CATEGORY_SHARD_SLOTS 128
+#define OMRMEM_CATEGORY_SHARD_PROBES 8
+
+typedef struct OMRMemCategoryCounters {
+	uintptr_t liveBytes;
+	uintptr_t liveAllocations;
+} OMRMemCategoryCounters;
+
+/* A whole number of cache lines, so CPUs updating different shards do not share lines */
+typedef struct OMRMemCategoryShard {
+	OMRMemCategoryCounters counters[OMRMEM_CATEGORY_SHARD_SLOTS];
+} OMRMemCategoryShard;
+
+static OMRMemCategoryShard categoryShards[OMRMEM_CATEGORY_SHARD_COUNT];
+static OMRMemCategory *volatile categoryShardSlotOwners[OMRMEM_CATEGORY_SHARD_SLOTS];
+static volatile uintptr_t exactCategoryCounters = 0;
+
+static void
+addToCounter(uintptr_t *counter, uintptr_t delta)
+{
+	uintptr_t oldValue;
+
+	do {
+		oldValue = *counter;
+	} while (compareAndSwapUDATA(counter, oldValue, oldValue + delta) != oldValue);
+}
+
+/**
+ * Find the shard slot of a category.
+ *
+ * @param category  [in]   The category
+ * @param claim     [in]   If TRUE, claim a free slot if the category has none
+ *
+ * @return the slot index, or -1 if the category has no slot
+ */
+static intptr_t
+findShardSlot(OMRMemCategory *category, BOOLEAN claim)
+{
+	uintptr_t slot = ((uintptr_t)category / sizeof(OMRMemCategory)) % OMRMEM_CATEGORY_SHARD_SLOTS;
+	uintptr_t probe = 0;
+
+	for (probe = 0; probe < OMRMEM_CATEGORY_SHARD_PROBES; probe++) {
+		OMRMemCategory *owner = categoryShardSlotOwners[slot];
+		if (owner == category) {
+			return (intptr_t)slot;
+		}
+		if (NULL == owner) {
+			if (!claim) {
+				/* slots are claimed in probe order and never released */
+				return -1;
+			}
+			owner = (OMRMemCategory *)compareAndSwapUDATA((uintptr_t *)&categoryShardSlotOwners[slot], 0, (uintptr_t)category);
+			if ((NULL == owner) || (owner == category)) {
+				return (intptr_t)slot;
+			}
+		}
+		slot = (slot + 1) % OMRMEM_CATEGORY_SHARD_SLOTS;
+	}
+	return -1;
+}
+
+/**
+ * Returns the counters the calling thread should update for a category, or NULL
+ * if it should update the category's own counters.
+ */
+static OMRMemCategoryCounters *
+shardCountersForCategory(OMRMemCategory *category)
+{
+	intptr_t slot = -1;
+	uintptr_t shard = 0;
+
+	if (0 != exactCategoryCounters) {
+		return NULL;
+	}
+	slot = findShardSlot(category, TRUE);
+	if (slot < 0) {
+		return NULL;
+	}
+#if defined(LINUX)
+	{
+		int cpu = sched_getcpu();
+		if (cpu >= 0) {
+			shard = (uintptr_t)cpu % OMRMEM_CATEGORY_SHARD_COUNT;
+		} else {
+			uintptr_t stackAddress = (uintptr_t)&cpu;
+			shard = ((stackAddress >> 16) ^ (stackAddress >> 21)) % OMRMEM_CATEGORY_SHARD_COUNT;
+		}
+	}
+#else /* defined(LINUX) */
+	{
+		/* thread stacks are far enough apart for the high bits of a stack address to identify the thread */
+		uintptr_t stackAddress = (uintptr_t)&slot;
+		shard = ((stackAddress >> 16) ^ (stackAddress >> 21)) % OMRMEM_CATEGORY_SHARD_COUNT;
+	}
+#endif /* defined(LINUX) */
+	return &categoryShards[shard].counters[slot];
+}
+
+/**
+ * Sums the counters of a category across its own counters and its shards.
+ *
+ * The shards are not read atomically with respect to each other, so a sum taken while the category is
+ * being updated can be briefly off by the allocations in flight. A sum which would be negative is reported as 0.
+ */
+static void
+sumCategoryCounters(OMRMemCategory *category, uintptr_t *liveBytes, uintptr_t *liveAllocations)
+{
+	uintptr_t bytes = category->liveBytes;
+	uintptr_t allocations = category->liveAllocations;
+	intptr_t slot = findShardSlot(category, FALSE);
+
+	if (slot >= 0) {
+		uintptr_t shard = 0;
+		for (shard = 0; shard < OMRMEM_CATEGORY_SHARD_COUNT; shard++) {
+			bytes += categoryShards[shard].counters[slot].liveBytes;
+			allocations += categoryShards[shard].counters[slot].liveAllocations;
+		}
+	}
+	*liveBytes = ((intptr_t)bytes < 0) ? 0 : bytes;
+	*liveAllocations = ((intptr_t)allocations < 0) ? 0 : allocations;
+}
+
 /**
  * Increments the counters for a memory category.
  *
@@ -67,16 +209,18 @@ OMRMEM_CATEGORY_NO_CHILDREN("Port Library", OMRMEM_CATEGORY_PORT_LIBRARY);
 void
 omrmem_categories_increment_counters(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
+	OMRMemCategoryCounters *counters = NULL;
 
 	Trc_Assert_PTR_mem_categories_increment_counters_NULL_category(NULL != category);
 
-	/* Increment block count */
-	do {
-		oldValue = category->liveAllocations;
-	} while (compareAndSwapUDATA(&category->liveAllocations, oldValue, oldValue + 1) != oldValue);
-
-	omrmem_categories_increment_bytes(category, size);
+	counters = shardCountersForCategory(category);
+	if (NULL != counters) {
+		addToCounter(&counters->liveAllocations, 1);
+		addToCounter(&counters->liveBytes, size);
+	} else {
+		addToCounter(&category->liveAllocations, 1);
+		addToCounter(&category->liveBytes, size);
+	}
 }
 
 /**
@@ -87,14 +231,12 @@ omrmem_categories_increment_counters(OMRMemCategory *category, uintptr_t size)
 void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
+	OMRMemCategoryCounters *counters = NULL;
 
 	Trc_Assert_PTR_mem_categories_increment_bytes_NULL_category(NULL != category);
 
-	/* Increment bytes */
-	do {
-		oldValue = category->liveBytes;
-	} while (compareAndSwapUDATA(&category->liveBytes, oldValue, oldValue + size) != oldValue);
+	counters = shardCountersForCategory(category);
+	addToCounter((NULL != counters) ? &counters->liveBytes : &category->liveBytes, size);
 }
 
 /**
@@ -105,16 +247,19 @@ omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size)
 void
 omrmem_categories_decrement_counters(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
+	OMRMemCategoryCounters *counters = NULL;
 
 	Trc_Assert_PTR_mem_categories_decrement_counters_NULL_category(NULL != category);
 
-	/* Decrement block count */
-	do {
-		oldValue = category->liveAllocations;
-	} while (compareAndSwapUDATA(&category->liveAllocations, oldValue, oldValue - 1) != oldValue);
-
-	omrmem_categories_decrement_bytes(category, size);
+	/* The block may have been counted on another shard: only the sum of the shards is meaningful */
+	counters = shardCountersForCategory(category);
+	if (NULL != counters) {
+		addToCounter(&counters->liveAllocations, (uintptr_t)-1);
+		addToCounter(&counters->liveBytes, 0 - size);
+	} else {
+		addToCounter(&category->liveAllocations, (uintptr_t)-1);
+		addToCounter(&category->liveBytes, 0 - size);
+	}
 }
 
 /**
@@ -125,14 +270,27 @@ omrmem_categories_decrement_counters(OMRMemCategory *category, uintptr_t size)
 void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size)
 {
-	uintptr_t oldValue;
+	OMRMemCategoryCounters *counters = NULL;
 
 	Trc_Assert_PTR_mem_categories_decrement_bytes_NULL_category(NULL != category);
 
-	/* Decrement size */
-	do {
-		oldValue = category->liveBytes;
-	} while (compareAndSwapUDATA(&category->liveBytes, oldValue, oldValue - size) != oldValue);
+	counters = shardCountersForCategory(category);
+	addToCounter((NULL != counters) ? &counters->liveBytes : &category->liveBytes, 0 - size);
+}
+
+/**
+ * Selects whether memory categories are counted exactly, in their own counters, or in sharded counters
+ * which are summed when the categories are walked.
+ *
+ * Exact counters make every allocation and free update the same cache lines, but the live counts of a
+ * category can be read straight from its OMRMemCategory, which can help when debugging.
+ *
+ * @param exact  [in]   1 for exact counters, 0 for sharded counters
+ */
+void
+omrmem_categories_set_exact_counters(uintptr_t exact)
+{
+	exactCategoryCounters = exact;
 }
 
 /**
@@ -186,11 +344,15 @@ _recursive_category_walk_children(struct OMRPortLibrary *portLibrary, OMRMemCate
 {
 	uint32_t i;
 	uintptr_t result;
+	uintptr_t liveBytes = 0;
+	uintptr_t liveAllocations = 0;
 
 	for (i = 0; i < parent->numberOfChildren; i++) {
 		uint32_t childCode = parent->children[i];
 		OMRMemCategory *child = omrmem_get_category(portLibrary, childCode);
-		result = state->walkFunction(child->categoryCode, child->name, child->liveBytes, child->liveAllocations, FALSE, parent->categoryCode, state);
+
+		sumCategoryCounters(child, &liveBytes, &liveAllocations);
+		result = state->walkFunction(child->categoryCode, child->name, liveBytes, liveAllocations, FALSE, parent->categoryCode, state);
 
 		if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 			result = _recursive_category_walk_children(portLibrary, state, child);
@@ -210,8 +372,11 @@ static uintptr_t
 _recursive_category_walk_root(struct OMRPortLibrary *portLibrary, OMRMemCategoryWalkState *state, OMRMemCategory *walkPoint)
 {
 	uintptr_t result;
+	uintptr_t liveBytes = 0;
+	uintptr_t liveAllocations = 0;
 
-	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, walkPoint->liveBytes, walkPoint->liveAllocations, TRUE, 0, state);
+	sumCategoryCounters(walkPoint, &liveBytes, &liveAllocations);
+	result = state->walkFunction(walkPoint->categoryCode, walkPoint->name, liveBytes, liveAllocations, TRUE, 0, state);
 
 	if (result == J9MEM_CATEGORIES_KEEP_ITERATING) {
 		return _recursive_category_walk_children(portLibrary, state, walkPoint);
@@ -0,0 +1,465 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Size class allocator for small blocks
+ */
+
+/*
+ * An optional allocator for the small blocks of omrmem_allocate_memory, enabled with
+ * OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR.
+ *
+ * Blocks are rounded up to one of SMALL_BLOCK_CLASS_COUNT size classes and carved from slabs of a single
+ * class, which are committed one at a time from an arena reserved with omrvmem. Each attached thread keeps
+ * a cache of free blocks per class, so most allocations and frees touch only the thread's own cache. Caches
+ * are refilled from, and overflow into, the central free lists in batches under the allocator's lock.
+ * Threads which are not attached use the central free lists directly.
+ *
+ * The blocks are wrapped with tags in omrmemtag.c just like the blocks of omrmem_allocate_memory_basic, and
+ * the link of a free block is kept after its header tag, so a freed block still has a freed header.
+ * Blocks are recognised by their address, so blocks can be freed after the allocator is disabled, and
+ * blocks allocated before it was enabled are freed as before. Blocks which do not fit a class, or do not
+ * fit in the arena, are allocated with omrmem_allocate_memory_basic.
+ */
+#include <string.h>
+
+#include "omrmemsmallblocks.h"
+#include "omrport.h"
+#include "omrportpg.h"
+#include "omrutilbase.h"
+
+#define SMALL_BLOCK_GRANULE_SHIFT 4
+#define SMALL_BLOCK_MAX_SIZE 1024
+#define SMALL_BLOCK_CLASS_COUNT 17
+#define SMALL_BLOCK_SLAB_SIZE (64 * 1024)
+/* most free blocks of a class a thread cache keeps */
+#define SMALL_BLOCK_CACHE_LIMIT 64
+/* number of blocks moved between a thread cache and the central free lists at once */
+#define SMALL_BLOCK_BATCH 32
+
+#if defined(OMR_ENV_DATA64)
+#define SMALL_BLOCK_ARENA_SIZE ((uintptr_t)1024 * 1024 * 1024)
+#else /* defined(OMR_ENV_DATA64) */
+#define SMALL_BLOCK_ARENA_SIZE ((uintptr_t)64 * 1024 * 1024)
+#endif /* defined(OMR_ENV_DATA64) */
+
+#define VMEM_MODE_WITHOUT_COMMIT OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE
+
+/* Block sizes include the tags, and are multiples of 16 so blocks are as aligned as malloc'd memory */
+static const uintptr_t smallBlockClassSizes[SMALL_BLOCK_CLASS_COUNT] = {
+	32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512, 768, 1024
+};
+
+/* The link of a free block, which follows its header tag */
+typedef struct OMRSmallBlock {
+	struct OMRSmallBlock *next;
+} OMRSmallBlock;
+
+#define BLOCK_FROM_MEMORY(memoryPointer) ((OMRSmallBlock *)((uint8_t *)(memoryPointer) + sizeof(J9MemTag)))
+#define MEMORY_FROM_BLOCK(block) ((void *)((uint8_t *)(block) - sizeof(J9MemTag)))
+
+typedef struct OMRSmallBlockCache {
+	struct OMRSmallBlockCache *next;
+	struct OMRSmallBlockCache *previous;
+	struct OMRSmallBlockAllocator *allocator;
+	OMRSmallBlock *freeBlocks[SMALL_BLOCK_CLASS_COUNT];
+	uintptr_t freeCount[SMALL_BLOCK_CLASS_COUNT];
+} OMRSmallBlockCache;
+
+typedef struct OMRSmallBlockAllocator {
+	struct OMRPortLibrary *portLibrary;
+	volatile uintptr_t enabled;
+	uint8_t *arenaBase;
+	uint8_t *arenaTop;
+	uint8_t *slabTop; /* first slab of the arena which has not been committed */
+	uintptr_t slabSize;
+	uint8_t *slabClasses; /* size class of each committed slab */
+	J9PortVmemIdentifier vmemID;
+	omrthread_tls_key_t cacheKey;
+	MUTEX lock; /* protects the central free lists, the slabs and the list of caches */
+	OMRSmallBlockCache *caches;
+	OMRSmallBlock *freeBlocks[SMALL_BLOCK_CLASS_COUNT];
+	uint8_t *carveCursor[SMALL_BLOCK_CLASS_COUNT];
+	uint8_t *carveLimit[SMALL_BLOCK_CLASS_COUNT];
+	uint8_t sizeClassIndex[(SMALL_BLOCK_MAX_SIZE >> SMALL_BLOCK_GRANULE_SHIFT) + 1];
+} OMRSmallBlockAllocator;
+
+static OMRSmallBlockAllocator *createAllocator(struct OMRPortLibrary *portLibrary);
+static void destroyAllocator(struct OMRPortLibrary *portLibrary, OMRSmallBlockAllocator *allocator);
+static OMRSmallBlock *takeCentralBlock(OMRSmallBlockAllocator *allocator, uintptr_t classIndex);
+static OMRSmallBlockCache *cacheForCurrentThread(OMRSmallBlockAllocator *allocator);
+static void J9THREAD_PROC flushThreadCache(void *entry);
+
+static OMRSmallBlockAllocator *
+createAllocator(struct OMRPortLibrary *portLibrary)
+{
+	OMRSmallBlockAllocator *allocator = NULL;
+	uintptr_t pageSize = portLibrary->vmem_supported_page_sizes(portLibrary)[0];
+	uintptr_t classIndex = 0;
+	uintptr_t granule = 0;
+
+	if (0 == pageSize) {
+		return NULL;
+	}
+
+	allocator = omrmem_allocate_memory_basic(portLibrary, sizeof(OMRSmallBlockAllocator));
+	if (NULL == allocator) {
+		return NULL;
+	}
+	memset(allocator, 0, sizeof(OMRSmallBlockAllocator));
+	allocator->portLibrary = portLibrary;
+	allocator->slabSize = OMR_MAX(SMALL_BLOCK_SLAB_SIZE, pageSize);
+
+	allocator->slabClasses = omrmem_allocate_memory_basic(portLibrary, SMALL_BLOCK_ARENA_SIZE / allocator->slabSize);
+	if (NULL == allocator->slabClasses) {
+		omrmem_free_memory_basic(portLibrary, allocator);
+		return NULL;
+	}
+
+	if (!MUTEX_INIT(allocator->lock)) {
+		omrmem_free_memory_basic(portLibrary, allocator->slabClasses);
+		omrmem_free_memory_basic(portLibrary, allocator);
+		return NULL;
+	}
+
+	if (0 != omrthread_tls_alloc_with_finalizer(&allocator->cacheKey, flushThreadCache)) {
+		MUTEX_DESTROY(allocator->lock);
+		omrmem_free_memory_basic(portLibrary, allocator->slabClasses);
+		omrmem_free_memory_basic(portLibrary, allocator);
+		return NULL;
+	}
+
+	allocator->arenaBase = portLibrary->vmem_reserve_memory(portLibrary, NULL, SMALL_BLOCK_ARENA_SIZE, &allocator->vmemID, VMEM_MODE_WITHOUT_COMMIT, pageSize, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == allocator->arenaBase) {
+		omrthread_tls_free(allocator->cacheKey);
+		MUTEX_DESTROY(allocator->lock);
+		omrmem_free_memory_basic(portLibrary, allocator->slabClasses);
+		omrmem_free_memory_basic(portLibrary, allocator);
+		return NULL;
+	}
+	/* omrmem category double-accounting prevention: the blocks are counted in their own categories in omrmemtag.c */
+	omrmem_categories_decrement_counters(allocator->vmemID.category, allocator->vmemID.size);
+
+	allocator->arenaTop = allocator->arenaBase + SMALL_BLOCK_ARENA_SIZE;
+	allocator->slabTop = allocator->arenaBase;
+
+	for (granule = 0; granule <= (SMALL_BLOCK_MAX_SIZE >> SMALL_BLOCK_GRANULE_SHIFT); granule++) {
+		while (smallBlockClassSizes[classIndex] < (granule << SMALL_BLOCK_GRANULE_SHIFT)) {
+			classIndex += 1;
+		}
+		allocator->sizeClassIndex[granule] = (uint8_t)classIndex;
+	}
+
+	return allocator;
+}
+
+static void
+destroyAllocator(struct OMRPortLibrary *portLibrary, OMRSmallBlockAllocator *allocator)
+{
+	OMRSmallBlockCache *cache = NULL;
+
+	/* clears the caches of every thread, without calling the finalizer */
+	omrthread_tls_free(allocator->cacheKey);
+
+	cache = allocator->caches;
+	while (NULL != cache) {
+		OMRSmallBlockCache *next = cache->next;
+		omrmem_free_memory_basic(portLibrary, cache);
+		cache = next;
+	}
+
+	/* count the arena again, as vmem_free_memory decrements it */
+	omrmem_categories_increment_counters(allocator->vmemID.category, allocator->vmemID.size);
+	portLibrary->vmem_free_memory(portLibrary, allocator->vmemID.address, allocator->vmemID.size, &allocator->vmemID);
+
+	MUTEX_DESTROY(allocator->lock);
+	omrmem_free_memory_basic(portLibrary, allocator->slabClasses);
+	omrmem_free_memory_basic(portLibrary, allocator);
+}
+
+/**
+ * Take a free block of a class from the central free lists, carving a new slab if there is none.
+ * The allocator's lock must be held.
+ *
+ * @return the block, or NULL if the arena is exhausted or a slab could not be committed
+ */
+static OMRSmallBlock *
+takeCentralBlock(OMRSmallBlockAllocator *allocator, uintptr_t classIndex)
+{
+	OMRSmallBlock *block = allocator->freeBlocks[classIndex];
+	uintptr_t blockSize = smallBlockClassSizes[classIndex];
+
+	if (NULL != block) {
+		allocator->freeBlocks[classIndex] = block->next;
+		return block;
+	}
+
+	if ((uintptr_t)(allocator->carveLimit[classIndex] - allocator->carveCursor[classIndex]) < blockSize) {
+		/* the rest of the current slab is too small for a block: start a new one */
+		struct OMRPortLibrary *portLibrary = allocator->portLibrary;
+		uint8_t *slab = allocator->slabTop;
+
+		if ((uintptr_t)(allocator->arenaTop - slab) < allocator->slabSize) {
+			return NULL;
+		}
+		if (NULL == portLibrary->vmem_commit_memory(portLibrary, slab, allocator->slabSize, &allocator->vmemID)) {
+			return NULL;
+		}
+		allocator->slabClasses[(slab - allocator->arenaBase) / allocator->slabSize] = (uint8_t)classIndex;
+		allocator->slabTop = slab + allocator->slabSize;
+		allocator->carveCursor[classIndex] = slab;
+		allocator->carveLimit[classIndex] = slab + allocator->slabSize;
+	}
+
+	block = BLOCK_FROM_MEMORY(allocator->carveCursor[classIndex]);
+	allocator->carveCursor[classIndex] += blockSize;
+	return block;
+}
+
+/**
+ * Returns the cache of the current thread, creating it if need be.
+ *
+ * @return the cache, or NULL if the thread is not attached or the cache could not be created
+ */
+static OMRSmallBlockCache *
+cacheForCurrentThread(OMRSmallBlockAllocator *allocator)
+{
+	omrthread_t self = omrthread_self();
+	OMRSmallBlockCache *cache = NULL;
+
+	if (NULL != self) {
+		cache = omrthread_tls_get(self, allocator->cacheKey);
+		if (NULL == cache) {
+			/* not allocated with omrmem_allocate_memory, which would come back here */
+			cache = omrmem_allocate_memory_basic(allocator->portLibrary, sizeof(OMRSmallBlockCache));
+			if (NULL != cache) {
+				memset(cache, 0, sizeof(OMRSmallBlockCache));
+				cache->allocator = allocator;
+				if (0 != omrthread_tls_set(self, allocator->cacheKey, cache)) {
+					omrmem_free_memory_basic(allocator->portLibrary, cache);
+					return NULL;
+				}
+				MUTEX_ENTER(allocator->lock);
+				cache->next = allocator->caches;
+				if (NULL != allocator->caches) {
+					allocator->caches->previous = cache;
+				}
+				allocator->caches = cache;
+				MUTEX_EXIT(allocator->lock);
+			}
+		}
+	}
+	return cache;
+}
+
+/**
+ * TLS finalizer: return the blocks of an exiting thread's cache to the central free lists and free the cache.
+ */
+static void J9THREAD_PROC
+flushThreadCache(void *entry)
+{
+	OMRSmallBlockCache *cache = (OMRSmallBlockCache *)entry;
+	OMRSmallBlockAllocator *allocator = cache->allocator;
+	uintptr_t classIndex = 0;
+
+	MUTEX_ENTER(allocator->lock);
+	for (classIndex = 0; classIndex < SMALL_BLOCK_CLASS_COUNT; classIndex++) {
+		OMRSmallBlock *block = cache->freeBlocks[classIndex];
+		while (NULL != block) {
+			OMRSmallBlock *next = block->next;
+			block->next = allocator->freeBlocks[classIndex];
+			allocator->freeBlocks[classIndex] = block;
+			block = next;
+		}
+	}
+	if (NULL != cache->next) {
+		cache->next->previous = cache->previous;
+	}
+	if (allocator->caches == cache) {
+		allocator->caches = cache->next;
+	} else if (NULL != cache->previous) {
+		cache->previous->next = cache->next;
+	}
+	MUTEX_EXIT(allocator->lock);
+
+	omrmem_free_memory_basic(allocator->portLibrary, cache);
+}
+
+/**
+ * Enable or disable the small block allocator. The allocator is created the first time it is enabled.
+ * Once disabled, no new small blocks are allocated, but the blocks already allocated can still be freed.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] enable 1 to enable the allocator, 0 to disable it
+ *
+ * @return 0 on success, 1 if the allocator could not be created
+ */
+int32_t
+enable_small_blocks(struct OMRPortLibrary *portLibrary, uintptr_t enable)
+{
+	OMRSmallBlockAllocator *allocator = portLibrary->portGlobals->smallBlockAllocator;
+
+	if (NULL == allocator) {
+		OMRSmallBlockAllocator *existing = NULL;
+
+		if (0 == enable) {
+			return 0;
+		}
+		allocator = createAllocator(portLibrary);
+		if (NULL == allocator) {
+			return 1;
+		}
+		/* the allocator must be complete before other threads can see it */
+		issueWriteBarrier();
+		existing = (OMRSmallBlockAllocator *)compareAndSwapUDATA((uintptr_t *)&portLibrary->portGlobals->smallBlockAllocator, 0, (uintptr_t)allocator);
+		if (NULL != existing) {
+			/* another thread enabled the allocator first */
+			destroyAllocator(portLibrary, allocator);
+			allocator = existing;
+		}
+	}
+	allocator->enabled = enable;
+	return 0;
+}
+
+/**
+ * Free the small block allocator and its arena. Any small blocks still allocated are freed with it.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+shutdown_small_blocks(struct OMRPortLibrary *portLibrary)
+{
+	OMRSmallBlockAllocator *allocator = portLibrary->portGlobals->smallBlockAllocator;
+
+	if (NULL != allocator) {
+		portLibrary->portGlobals->smallBlockAllocator = NULL;
+		destroyAllocator(portLibrary, allocator);
+	}
+}
+
+/**
+ * Allocate a small block.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] byteAmount Number of bytes to allocate, including the tags
+ *
+ * @return the block, or NULL if the allocator is not enabled, the block is too large for the allocator,
+ * or it has run out of memory
+ */
+void *
+allocate_small_block(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount)
+{
+	OMRSmallBlockAllocator *allocator = portLibrary->portGlobals->smallBlockAllocator;
+	OMRSmallBlock *block = NULL;
+
+	if ((NULL != allocator) && (0 != allocator->enabled) && (byteAmount <= SMALL_BLOCK_MAX_SIZE)) {
+		uintptr_t classIndex = allocator->sizeClassIndex[(byteAmount + (1 << SMALL_BLOCK_GRANULE_SHIFT) - 1) >> SMALL_BLOCK_GRANULE_SHIFT];
+		OMRSmallBlockCache *cache = cacheForCurrentThread(allocator);
+
+		if (NULL != cache) {
+			if (NULL == cache->freeBlocks[classIndex]) {
+				uintptr_t refilled = 0;
+
+				MUTEX_ENTER(allocator->lock);
+				for (refilled = 0; refilled < SMALL_BLOCK_BATCH; refilled++) {
+					OMRSmallBlock *refill = takeCentralBlock(allocator, classIndex);
+					if (NULL == refill) {
+						break;
+					}
+					refill->next = cache->freeBlocks[classIndex];
+					cache->freeBlocks[classIndex] = refill;
+				}
+				MUTEX_EXIT(allocator->lock);
+				cache->freeCount[classIndex] = refilled;
+			}
+			block = cache->freeBlocks[classIndex];
+			if (NULL != block) {
+				cache->freeBlocks[classIndex] = block->next;
+				cache->freeCount[classIndex] -= 1;
+			}
+		} else {
+			MUTEX_ENTER(allocator->lock);
+			block = takeCentralBlock(allocator, classIndex);
+			MUTEX_EXIT(allocator->lock);
+		}
+	}
+
+	return (NULL == block) ? NULL : MEMORY_FROM_BLOCK(block);
+}
+
+/**
+ * Answer whether a block was allocated by allocate_small_block.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] memoryPointer The block, including its header tag
+ */
+BOOLEAN
+is_small_block(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	OMRSmallBlockAllocator *allocator = portLibrary->portGlobals->smallBlockAllocator;
+
+	return (NULL != allocator)
+		&& ((uint8_t *)memoryPointer >= allocator->arenaBase)
+		&& ((uint8_t *)memoryPointer < allocator->arenaTop);
+}
+
+/**
+ * Free a block allocated by allocate_small_block.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] memoryPointer The block, including its header tag
+ */
+void
+free_small_block(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+{
+	OMRSmallBlockAllocator *allocator = portLibrary->portGlobals->smallBlockAllocator;
+	uintptr_t classIndex = allocator->slabClasses[((uint8_t *)memoryPointer - allocator->arenaBase) / allocator->slabSize];
+	OMRSmallBlock *block = BLOCK_FROM_MEMORY(memoryPointer);
+	OMRSmallBlockCache *cache = cacheForCurrentThread(allocator);
+
+	if (NULL != cache) {
+		block->next = cache->freeBlocks[classIndex];
+		cache->freeBlocks[classIndex] = block;
+		cache->freeCount[classIndex] += 1;
+		if (cache->freeCount[classIndex] > SMALL_BLOCK_CACHE_LIMIT) {
+			uintptr_t flushed = 0;
+
+			MUTEX_ENTER(allocator->lock);
+			for (flushed = 0; flushed < SMALL_BLOCK_BATCH; flushed++) {
+				block = cache->freeBlocks[classIndex];
+				cache->freeBlocks[classIndex] = block->next;
+				block->next = allocator->freeBlocks[classIndex];
+				allocator->freeBlocks[classIndex] = block;
+			}
+			MUTEX_EXIT(allocator->lock);
+			cache->freeCount[classIndex] -= SMALL_BLOCK_BATCH;
+		}
+	} else {
+		MUTEX_ENTER(allocator->lock);
+		block->next = allocator->freeBlocks[classIndex];
+		allocator->freeBlocks[classIndex] = block;
+		MUTEX_EXIT(allocator->lock);
+	}
+}
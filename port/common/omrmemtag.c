@@ -53,6 +53,7 @@
 #include "omrmem32helpers.h"
 #endif /* (OMR_ENV_DATA64) */
 
+#include "omrmemsmallblocks.h"
 #include "omrmemtag_checks.h"
 
 static void setTagSumCheck(J9MemTag *tag, uint32_t eyeCatcher);
@@ -177,7 +178,10 @@ omrmem_allocate_memory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount,
 	Trc_PRT_mem_omrmem_allocate_memory_Entry(byteAmount, callSite);
 	allocationByteAmount = ROUNDED_BYTE_AMOUNT(byteAmount);
 
-	pointer = allocateFunction(portLibrary, allocationByteAmount);
+	pointer = allocate_small_block(portLibrary, allocationByteAmount);
+	if (NULL == pointer) {
+		pointer = allocateFunction(portLibrary, allocationByteAmount);
+	}
 	if (NULL == pointer) {
 		Trc_PRT_memory_alloc_returned_null_2(callSite, allocationByteAmount);
 	} else {
@@ -203,7 +207,11 @@ omrmem_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 
 	if (memoryPointer != NULL) {
 		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
-		freeFunction(portLibrary, memoryPointer);
+		if (is_small_block(portLibrary, memoryPointer)) {
+			free_small_block(portLibrary, memoryPointer);
+		} else {
+			freeFunction(portLibrary, memoryPointer);
+		}
 	}
 	Trc_PRT_mem_omrmem_free_memory_Exit();
 }
@@ -239,7 +247,11 @@ omrmem_advise_and_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPo
 		}
 #endif /* (defined(LINUX) || defined (AIXPPC) || defined(J9ZOS390) || defined(OSX)) */
 		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
-		adviseAndFreeFunction(portLibrary, memoryPointer, memorySize);
+		if (is_small_block(portLibrary, memoryPointer)) {
+			free_small_block(portLibrary, memoryPointer);
+		} else {
+			adviseAndFreeFunction(portLibrary, memoryPointer, memorySize);
+		}
 	}
 	Trc_PRT_mem_omrmem_advise_and_free_memory_Exit();
 }
@@ -291,7 +303,19 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 		}
 		allocationByteAmount = ROUNDED_BYTE_AMOUNT(byteAmount);
 
-		pointer = reallocateFunction(portLibrary, memoryPointer, allocationByteAmount);
+		if (is_small_block(portLibrary, memoryPointer)) {
+			/* small blocks cannot grow in place: move the header and the data which fits to a new block */
+			pointer = allocate_small_block(portLibrary, allocationByteAmount);
+			if (NULL == pointer) {
+				pointer = omrmem_allocate_memory_basic(portLibrary, allocationByteAmount);
+			}
+			if (NULL != pointer) {
+				memcpy(pointer, memoryPointer, sizeof(J9MemTag) + OMR_MIN(((J9MemTag *)memoryPointer)->allocSize, byteAmount));
+				free_small_block(portLibrary, memoryPointer);
+			}
+		} else {
+			pointer = reallocateFunction(portLibrary, memoryPointer, allocationByteAmount);
+		}
 		if (NULL != pointer) {
 			pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category);
 		}
@@ -326,6 +350,8 @@ omrmem_shutdown(struct OMRPortLibrary *portLibrary)
 #endif /* OMR_ENV_DATA64 */
 
 	if (NULL != portLibrary->portGlobals) {
+		/* last, as the blocks freed above may be small blocks */
+		shutdown_small_blocks(portLibrary);
 		omrmem_shutdown_basic(portLibrary);
 		portLibrary->portGlobals = NULL;
 	}
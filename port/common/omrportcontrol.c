@@ -23,6 +23,7 @@
 #include <string.h>
 #include "omrport.h"
 #include "omrportpriv.h"
+#include "omrmemsmallblocks.h"
 #if defined(OMR_PORT_ZOS_CEEHDLRSUPPORT)
 #include <leawi.h>
 #include "omrsignal_ceehdlr.h"
@@ -265,6 +266,23 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 		}
 	}
 
+	/* Memory category counters are shared by every port library, so this affects them all */
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_CATEGORIES_EXACT_COUNTERS, key)) {
+		Assert_PRT_true((0 == value) || (1 == value));
+		omrmem_categories_set_exact_counters(value);
+		return 0;
+	}
+
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATOR, key)) {
+		Assert_PRT_true((0 == value) || (1 == value));
+		return enable_small_blocks(portLibrary, value);
+	}
+
+	/* value is memory returned by omrmem_allocate_memory: answer 1 if the small block allocator served it */
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_SMALL_BLOCK_ALLOCATED, key)) {
+		return ((0 != value) && is_small_block(portLibrary, (void *)value)) ? 1 : 0;
+	}
+
 #if defined(AIXPPC)
 	/* OMRPORT_CTLDATA_AIX_PROC_ATTR key is used only on AIX systems */
 	if (0 == strcmp(OMRPORT_CTLDATA_AIX_PROC_ATTR, key)) {
@@ -132,6 +132,7 @@ typedef struct OMRPortLibraryGlobalData {
 	J9CudaGlobalData cudaGlobals;
 #endif /* OMR_OPT_CUDA */
 	uintptr_t vmemEnableMadvise;					/* madvise to use Transparent HugePage (THP) for Virtual memory allocated by mmap */
+	struct OMRSmallBlockAllocator *smallBlockAllocator;	/* Size class allocator for small blocks, NULL until enabled */
 	J9SysinfoCPUTime oldestCPUTime;
 	J9SysinfoCPUTime latestCPUTime;
 } OMRPortLibraryGlobalData;
@@ -372,6 +373,8 @@ extern J9_CFUNC void
 omrmem_categories_increment_bytes(OMRMemCategory *category, uintptr_t size);
 extern J9_CFUNC void
 omrmem_categories_decrement_bytes(OMRMemCategory *category, uintptr_t size);
+extern J9_CFUNC void
+omrmem_categories_set_exact_counters(uintptr_t exact);
 
 /* J9SourceJ9MemoryMap*/
 extern J9_CFUNC void
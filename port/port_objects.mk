@@ -132,6 +132,7 @@ OBJECTS += omrheap
 OBJECTS += omrmem
 OBJECTS += omrmemtag
 OBJECTS += omrmemcategories
+OBJECTS += omrmemsmallblocks
 OBJECTS += omrport
 OBJECTS += omrmmap
 OBJECTS += j9nls
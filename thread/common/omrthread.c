@@ -74,9 +74,9 @@ static intptr_t monitor_notify_original(omrthread_t self, omrthread_monitor_t mo
 
 #if defined(OMR_THR_THREE_TIER_LOCKING)
 static intptr_t init_spinCounts(omrthread_library_t lib);
-#if !defined(OMR_THR_MCS_LOCKS)
+#if !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor);
-#endif /* !defined(OMR_THR_MCS_LOCKS) */
+#endif /* !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
 static intptr_t init_threadParam(char *name, uintptr_t *pDefault);
@@ -2931,6 +2931,12 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	/* Blocked threads are parked on the monitor rather than waiting on their condition. Wake them all,
+	 * the others will park again.
+	 */
+	omrthread_futex_unpark(monitor, TRUE);
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -2951,6 +2957,7 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 		omrthread_monitor_unpin(monitor, self);
 	}
 	MONITOR_UNLOCK(monitor);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 }
 #endif /* OMR_THR_THREE_TIER_LOCKING */
 
@@ -3759,6 +3766,9 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	monitor->spinThreads = 0;
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	monitor->parkSequence = 0;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 	ASSERT(monitor->spinCount1 != 0);
 	ASSERT(monitor->spinCount2 != 0);
@@ -3995,6 +4005,9 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 #if defined(OMR_THR_MCS_LOCKS)
 	omrthread_mcs_node_t mcsNode = omrthread_mcs_node_allocate(self);
 #endif /* defined(OMR_THR_MCS_LOCKS) */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	uint32_t parkSequence = 0;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	ASSERT(self);
 	ASSERT(monitor);
 	ASSERT(monitor->spinCount1 != 0);
@@ -4012,10 +4025,78 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		{
 			monitor->owner = self;
 			monitor->count = 1;
+#if defined(OMR_THR_FUTEX_MONITORS)
+			if (0 != blockedCount) {
+				/* Acquiring the spinlock replaced EXCEEDED. Other threads may still be parked,
+				 * so put it back to make our exit wake one of them.
+				 */
+				omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED);
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 			ASSERT(monitor->spinlockState != J9THREAD_MONITOR_SPINLOCK_UNOWNED);
 			break;
 		}
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+		/*
+		 * Park on the monitor rather than block on its mutex. The monitor's mutex is not held, so
+		 * read the park sequence first: an exit or abort after this point changes it, and the park
+		 * returns at once rather than miss the wake up.
+		 */
+		parkSequence = omrthread_futex_park_sequence(monitor);
+		if (J9THREAD_MONITOR_SPINLOCK_UNOWNED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+			monitor->owner = self;
+			monitor->count = 1;
+			break;
+		}
+
+		blockedCount++;
+
+		THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+		/*
+		 * Check for abort before parking.
+		 * Catches aborts that occur before we start waiting.
+		 */
+		if ((SET_ABORTABLE == isAbortable) && OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_ABORTED)) {
+			self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+			self->monitor = 0;
+			THREAD_UNLOCK(self);
+			return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+		}
+		if (SET_ABORTABLE == isAbortable) {
+			self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+		} else {
+			self->flags |= J9THREAD_FLAG_BLOCKED;
+		}
+		self->monitor = monitor;
+		THREAD_UNLOCK(self);
+
+		/* Parked threads stay on the blocking queue so the monitor can still be introspected */
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
+		threadEnqueue(&monitor->blocking, self);
+		MONITOR_UNLOCK(monitor);
+
+		omrthread_futex_park(monitor, parkSequence);
+
+		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
+		threadDequeue(&monitor->blocking, self);
+		MONITOR_UNLOCK(monitor);
+
+		/*
+		 * Check for abort upon waking.
+		 * If aborted, we shouldn't continue to contend for the monitor.
+		 */
+		if (SET_ABORTABLE == isAbortable) {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER4);
+			if (OMR_ARE_ANY_BITS_SET(self->flags, J9THREAD_FLAG_ABORTED)) {
+				self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = 0;
+				THREAD_UNLOCK(self);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			THREAD_UNLOCK(self);
+		}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
 #if !defined(OMR_THR_MCS_LOCKS)
@@ -4093,6 +4174,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 		}
 
 		MONITOR_UNLOCK(monitor);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	}
 
 	/* We now own the monitor */
@@ -4128,7 +4210,7 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 
 
-#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+#if defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS)
 /**
  * Notify all threads blocked on the monitor's mutex, waiting
  * to be told that it's ok to try again to get the spinlock.
@@ -4164,7 +4246,7 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 	}
 }
 
-#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+#endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) && !defined(OMR_THR_FUTEX_MONITORS) */
 
 
 
@@ -4368,6 +4450,11 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 			NOTIFY_WRAPPER(nextThread);
 		}
 		MONITOR_UNLOCK(monitor);
+#elif defined(OMR_THR_FUTEX_MONITORS)
+		/* EXCEEDED means a thread may be parked, and only then is the exit more than a single swap */
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			omrthread_futex_unpark(monitor, FALSE);
+		}
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
@@ -4636,6 +4723,10 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 	if (NULL != nextThread) {
 		NOTIFY_WRAPPER(nextThread);
 	}
+#elif defined(OMR_THR_FUTEX_MONITORS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_unpark(monitor, FALSE);
+	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
@@ -4904,6 +4995,10 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	if (NULL != nextThread) {
 		NOTIFY_WRAPPER(nextThread);
 	}
+#elif defined(OMR_THR_FUTEX_MONITORS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		omrthread_futex_unpark(monitor, FALSE);
+	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
@@ -5264,6 +5359,10 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 				queue->flags &= ~J9THREAD_FLAG_WAITING;
 				queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 				Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+#if defined(OMR_THR_FUTEX_MONITORS)
+				/* exits only wake parked threads, so wake the notified thread to contend for the monitor */
+				NOTIFY_WRAPPER(queue);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 				THREAD_UNLOCK(queue);
 
 				queue = queue->next;
@@ -5289,6 +5388,9 @@ monitor_notify_three_tier(omrthread_t self, omrthread_monitor_t monitor, int not
 			queue->flags &= ~J9THREAD_FLAG_WAITING;
 			queue->flags |= J9THREAD_FLAG_BLOCKED | J9THREAD_FLAG_NOTIFIED;
 			Trc_THR_ThreadMonitorNotifyThreadNotified(self, queue, monitor);
+#if defined(OMR_THR_FUTEX_MONITORS)
+			NOTIFY_WRAPPER(queue);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 			THREAD_UNLOCK(queue);
 
 			threadDequeue(&monitor->waiting, queue);
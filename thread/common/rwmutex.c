@@ -22,16 +22,40 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/*
+ * A mutex created with J9THREAD_RWMUTEX_SCALABLE_READERS has a table of reader slots, each in a cache line
+ * of its own. A reader claims a free slot near the hash of its thread, so readers on different CPUs write
+ * to different cache lines and never enter syncMon unless a writer is pending. A writer sets writerPending
+ * and then waits for every slot to be released, and readers which do not already hold the mutex back off
+ * while writerPending is set, so a stream of readers cannot starve a writer. Readers which find no free
+ * slot near their hash fall back to counting themselves in status under syncMon.
+ */
+#define RWMUTEX_READER_SLOTS 128
+#define RWMUTEX_READER_SLOT_PROBES 8
+#define RWMUTEX_CACHE_LINE_SIZE 64
+
+typedef struct RWMutexReaderSlot {
+	volatile uintptr_t owner; /* thread holding the mutex for read through this slot, 0 if free */
+	uintptr_t count; /* recursion count of the owner, only touched by the owner */
+	uint8_t padding[RWMUTEX_CACHE_LINE_SIZE - (2 * sizeof(uintptr_t))];
+} RWMutexReaderSlot;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	volatile uintptr_t writerPending;
+	RWMutexReaderSlot *readerSlots;
+	void *readerSlotsMemory;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -41,12 +65,23 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_IDLE(m)     ((m)->status == 0)
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
+#define RWMUTEX_SCALABLE(m)        (0 != ((m)->flags & J9THREAD_RWMUTEX_SCALABLE_READERS))
+
+static uintptr_t readerSlotIndex(omrthread_t self);
+static RWMutexReaderSlot *findReaderSlot(RWMutex *mutex, omrthread_t self);
+static RWMutexReaderSlot *claimReaderSlot(RWMutex *mutex, omrthread_t self);
+static void releaseReaderSlot(RWMutex *mutex, RWMutexReaderSlot *slot);
+static BOOLEAN readerSlotsInUse(RWMutex *mutex);
+static intptr_t enterReadScalable(RWMutex *mutex, omrthread_t self);
+static intptr_t exitReadScalable(RWMutex *mutex, omrthread_t self);
+static intptr_t enterWriteScalable(RWMutex *mutex, omrthread_t self, BOOLEAN tryEnter);
 
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
- * @param[in] flags initial flag values for the mutex
+ * @param[in] flags initial flag values for the mutex. J9THREAD_RWMUTEX_SCALABLE_READERS creates a mutex
+ * whose readers do not contend with each other, and whose pending writers hold off new readers.
  * @return J9THREAD_RWMUTEX_OK on success
  *
  * @see omrthread_rwmutex_destroy
@@ -69,9 +104,31 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 	if (NULL == mutex) {
 		ret = J9THREAD_RWMUTEX_FAIL;
 	} else {
-		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
+		mutex->flags = flags;
+		mutex->writerPending = 0;
+		mutex->readerSlots = NULL;
+		mutex->readerSlotsMemory = NULL;
+
+		if (RWMUTEX_SCALABLE(mutex)) {
+			uintptr_t slotsSize = RWMUTEX_READER_SLOTS * sizeof(RWMutexReaderSlot);
+			mutex->readerSlotsMemory = omrthread_allocate_memory(lib, slotsSize + RWMUTEX_CACHE_LINE_SIZE, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->readerSlotsMemory) {
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			mutex->readerSlots = (RWMutexReaderSlot *)(((uintptr_t)mutex->readerSlotsMemory + RWMUTEX_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(RWMUTEX_CACHE_LINE_SIZE - 1));
+			memset(mutex->readerSlots, 0, slotsSize);
+		}
+
+		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 
 		ASSERT(handle);
 		*handle = mutex;
@@ -103,6 +160,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->readerSlotsMemory) {
+		omrthread_free_memory(lib, mutex->readerSlotsMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -134,6 +194,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
  * However, a thread with read access MUST NOT
  * ask for write access on the same mutex.
  *
+ * If the mutex was created with J9THREAD_RWMUTEX_SCALABLE_READERS, a thread
+ * which does not already hold the mutex blocks while a writer is waiting.
+ *
  * @param[in] mutex a mutex to be entered for read access
  * @return J9THREAD_RWMUTEX_OK on success
  *
@@ -142,10 +205,14 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
 		return J9THREAD_RWMUTEX_OK;
 	}
+	if (RWMUTEX_SCALABLE(mutex)) {
+		return enterReadScalable(mutex, self);
+	}
 
 	omrthread_monitor_enter(mutex->syncMon);
 
@@ -170,10 +237,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
 		return J9THREAD_RWMUTEX_OK;
 	}
+	if (RWMUTEX_SCALABLE(mutex)) {
+		return exitReadScalable(mutex, self);
+	}
 
 	omrthread_monitor_enter(mutex->syncMon);
 
@@ -223,6 +294,9 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		mutex->status--;
 		return J9THREAD_RWMUTEX_OK;
 	}
+	if (RWMUTEX_SCALABLE(mutex)) {
+		return enterWriteScalable(mutex, self, FALSE);
+	}
 
 	omrthread_monitor_enter(mutex->syncMon);
 
@@ -261,6 +335,9 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		mutex->status--;
 		return J9THREAD_RWMUTEX_OK;
 	}
+	if (RWMUTEX_SCALABLE(mutex)) {
+		return enterWriteScalable(mutex, self, TRUE);
+	}
 
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
@@ -299,6 +376,9 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		/* readers which see writerPending clear enter without syncMon, so the writes made while holding the mutex must be visible first */
+		issueWriteBarrier();
+		mutex->writerPending = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -321,6 +401,224 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 	return (RWMUTEX_STATUS_WRITING(mutex) || (0 != mutex->writer));
 }
 
+/**
+ * Hash a thread to the first reader slot it may claim.
+ *
+ * @param[in] self the current thread
+ * @return an index into the reader slots
+ */
+static uintptr_t
+readerSlotIndex(omrthread_t self)
+{
+	uint32_t hash = (uint32_t)((uintptr_t)self >> 6) * 2654435761U;
+	return (uintptr_t)(hash >> 16) & (RWMUTEX_READER_SLOTS - 1);
+}
+
+/**
+ * Find the reader slot owned by the current thread. A thread only claims slots
+ * within RWMUTEX_READER_SLOT_PROBES of its hash, so only those are searched.
+ *
+ * @param[in] mutex a scalable mutex
+ * @param[in] self the current thread
+ * @return the slot, or NULL if the thread does not hold the mutex through a slot
+ */
+static RWMutexReaderSlot *
+findReaderSlot(RWMutex *mutex, omrthread_t self)
+{
+	uintptr_t index = readerSlotIndex(self);
+	uintptr_t probe = 0;
+	for (probe = 0; probe < RWMUTEX_READER_SLOT_PROBES; probe++) {
+		RWMutexReaderSlot *slot = &mutex->readerSlots[(index + probe) & (RWMUTEX_READER_SLOTS - 1)];
+		if ((uintptr_t)self == slot->owner) {
+			return slot;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Claim a free reader slot for the current thread.
+ *
+ * @param[in] mutex a scalable mutex
+ * @param[in] self the current thread
+ * @return the slot, or NULL if every slot near the hash of the thread is in use
+ */
+static RWMutexReaderSlot *
+claimReaderSlot(RWMutex *mutex, omrthread_t self)
+{
+	uintptr_t index = readerSlotIndex(self);
+	uintptr_t probe = 0;
+	for (probe = 0; probe < RWMUTEX_READER_SLOT_PROBES; probe++) {
+		RWMutexReaderSlot *slot = &mutex->readerSlots[(index + probe) & (RWMUTEX_READER_SLOTS - 1)];
+		if ((0 == slot->owner) && (0 == compareAndSwapUDATA((uintptr_t *)&slot->owner, 0, (uintptr_t)self))) {
+			slot->count = 1;
+			/* the claim must be visible before writerPending is read (a writer sets writerPending then reads the slots) */
+			issueReadWriteBarrier();
+			return slot;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Release a reader slot, waking a writer waiting for the readers to leave.
+ *
+ * @param[in] mutex a scalable mutex
+ * @param[in] slot a slot owned by the current thread
+ */
+static void
+releaseReaderSlot(RWMutex *mutex, RWMutexReaderSlot *slot)
+{
+	slot->count = 0;
+	/* the accesses made while holding the mutex must complete before the slot is seen to be free */
+	issueReadWriteBarrier();
+	slot->owner = 0;
+	issueReadWriteBarrier();
+	if (0 != mutex->writerPending) {
+		/* the writer checks the slots and waits while holding syncMon, so this notify cannot be lost */
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * @param[in] mutex a scalable mutex
+ * @return TRUE if any thread holds the mutex for read through a slot
+ */
+static BOOLEAN
+readerSlotsInUse(RWMutex *mutex)
+{
+	uintptr_t index = 0;
+	for (index = 0; index < RWMUTEX_READER_SLOTS; index++) {
+		if (0 != mutex->readerSlots[index].owner) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Enter a scalable mutex for read.
+ *
+ * A thread already holding the mutex for read never waits, or it would deadlock with a writer
+ * waiting for it to leave. A thread holding it through a slot finds that slot, and a thread holding
+ * it through status finds status non-zero, in which case no writer can have finished waiting.
+ *
+ * @param[in] mutex a scalable mutex not held for write by the current thread
+ * @param[in] self the current thread
+ * @return J9THREAD_RWMUTEX_OK
+ */
+static intptr_t
+enterReadScalable(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = findReaderSlot(mutex, self);
+	if (NULL != slot) {
+		slot->count++;
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	for (;;) {
+		slot = claimReaderSlot(mutex, self);
+		if (NULL != slot) {
+			if (0 == mutex->writerPending) {
+				issueReadBarrier();
+				return J9THREAD_RWMUTEX_OK;
+			}
+			/* a writer is waiting, back off so it is not held up by new readers */
+			releaseReaderSlot(mutex, slot);
+		}
+
+		omrthread_monitor_enter(mutex->syncMon);
+		if ((NULL == slot) || (0 != mutex->status)) {
+			/* no slot is free, or the thread may already hold the mutex through status */
+			while (RWMUTEX_STATUS_WRITING(mutex) || ((0 != mutex->writerPending) && RWMUTEX_STATUS_IDLE(mutex))) {
+				omrthread_monitor_wait(mutex->syncMon);
+			}
+			mutex->status++;
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_OK;
+		}
+		while (0 != mutex->writerPending) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Exit a scalable mutex for read.
+ *
+ * @param[in] mutex a scalable mutex not held for write by the current thread
+ * @param[in] self the current thread
+ * @return J9THREAD_RWMUTEX_OK
+ */
+static intptr_t
+exitReadScalable(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderSlot *slot = findReaderSlot(mutex, self);
+	if (NULL != slot) {
+		if (slot->count > 1) {
+			slot->count--;
+		} else {
+			releaseReaderSlot(mutex, slot);
+		}
+	} else {
+		omrthread_monitor_enter(mutex->syncMon);
+		mutex->status--;
+		if (0 == mutex->status) {
+			/* wake the pending writer, and the readers waiting for it to start */
+			omrthread_monitor_notify_all(mutex->syncMon);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+	return J9THREAD_RWMUTEX_OK;
+}
+
+/**
+ * Enter a scalable mutex for write. Only one writer is pending at a time. While it is pending,
+ * new readers back off and it waits for the readers holding the mutex to leave.
+ *
+ * @param[in] mutex a scalable mutex not held for write by the current thread
+ * @param[in] self the current thread
+ * @param[in] tryEnter if TRUE, return J9THREAD_RWMUTEX_WOULDBLOCK rather than wait
+ * @return J9THREAD_RWMUTEX_OK, or J9THREAD_RWMUTEX_WOULDBLOCK
+ */
+static intptr_t
+enterWriteScalable(RWMutex *mutex, omrthread_t self, BOOLEAN tryEnter)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	while (0 != mutex->writerPending) {
+		if (tryEnter) {
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->writerPending = 1;
+	/* writerPending must be visible before the slots are read (a reader claims a slot then reads writerPending) */
+	issueReadWriteBarrier();
+
+	while ((0 != mutex->status) || readerSlotsInUse(mutex)) {
+		if (tryEnter) {
+			mutex->writerPending = 0;
+			omrthread_monitor_notify_all(mutex->syncMon);
+			omrthread_monitor_exit(mutex->syncMon);
+			return J9THREAD_RWMUTEX_WOULDBLOCK;
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->status--;
+	mutex->writer = self;
+
+	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return J9THREAD_RWMUTEX_OK;
+}
+
 #if defined(OMR_THR_FORK_SUPPORT)
 /**
  * @param [in] rwmutex to reset
@@ -330,7 +628,7 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_SCALABLE(rwmutex) && readerSlotsInUse(rwmutex))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
@@ -341,6 +639,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerPending = 0;
 	}
 }
 
@@ -98,6 +98,12 @@ intptr_t omrthread_spinlock_acquire(omrthread_t self, omrthread_monitor_t monito
 intptr_t omrthread_spinlock_acquire_no_spin(omrthread_t self, omrthread_monitor_t monitor);
 uintptr_t omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState);
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+uint32_t omrthread_futex_park_sequence(omrthread_monitor_t monitor);
+void omrthread_futex_park(omrthread_monitor_t monitor, uint32_t sequence);
+void omrthread_futex_unpark(omrthread_monitor_t monitor, BOOLEAN all);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 intptr_t
 omrthread_mcs_lock(omrthread_t self, omrthread_monitor_t monitor, omrthread_mcs_node_t mcsNode, BOOLEAN retry);
@@ -22,6 +22,13 @@
 
 #include "AtomicSupport.hpp"
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 extern "C" {
 
 #include "thrtypes.h"
@@ -196,6 +203,53 @@ omrthread_spinlock_swapState(omrthread_monitor_t monitor, uintptr_t newState)
 	return oldState;
 }
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/**
+ * Read a monitor's park sequence before deciding to park on it. The sequence changes
+ * whenever threads parked on the monitor must wake, so a thread which reads it before
+ * swapping J9THREAD_MONITOR_SPINLOCK_EXCEEDED into spinlockState (or checking for abort)
+ * cannot miss a wake up issued between the swap and omrthread_futex_park().
+ *
+ * @param[in] monitor the monitor about to be parked on
+ *
+ * @return the sequence to pass to omrthread_futex_park()
+ */
+uint32_t
+omrthread_futex_park_sequence(omrthread_monitor_t monitor)
+{
+	uint32_t sequence = monitor->parkSequence;
+	VM_AtomicSupport::readWriteBarrier();
+	return sequence;
+}
+
+/**
+ * Park the current thread on a monitor until omrthread_futex_unpark() is called on it.
+ * Returns immediately if the monitor was unparked since the sequence was read. May
+ * return spuriously, so callers retry acquiring the monitor.
+ *
+ * @param[in] monitor the monitor to park on
+ * @param[in] sequence the value returned by omrthread_futex_park_sequence()
+ */
+void
+omrthread_futex_park(omrthread_monitor_t monitor, uint32_t sequence)
+{
+	syscall(SYS_futex, &monitor->parkSequence, FUTEX_WAIT_PRIVATE, sequence, NULL, NULL, 0);
+}
+
+/**
+ * Wake threads parked on a monitor.
+ *
+ * @param[in] monitor the monitor
+ * @param[in] all wake every parked thread if TRUE, otherwise at most one
+ */
+void
+omrthread_futex_unpark(omrthread_monitor_t monitor, BOOLEAN all)
+{
+	VM_AtomicSupport::addU32(&monitor->parkSequence, 1);
+	syscall(SYS_futex, &monitor->parkSequence, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, NULL, NULL, 0);
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 #if defined(OMR_THR_MCS_LOCKS)
 /**
  * Acquire the MCS lock.
@@ -0,0 +1,908 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Concurrent variant of the generic hash table, used for tables created with J9HASH_TABLE_CONCURRENT.
+ *
+ * A thread adding to, removing from or splitting a bucket holds it by setting BUCKET_LOCKED in its head.
+ * Lookups walk list buckets without holding them, so a node is linked in only once it is initialized, is
+ * unlinked with a single store, and is freed only once no operation which could have seen it is left.
+ * Lookups hold buckets which were turned into AVL trees, as a tree is rebalanced when it is changed.
+ *
+ * Every operation counts itself in a stripe, chosen from the address of its stack, against the epoch it
+ * started in. The epoch is advanced when no operation which started in the previous epoch is left, and
+ * a node removed in epoch e is freed once the epoch reaches e + 2.
+ *
+ * The table grows by doubling. The thread which finds the table full allocates the larger bucket array,
+ * then every thread adding or removing an entry splits a chunk of the buckets into it, until the larger
+ * array replaces the old one. Splitting a list bucket relinks its nodes in place, so a lookup which misses
+ * while the buckets are being split checks the bucket was not split under it.
+ */
+
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "ut_hashtable.h"
+#include "avl_api.h"
+#include "omravldefines.h"
+#include "omrutilbase.h"
+#include "omrutil.h"
+
+#define BUCKET_LOCKED ((uintptr_t)0x2)
+/* A tagged NULL tree, which is never otherwise stored in a bucket */
+#define BUCKET_SPLIT ((void *)AVL_TREE_TAG_BIT)
+#define BUCKET_HEAD(p) ((void *)(((uintptr_t)(p)) & ~BUCKET_LOCKED))
+#define READ_BUCKET(slot) (*(void * volatile *)(slot))
+#define WRITE_BUCKET(slot, value) (*(void * volatile *)(slot) = (value))
+
+#define SPLIT_CHUNK_SIZE 16 /* Buckets split by a thread each time it adds or removes an entry */
+#define RECLAIM_INTERVAL 64 /* Nodes retired between attempts to free retired nodes */
+#define GROW_CHECK_INTERVAL 16 /* Additions through a stripe between checks of whether the table is full */
+#define SPIN_COUNT 64 /* Attempts to hold a busy bucket before yielding */
+
+#define RETIRED_EPOCH_EXPIRED(data, retiredEpoch) (((retiredEpoch) + 2) <= (data)->epoch)
+
+static J9HashTableStripe *startOperation(J9HashTableConcurrentData *data, uintptr_t *epoch);
+static void endOperation(J9HashTableStripe *stripe, uintptr_t epoch);
+static J9HashTableBuckets *allocateBuckets(J9HashTable *table, uintptr_t size);
+static void *lockBucket(void **slot);
+static void unlockBucket(void **slot, void *head);
+static void *waitForBucket(void **slot);
+static void **lockBucketForUpdate(J9HashTable *table, uintptr_t hashCode, void **head);
+static void *findNodeInList(J9HashTable *table, void *entry, void *node);
+static void *findNodeInTree(J9HashTable *table, void *entry, void *head);
+static void *addNodeInTree(J9HashTable *table, J9HashTableStripe *stripe, void *entry, void *head, BOOLEAN *added);
+static J9AVLTree *listToTree(J9HashTable *table, J9HashTableStripe *stripe, void *head, uintptr_t listLength);
+static void retireList(J9HashTable *table, void *head);
+static void retireNode(J9HashTable *table, void *node);
+static void retireBuckets(J9HashTable *table, J9HashTableBuckets *buckets);
+static void advanceEpoch(J9HashTableConcurrentData *data);
+static void reclaimRetired(J9HashTable *table, BOOLEAN reclaimAll);
+static void growIfFull(J9HashTable *table, uintptr_t addedNodes);
+static void splitBuckets(J9HashTable *table, J9HashTableBuckets *buckets, BOOLEAN splitAll);
+static void splitBucket(J9HashTable *table, J9HashTableBuckets *buckets, uintptr_t index);
+static void splitTree(J9HashTable *table, J9HashTableBuckets *next, uintptr_t index, J9AVLTree *tree, void **low, void **high);
+
+uintptr_t
+hashTableConcurrentInitialize(J9HashTable *table)
+{
+	OMRPortLibrary *portLibrary = table->portLibrary;
+	J9HashTableConcurrentData *data = NULL;
+	uintptr_t stripesSize = HASH_TABLE_STRIPE_COUNT * sizeof(J9HashTableStripe);
+
+	data = portLibrary->mem_allocate_memory(portLibrary, sizeof(J9HashTableConcurrentData), table->tableName, table->memoryCategory);
+	if (NULL == data) {
+		return 1;
+	}
+	memset(data, 0, sizeof(J9HashTableConcurrentData));
+	/* Set now, so hashTableConcurrentTearDown() frees whatever was allocated if errors occur */
+	table->concurrentData = data;
+
+	if (0 != omrthread_monitor_init_with_name(&data->poolMutex, 0, "Concurrent hash table pools")) {
+		data->poolMutex = NULL;
+		return 1;
+	}
+
+	data->retiredNodePool = pool_new(sizeof(J9HashTableRetiredNode), 0, 0, 0, table->tableName, table->memoryCategory, POOL_FOR_PORT(portLibrary));
+	if (NULL == data->retiredNodePool) {
+		return 1;
+	}
+
+	data->stripesMemory = portLibrary->mem_allocate_memory(portLibrary, stripesSize + HASH_TABLE_CACHE_LINE_SIZE, table->tableName, table->memoryCategory);
+	if (NULL == data->stripesMemory) {
+		return 1;
+	}
+	data->stripes = (J9HashTableStripe *)(((uintptr_t)data->stripesMemory + HASH_TABLE_CACHE_LINE_SIZE - 1) & ~(uintptr_t)(HASH_TABLE_CACHE_LINE_SIZE - 1));
+	memset(data->stripes, 0, stripesSize);
+
+	data->buckets = allocateBuckets(table, table->tableSize);
+	if (NULL == data->buckets) {
+		return 1;
+	}
+	table->nodes = data->buckets->nodes;
+
+	return 0;
+}
+
+void
+hashTableConcurrentTearDown(J9HashTable *table)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9HashTableBuckets *buckets = data->buckets;
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	/* the nodes are freed with the pools of the table */
+	while (NULL != buckets) {
+		J9HashTableBuckets *next = buckets->next;
+		omrmem_free_memory(buckets);
+		buckets = next;
+	}
+	buckets = data->retiredBuckets;
+	while (NULL != buckets) {
+		J9HashTableBuckets *next = buckets->retiredNext;
+		omrmem_free_memory(buckets);
+		buckets = next;
+	}
+	if (NULL != data->retiredNodePool) {
+		pool_kill(data->retiredNodePool);
+	}
+	if (NULL != data->stripesMemory) {
+		omrmem_free_memory(data->stripesMemory);
+	}
+	if (NULL != data->poolMutex) {
+		omrthread_monitor_destroy(data->poolMutex);
+	}
+	omrmem_free_memory(data);
+	table->concurrentData = NULL;
+	table->nodes = NULL;
+}
+
+void *
+hashTableConcurrentFind(J9HashTable *table, void *entry)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+	uintptr_t epoch = 0;
+	J9HashTableStripe *stripe = startOperation(data, &epoch);
+	J9HashTableBuckets *buckets = data->buckets;
+	void *findNode = NULL;
+
+	for (;;) {
+		void **slot = &buckets->nodes[hashCode % buckets->size];
+		void *head = READ_BUCKET(slot);
+
+		if (BUCKET_SPLIT == head) {
+			buckets = buckets->next;
+		} else if (AVL_TREE_TAGGED(head)) {
+			/* trees are rebalanced when changed, so they are only searched while the bucket is held */
+			head = lockBucket(slot);
+			if (BUCKET_SPLIT == head) {
+				buckets = buckets->next;
+			} else {
+				findNode = findNodeInTree(table, entry, head);
+				unlockBucket(slot, head);
+				break;
+			}
+		} else {
+			findNode = findNodeInList(table, entry, BUCKET_HEAD(head));
+			if (NULL != findNode) {
+				break;
+			}
+			issueReadBarrier();
+			if (NULL == buckets->next) {
+				/* no bucket has been split, so the miss is genuine */
+				break;
+			}
+			/* The bucket may have been relinked by a split while it was walked. A split holds the bucket until
+			 * it marks it split, so once the bucket is not held and not split, it was not split during the walk.
+			 */
+			head = waitForBucket(slot);
+			if (BUCKET_SPLIT != head) {
+				break;
+			}
+			buckets = buckets->next;
+		}
+	}
+
+	endOperation(stripe, epoch);
+	return findNode;
+}
+
+void *
+hashTableConcurrentAdd(J9HashTable *table, void *entry)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+	uintptr_t epoch = 0;
+	J9HashTableStripe *stripe = startOperation(data, &epoch);
+	void *head = NULL;
+	void **slot = lockBucketForUpdate(table, hashCode, &head);
+	void *addNode = NULL;
+	void *replacedList = NULL;
+	BOOLEAN added = FALSE;
+
+	if (AVL_TREE_TAGGED(head)) {
+		addNode = addNodeInTree(table, stripe, entry, head, &added);
+	} else {
+		void *node = head;
+		void *tail = NULL;
+		uintptr_t listLength = 0;
+		J9AVLTree *tree = NULL;
+
+		while ((NULL != node) && (0 == table->hashEqualFn(node, entry, table->equalFnUserData))) {
+			tail = node;
+			node = NEXT(node);
+			listLength += 1;
+		}
+
+		if (NULL != node) {
+			/* found the entry in the table */
+			addNode = node;
+		} else if ((listLength > table->listToTreeThreshold) && (NULL != (tree = listToTree(table, stripe, head, listLength)))) {
+			replacedList = head;
+			head = AVL_TREE_TAG(tree);
+			addNode = addNodeInTree(table, stripe, entry, head, &added);
+		} else {
+			omrthread_monitor_enter(data->poolMutex);
+			addNode = pool_newElement(table->listNodePool);
+			omrthread_monitor_exit(data->poolMutex);
+			if (NULL != addNode) {
+				memcpy(addNode, entry, table->entrySize);
+				NEXT(addNode) = NULL;
+				/* lookups may reach the node as soon as it is linked */
+				issueWriteBarrier();
+				if (NULL == tail) {
+					head = addNode;
+				} else {
+					NEXT(tail) = addNode;
+				}
+				added = TRUE;
+			}
+		}
+	}
+	unlockBucket(slot, head);
+
+	if (NULL != replacedList) {
+		/* lookups may still be walking the list the tree replaced */
+		retireList(table, replacedList);
+	}
+
+	if (added) {
+		growIfFull(table, addAtomic(&stripe->addedNodes, 1));
+	}
+
+	endOperation(stripe, epoch);
+	return addNode;
+}
+
+uint32_t
+hashTableConcurrentRemove(J9HashTable *table, void *entry)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
+	uintptr_t epoch = 0;
+	J9HashTableStripe *stripe = startOperation(data, &epoch);
+	void *head = NULL;
+	void **slot = lockBucketForUpdate(table, hashCode, &head);
+	uint32_t rc = 1;
+
+	if (AVL_TREE_TAGGED(head)) {
+		J9AVLTreeNode *removedNode = avl_delete(AVL_TREE_UNTAG(head), AVL_DATA_TO_NODE(entry));
+		unlockBucket(slot, head);
+		if (NULL != removedNode) {
+			/* only lookups holding the bucket search the tree, so the node can be freed now */
+			omrthread_monitor_enter(data->poolMutex);
+			pool_removeElement(table->treeNodePool, removedNode);
+			omrthread_monitor_exit(data->poolMutex);
+			subtractAtomic(&stripe->addedTreeNodes, 1);
+			rc = 0;
+		}
+	} else {
+		void *node = head;
+		void *previous = NULL;
+
+		while ((NULL != node) && (0 == table->hashEqualFn(node, entry, table->equalFnUserData))) {
+			previous = node;
+			node = NEXT(node);
+		}
+		if (NULL != node) {
+			if (NULL == previous) {
+				head = NEXT(node);
+			} else {
+				NEXT(previous) = NEXT(node);
+			}
+		}
+		unlockBucket(slot, head);
+		if (NULL != node) {
+			/* lookups may still be walking the node */
+			omrthread_monitor_enter(data->poolMutex);
+			retireNode(table, node);
+			omrthread_monitor_exit(data->poolMutex);
+			rc = 0;
+		}
+	}
+
+	if (0 == rc) {
+		subtractAtomic(&stripe->addedNodes, 1);
+	}
+
+	endOperation(stripe, epoch);
+	return rc;
+}
+
+uint32_t
+hashTableConcurrentGetCount(J9HashTable *table)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	intptr_t count = (intptr_t)table->numberOfNodes;
+	uintptr_t i = 0;
+
+	for (i = 0; i < HASH_TABLE_STRIPE_COUNT; i++) {
+		count += (intptr_t)data->stripes[i].addedNodes;
+	}
+	/* a removal may be counted before the addition of the same entry */
+	return (count > 0) ? (uint32_t)count : 0;
+}
+
+void
+hashTableConcurrentQuiesce(J9HashTable *table)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	uintptr_t i = 0;
+
+	while (NULL != data->buckets->next) {
+		splitBuckets(table, data->buckets, TRUE);
+	}
+
+	omrthread_monitor_enter(data->poolMutex);
+	reclaimRetired(table, TRUE);
+	omrthread_monitor_exit(data->poolMutex);
+
+	for (i = 0; i < HASH_TABLE_STRIPE_COUNT; i++) {
+		J9HashTableStripe *stripe = &data->stripes[i];
+		table->numberOfNodes += (uint32_t)stripe->addedNodes;
+		table->numberOfTreeNodes += (uint32_t)stripe->addedTreeNodes;
+		stripe->addedNodes = 0;
+		stripe->addedTreeNodes = 0;
+	}
+	table->nodes = data->buckets->nodes;
+	table->tableSize = (uint32_t)data->buckets->size;
+}
+
+/**
+ * Count an operation as active in the current epoch.
+ * @param[out] epoch the epoch the operation started in, to be passed to endOperation()
+ * @return the stripe the operation is counted in
+ */
+static J9HashTableStripe *
+startOperation(J9HashTableConcurrentData *data, uintptr_t *epoch)
+{
+	/* threads run on different stacks, so the address of a local spreads them over the stripes */
+	uint32_t stackHash = (uint32_t)(((uintptr_t)epoch) >> 12) * 2654435761U;
+	J9HashTableStripe *stripe = &data->stripes[(stackHash >> 16) % HASH_TABLE_STRIPE_COUNT];
+
+	for (;;) {
+		uintptr_t current = data->epoch;
+		addAtomic(&stripe->activeOperations[current & 1], 1);
+		issueReadWriteBarrier();
+		if (current == data->epoch) {
+			*epoch = current;
+			break;
+		}
+		/* the epoch was advanced without seeing this operation, count it against the new epoch */
+		subtractAtomic(&stripe->activeOperations[current & 1], 1);
+	}
+	return stripe;
+}
+
+static void
+endOperation(J9HashTableStripe *stripe, uintptr_t epoch)
+{
+	issueReadWriteBarrier();
+	subtractAtomic(&stripe->activeOperations[epoch & 1], 1);
+}
+
+static J9HashTableBuckets *
+allocateBuckets(J9HashTable *table, uintptr_t size)
+{
+	uintptr_t allocSize = sizeof(J9HashTableBuckets) + (size * sizeof(void *));
+	J9HashTableBuckets *buckets = table->portLibrary->mem_allocate_memory(table->portLibrary, allocSize, table->tableName, table->memoryCategory);
+
+	if (NULL != buckets) {
+		memset(buckets, 0, allocSize);
+		buckets->size = size;
+		buckets->nodes = (void **)(buckets + 1);
+	}
+	return buckets;
+}
+
+/**
+ * Hold a bucket, waiting for the thread holding it.
+ * @return the head of the bucket, or BUCKET_SPLIT if the bucket has been split (it is not held then)
+ */
+static void *
+lockBucket(void **slot)
+{
+	uintptr_t spins = 0;
+
+	for (;;) {
+		void *head = READ_BUCKET(slot);
+		if (BUCKET_SPLIT == head) {
+			return head;
+		}
+		if (0 == ((uintptr_t)head & BUCKET_LOCKED)) {
+			if ((uintptr_t)head == compareAndSwapUDATA((uintptr_t *)slot, (uintptr_t)head, (uintptr_t)head | BUCKET_LOCKED)) {
+				return head;
+			}
+		} else {
+			spins += 1;
+			if (SPIN_COUNT == spins) {
+				omrthread_yield();
+				spins = 0;
+			}
+		}
+	}
+}
+
+/**
+ * Release a bucket, storing its new head.
+ */
+static void
+unlockBucket(void **slot, void *head)
+{
+	issueWriteBarrier();
+	WRITE_BUCKET(slot, head);
+}
+
+/**
+ * Wait until a bucket is not held.
+ * @return the head of the bucket, or BUCKET_SPLIT
+ */
+static void *
+waitForBucket(void **slot)
+{
+	uintptr_t spins = 0;
+	void *head = READ_BUCKET(slot);
+
+	while (0 != ((uintptr_t)head & BUCKET_LOCKED)) {
+		spins += 1;
+		if (SPIN_COUNT == spins) {
+			omrthread_yield();
+			spins = 0;
+		}
+		head = READ_BUCKET(slot);
+	}
+	issueReadBarrier();
+	return head;
+}
+
+/**
+ * Hold the bucket an entry hashes to in the current bucket array, after helping to split the buckets
+ * if they are being split.
+ * @param[out] head the head of the bucket
+ * @return the bucket
+ */
+static void **
+lockBucketForUpdate(J9HashTable *table, uintptr_t hashCode, void **head)
+{
+	J9HashTableBuckets *buckets = table->concurrentData->buckets;
+
+	if (NULL != buckets->next) {
+		splitBuckets(table, buckets, FALSE);
+	}
+
+	for (;;) {
+		void **slot = &buckets->nodes[hashCode % buckets->size];
+		*head = lockBucket(slot);
+		if (BUCKET_SPLIT != *head) {
+			return slot;
+		}
+		buckets = buckets->next;
+	}
+}
+
+static void *
+findNodeInList(J9HashTable *table, void *entry, void *node)
+{
+	while ((NULL != node) && (0 == table->hashEqualFn(node, entry, table->equalFnUserData))) {
+		node = NEXT(node);
+	}
+	return node;
+}
+
+static void *
+findNodeInTree(J9HashTable *table, void *entry, void *head)
+{
+	/* Fake a tree node from an entry by just moving the pointer to where the start of a tree node would be */
+	J9AVLTreeNode *treeNode = avl_search(AVL_TREE_UNTAG(head), (uintptr_t)AVL_DATA_TO_NODE(entry));
+
+	return (NULL != treeNode) ? AVL_NODE_TO_DATA(treeNode) : NULL;
+}
+
+/**
+ * Add an entry to the tree of a held bucket.
+ * @param[out] added set to TRUE if the entry was not in the tree
+ * @return the entry in the tree, or NULL if a node could not be allocated
+ */
+static void *
+addNodeInTree(J9HashTable *table, J9HashTableStripe *stripe, void *entry, void *head, BOOLEAN *added)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9AVLTreeNode *newNode = NULL;
+	void *nodeData = NULL;
+
+	omrthread_monitor_enter(data->poolMutex);
+	newNode = pool_newElement(table->treeNodePool);
+	omrthread_monitor_exit(data->poolMutex);
+
+	if (NULL != newNode) {
+		J9AVLTreeNode *insertNode = NULL;
+
+		memcpy(AVL_NODE_TO_DATA(newNode), entry, table->entrySize);
+		insertNode = avl_insert(AVL_TREE_UNTAG(head), newNode);
+		if (insertNode == newNode) {
+			nodeData = AVL_NODE_TO_DATA(newNode);
+			addAtomic(&stripe->addedTreeNodes, 1);
+			*added = TRUE;
+		} else {
+			omrthread_monitor_enter(data->poolMutex);
+			pool_removeElement(table->treeNodePool, newNode);
+			omrthread_monitor_exit(data->poolMutex);
+			if (NULL != insertNode) {
+				/* Node was in tree */
+				nodeData = AVL_NODE_TO_DATA(insertNode);
+			}
+		}
+	}
+
+	return nodeData;
+}
+
+/**
+ * Copy the list of a held bucket into a new tree. The list is left intact for the lookups walking it,
+ * and must be retired with retireList() once the tree has replaced it in the bucket.
+ * @return the tree, to be stored in the bucket, or NULL if the list could not be copied
+ */
+static J9AVLTree *
+listToTree(J9HashTable *table, J9HashTableStripe *stripe, void *head, uintptr_t listLength)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9AVLTree *tree = NULL;
+	Trc_hashTable_listToTree_Entry(table->tableName, table, head, listLength);
+
+	if (0 != hashTableCanRehash(table)) {
+		omrthread_monitor_enter(data->poolMutex);
+		/* Keep two spare trees for every tree, so splitting a tree never fails (see splitTree()) */
+		if ((0 == pool_ensureCapacity(table->treePool, 3 * (pool_numElements(table->treePool) + 1)))
+			&& (0 == pool_ensureCapacity(table->treeNodePool, pool_numElements(table->treeNodePool) + listLength))
+		) {
+			void *nodeToCopy = head;
+
+			tree = pool_newElement(table->treePool);
+			/* We ensured capacity so this can't fail */
+			Assert_hashTable_true(NULL != tree);
+			/* Fill the tree contents using the template*/
+			*tree = *(table->avlTreeTemplate);
+
+			while (NULL != nodeToCopy) {
+				J9AVLTreeNode *newTreeNode = (J9AVLTreeNode *)pool_newElement(table->treeNodePool);
+				J9AVLTreeNode *insertNode = NULL;
+				Assert_hashTable_true(NULL != newTreeNode);
+
+				memcpy(AVL_NODE_TO_DATA(newTreeNode), nodeToCopy, table->entrySize);
+				insertNode = avl_insert(tree, newTreeNode);
+				/* Node has to have been inserted */
+				Assert_hashTable_true(insertNode == newTreeNode);
+
+				nodeToCopy = NEXT(nodeToCopy);
+			}
+		}
+		omrthread_monitor_exit(data->poolMutex);
+
+		if (NULL != tree) {
+			addAtomic(&stripe->addedTreeNodes, listLength);
+		}
+	}
+
+	Trc_hashTable_listToTree_Exit((NULL == tree) ? 1 : 0, tree);
+	return tree;
+}
+
+/**
+ * Retire the nodes of a list which has been unlinked from its bucket.
+ */
+static void
+retireList(J9HashTable *table, void *head)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	void *node = head;
+
+	omrthread_monitor_enter(data->poolMutex);
+	while (NULL != node) {
+		void *next = NEXT(node);
+		retireNode(table, node);
+		node = next;
+	}
+	omrthread_monitor_exit(data->poolMutex);
+}
+
+/**
+ * Free a list node which has been unlinked once no lookup can be walking it. poolMutex must be held.
+ * If the node cannot be recorded, it is freed with the table.
+ */
+static void
+retireNode(J9HashTable *table, void *node)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9HashTableRetiredNode *retiredNode = pool_newElement(data->retiredNodePool);
+
+	if (NULL != retiredNode) {
+		/* the node was unlinked before poolMutex was entered, so this is no earlier than the epoch it was unlinked in */
+		retiredNode->node = node;
+		retiredNode->retiredEpoch = data->epoch;
+		retiredNode->next = data->retiredNodes;
+		data->retiredNodes = retiredNode;
+		data->retiredSinceReclaim += 1;
+		if (data->retiredSinceReclaim >= RECLAIM_INTERVAL) {
+			reclaimRetired(table, FALSE);
+		}
+	}
+}
+
+/**
+ * Free a bucket array which has been replaced once no operation can be using it. poolMutex must be held.
+ */
+static void
+retireBuckets(J9HashTable *table, J9HashTableBuckets *buckets)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+
+	buckets->retiredEpoch = data->epoch;
+	buckets->retiredNext = data->retiredBuckets;
+	data->retiredBuckets = buckets;
+	data->retiredSinceReclaim += 1;
+}
+
+/**
+ * Advance the epoch if no operation which started in the previous epoch is left. poolMutex must be held.
+ */
+static void
+advanceEpoch(J9HashTableConcurrentData *data)
+{
+	/* operations which started in the previous epoch are counted with those which will start in the next one */
+	uintptr_t parity = (data->epoch + 1) & 1;
+	uintptr_t i = 0;
+
+	for (i = 0; i < HASH_TABLE_STRIPE_COUNT; i++) {
+		if (0 != data->stripes[i].activeOperations[parity]) {
+			return;
+		}
+	}
+	issueReadWriteBarrier();
+	data->epoch += 1;
+	issueReadWriteBarrier();
+}
+
+/**
+ * Free the retired nodes and bucket arrays which no operation can be using. poolMutex must be held.
+ * @param reclaimAll if TRUE, no operation is in progress and everything retired is freed
+ */
+static void
+reclaimRetired(J9HashTable *table, BOOLEAN reclaimAll)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9HashTableRetiredNode **retiredNodePtr = &data->retiredNodes;
+	J9HashTableBuckets **retiredBucketsPtr = &data->retiredBuckets;
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	if (!reclaimAll) {
+		advanceEpoch(data);
+	}
+	data->retiredSinceReclaim = 0;
+
+	/* the lists are most recently retired first, so everything after the first expired entry has expired too */
+	while ((NULL != *retiredNodePtr) && !reclaimAll && !RETIRED_EPOCH_EXPIRED(data, (*retiredNodePtr)->retiredEpoch)) {
+		retiredNodePtr = &(*retiredNodePtr)->next;
+	}
+	while (NULL != *retiredNodePtr) {
+		J9HashTableRetiredNode *retiredNode = *retiredNodePtr;
+		*retiredNodePtr = retiredNode->next;
+		pool_removeElement(table->listNodePool, retiredNode->node);
+		pool_removeElement(data->retiredNodePool, retiredNode);
+	}
+
+	while ((NULL != *retiredBucketsPtr) && !reclaimAll && !RETIRED_EPOCH_EXPIRED(data, (*retiredBucketsPtr)->retiredEpoch)) {
+		retiredBucketsPtr = &(*retiredBucketsPtr)->retiredNext;
+	}
+	while (NULL != *retiredBucketsPtr) {
+		J9HashTableBuckets *buckets = *retiredBucketsPtr;
+		*retiredBucketsPtr = buckets->retiredNext;
+		omrmem_free_memory(buckets);
+	}
+}
+
+/**
+ * Start splitting the buckets into an array twice as large if the table is full. The number of entries
+ * is only counted every GROW_CHECK_INTERVAL additions through a stripe.
+ * @param addedNodes the count of the stripe the last addition was counted in
+ */
+static void
+growIfFull(J9HashTable *table, uintptr_t addedNodes)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9HashTableBuckets *buckets = data->buckets;
+
+	if ((0 == (addedNodes % GROW_CHECK_INTERVAL))
+		&& hashTableCanGrow(table)
+		&& (0 != hashTableCanRehash(table))
+		&& (NULL == buckets->next)
+		&& (buckets->size < HASH_TABLE_SIZE_MAX)
+		&& (hashTableConcurrentGetCount(table) >= buckets->size)
+	) {
+		J9HashTableBuckets *next = allocateBuckets(table, buckets->size * 2);
+
+		if (NULL != next) {
+			BOOLEAN started = FALSE;
+
+			omrthread_monitor_enter(data->poolMutex);
+			if ((buckets == data->buckets)
+				&& (NULL == buckets->next)
+				/* every tree may need two spare trees when it is split */
+				&& ((NULL == table->treePool) || (0 == pool_ensureCapacity(table->treePool, 3 * pool_numElements(table->treePool))))
+			) {
+				issueWriteBarrier();
+				buckets->next = next;
+				started = TRUE;
+			}
+			omrthread_monitor_exit(data->poolMutex);
+
+			if (started) {
+				Trc_hashTable_concurrentGrow_Start(table->tableName, table, buckets->size, next->size);
+			} else {
+				table->portLibrary->mem_free_memory(table->portLibrary, next);
+			}
+		}
+	}
+}
+
+/**
+ * Split chunks of buckets into the array they are being split into. The thread which splits the last
+ * chunk replaces the buckets with the larger array.
+ * @param splitAll if FALSE, split one chunk at most
+ */
+static void
+splitBuckets(J9HashTable *table, J9HashTableBuckets *buckets, BOOLEAN splitAll)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	uintptr_t size = buckets->size;
+
+	do {
+		uintptr_t start = addAtomic(&buckets->splitClaimed, SPLIT_CHUNK_SIZE) - SPLIT_CHUNK_SIZE;
+		uintptr_t end = OMR_MIN(start + SPLIT_CHUNK_SIZE, size);
+		uintptr_t i = 0;
+
+		if (start >= size) {
+			break;
+		}
+		for (i = start; i < end; i++) {
+			splitBucket(table, buckets, i);
+		}
+		if (size == addAtomic(&buckets->splitCompleted, end - start)) {
+			J9HashTableBuckets *next = buckets->next;
+
+			issueWriteBarrier();
+			data->buckets = next;
+			table->nodes = next->nodes;
+			table->tableSize = (uint32_t)next->size;
+
+			omrthread_monitor_enter(data->poolMutex);
+			retireBuckets(table, buckets);
+			omrthread_monitor_exit(data->poolMutex);
+
+			Trc_hashTable_concurrentGrow_Finish(table->tableName, table, next->size);
+			break;
+		}
+	} while (splitAll);
+}
+
+/**
+ * Split a bucket into buckets index and index + size of the array the buckets are being split into.
+ * Only the thread which claimed the bucket splits it.
+ */
+static void
+splitBucket(J9HashTable *table, J9HashTableBuckets *buckets, uintptr_t index)
+{
+	J9HashTableBuckets *next = buckets->next;
+	void **slot = &buckets->nodes[index];
+	void *head = lockBucket(slot);
+	void *low = NULL;
+	void *high = NULL;
+
+	Assert_hashTable_true(BUCKET_SPLIT != head);
+
+	if (AVL_TREE_TAGGED(head)) {
+		splitTree(table, next, index, AVL_TREE_UNTAG(head), &low, &high);
+	} else {
+		void *lowTail = NULL;
+		void *highTail = NULL;
+		void *node = head;
+
+		/* Relink the nodes in their order in the bucket, so each next pointer only moves forward along
+		 * the bucket and lookups walking it still reach its end.
+		 */
+		while (NULL != node) {
+			void *nextNode = NEXT(node);
+			if (index == (table->hashFn(node, table->hashFnUserData) % next->size)) {
+				if (NULL == lowTail) {
+					low = node;
+				} else {
+					NEXT(lowTail) = node;
+				}
+				lowTail = node;
+			} else {
+				if (NULL == highTail) {
+					high = node;
+				} else {
+					NEXT(highTail) = node;
+				}
+				highTail = node;
+			}
+			node = nextNode;
+		}
+		if (NULL != lowTail) {
+			NEXT(lowTail) = NULL;
+		}
+		if (NULL != highTail) {
+			NEXT(highTail) = NULL;
+		}
+	}
+
+	/* no operation uses the new buckets until this one is marked split */
+	next->nodes[index] = low;
+	next->nodes[index + buckets->size] = high;
+	issueWriteBarrier();
+	WRITE_BUCKET(slot, BUCKET_SPLIT);
+}
+
+/**
+ * Move the nodes of the tree of a bucket being split into new trees, and free it. Lookups hold the
+ * bucket to search a tree, so the nodes are not copied.
+ */
+static void
+splitTree(J9HashTable *table, J9HashTableBuckets *next, uintptr_t index, J9AVLTree *tree, void **low, void **high)
+{
+	J9HashTableConcurrentData *data = table->concurrentData;
+	J9AVLTree *lowTree = NULL;
+	J9AVLTree *highTree = NULL;
+	J9AVLTreeNode *node = AVL_GETNODE(tree->rootNode);
+
+	while (NULL != node) {
+		J9AVLTree **newTree = &highTree;
+		J9AVLTreeNode *removedNode = avl_delete(tree, node);
+		Assert_hashTable_true(removedNode == node);
+
+		if (index == (table->hashFn(AVL_NODE_TO_DATA(node), table->hashFnUserData) % next->size)) {
+			newTree = &lowTree;
+		}
+		if (NULL == *newTree) {
+			omrthread_monitor_enter(data->poolMutex);
+			*newTree = pool_newElement(table->treePool);
+			omrthread_monitor_exit(data->poolMutex);
+			/* spare trees were reserved when the tree was created and when the split started */
+			Assert_hashTable_true(NULL != *newTree);
+			**newTree = *(table->avlTreeTemplate);
+		}
+		node->leftChild = 0;
+		node->rightChild = 0;
+		removedNode = avl_insert(*newTree, node);
+		Assert_hashTable_true(removedNode == node);
+
+		node = AVL_GETNODE(tree->rootNode);
+	}
+
+	omrthread_monitor_enter(data->poolMutex);
+	pool_removeElement(table->treePool, tree);
+	omrthread_monitor_exit(data->poolMutex);
+
+	*low = (NULL == lowTree) ? NULL : AVL_TREE_TAG(lowTree);
+	*high = (NULL == highTree) ? NULL : AVL_TREE_TAG(highTree);
+}
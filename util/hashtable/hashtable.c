@@ -54,19 +54,6 @@
 #define HASHTABLE_DEBUG_PORT(_portLibrary)
 #endif
 
-#define HASH_TABLE_SIZE_MIN 17
-#define HASH_TABLE_SIZE_MAX 2200103
-
-/**
- * Node macros
- */
-#define NEXT(p) *((void **)((uint8_t *)p + table->listNodeSize - sizeof(uintptr_t)))
-
-#define AVL_TREE_TAG_BIT ((uintptr_t)J9HASH_TABLE_AVL_TREE_TAG_BIT)
-#define AVL_TREE_TAGGED(p) (((uintptr_t)(p)) & AVL_TREE_TAG_BIT)
-#define AVL_TREE_TAG(p) ((J9AVLTree *)(((uintptr_t)(p)) | AVL_TREE_TAG_BIT))
-#define AVL_TREE_UNTAG(p) ((J9AVLTree *)(((uintptr_t)(p)) & (~AVL_TREE_TAG_BIT)))
-
 /**
  * Stolen from gc_base/gcutils.h
  */
@@ -235,6 +222,17 @@ collisionResilientHashTableNew(
  *  	hashTableRehash()
  *  	hashTableDoRemove()
  *
+ *  When J9HASH_TABLE_CONCURRENT is set, hashTableFind(), hashTableAdd(), hashTableRemove()
+ *  and hashTableGetCount() may be called by several threads at once without a lock.
+ *  Lookups never lock a bucket unless it was turned into a tree. Additions and removals
+ *  lock only their bucket. The table grows by doubling, and the buckets are split a chunk
+ *  at a time by the threads adding and removing entries, so no operation waits for the
+ *  whole table to be rehashed. Removed nodes are freed once no lookup can still be reading them.
+ *  The other functions must not run concurrently with any operation on the table. An entry
+ *  returned by a lookup stays valid until it is removed, as for other tables.
+ *  J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION is ignored for concurrent tables, and
+ *  J9HASH_TABLE_DO_NOT_GROW prevents growth but does not limit the number of entries.
+ *
  */
 J9HashTable *
 hashTableNew(
@@ -271,6 +269,7 @@ hashTableNewImpl(
 {
 	J9HashTable *hashTable = NULL;
 	BOOLEAN spaceOpt = FALSE;
+	BOOLEAN concurrent = (J9HASH_TABLE_CONCURRENT == (flags & J9HASH_TABLE_CONCURRENT));
 	HASHTABLE_DEBUG_PORT(portLibrary);
 
 	hashTable = portLibrary->mem_allocate_memory(portLibrary, sizeof(J9HashTable), tableName, memoryCategory);
@@ -318,6 +317,7 @@ hashTableNewImpl(
 		&& (0 == (flags & J9HASH_TABLE_ALLOCATE_ELEMENTS_USING_MALLOC32))
 #endif /* OMR_ENV_DATA64 */
 		&& (!(J9HASH_TABLE_COLLISION_RESILIENT == (flags & J9HASH_TABLE_COLLISION_RESILIENT)))
+		&& !concurrent
 	) {
 		/* create a hashTable with no backing pool */
 		spaceOpt = TRUE;
@@ -377,13 +377,20 @@ hashTableNewImpl(
 		hashTable->hashEqualFn = hashEqualFn;
 	}
 
-	hashTable->nodes = portLibrary->mem_allocate_memory(portLibrary, sizeof(uintptr_t) * hashTable->tableSize, tableName, memoryCategory);
-	if (NULL == hashTable->nodes) {
-		goto error;
-	}
+	if (concurrent) {
+		/* the nodes are allocated with the concurrent state */
+		if (0 != hashTableConcurrentInitialize(hashTable)) {
+			goto error;
+		}
+	} else {
+		hashTable->nodes = portLibrary->mem_allocate_memory(portLibrary, sizeof(uintptr_t) * hashTable->tableSize, tableName, memoryCategory);
+		if (NULL == hashTable->nodes) {
+			goto error;
+		}
 
-	/* reset all the nodes */
-	memset(hashTable->nodes, 0, sizeof(uintptr_t) * hashTable->tableSize);
+		/* reset all the nodes */
+		memset(hashTable->nodes, 0, sizeof(uintptr_t) * hashTable->tableSize);
+	}
 
 	return hashTable;
 
@@ -409,7 +416,9 @@ hashTableFree(J9HashTable *hashTable)
 		OMRPORT_ACCESS_FROM_OMRPORT(hashTable->portLibrary);
 		hashTable_printf("hashTableFree <%s>: table=%p\n", hashTable->tableName, hashTable);
 
-		if (NULL != hashTable->nodes) {
+		if (NULL != hashTable->concurrentData) {
+			hashTableConcurrentTearDown(hashTable);
+		} else if (NULL != hashTable->nodes) {
 			omrmem_free_memory(hashTable->nodes);
 		}
 		if (NULL != hashTable->avlTreeTemplate) {
@@ -441,13 +450,20 @@ hashTableFree(J9HashTable *hashTable)
 void *
 hashTableFind(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	void *findNode = NULL;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableFind <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (NULL != table->concurrentData) {
+		return hashTableConcurrentFind(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		void **node = hashTableFindNodeSpaceOpt(table, entry, head);
 		findNode = (NULL != *node) ? node : NULL;
@@ -516,14 +532,21 @@ hashTableFindNodeInTree(J9HashTable *table, void *entry, void **head)
 void *
 hashTableAdd(J9HashTable *table, void *entry)
 {
-	uintptr_t hashCode = table->hashFn(entry, table->hashFnUserData);
-	void **head = &table->nodes[hashCode % table->tableSize];
+	uintptr_t hashCode = 0;
+	void **head = NULL;
 	void *addNode = NULL;
 	BOOLEAN growFailure = FALSE;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableAdd <%s>: table=%p entry=%p\n", table->tableName, table, entry);
 
+	if (NULL != table->concurrentData) {
+		return hashTableConcurrentAdd(table, entry);
+	}
+
+	hashCode = table->hashFn(entry, table->hashFnUserData);
+	head = &table->nodes[hashCode % table->tableSize];
+
 	if ((table->numberOfNodes + 1) == table->tableSize) {
 		if (!hashTableCanGrow(table)) {
 			goto done;
@@ -702,13 +725,20 @@ listToTree(J9HashTable *table, void **head, uintptr_t listLength)
 uint32_t
 hashTableRemove(J9HashTable *table, void *entry)
 {
-	uintptr_t hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
-	void **head = &table->nodes[hash];
+	uintptr_t hash = 0;
+	void **head = NULL;
 	uint32_t rc = 1;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
 	hashTable_printf("hashTableRemove <%s>: table=%p, entry=%p\n", table->tableName, table, entry);
 
+	if (NULL != table->concurrentData) {
+		return hashTableConcurrentRemove(table, entry);
+	}
+
+	hash = table->hashFn(entry, table->hashFnUserData) % table->tableSize;
+	head = &table->nodes[hash];
+
 	if (NULL == table->listNodePool) {
 		rc = hashTableRemoveNodeSpaceOpt(table, entry, head);
 	} else if (NULL == *head) {
@@ -852,13 +882,17 @@ hashTableRehash(J9HashTable *table)
 	uint32_t i = 0;
 	void *chain = NULL;
 	void  *tail = NULL;
-	uintptr_t tableSize = table->tableSize;
+	uintptr_t tableSize = 0;
 
 	if (NULL == table->listNodePool) {
 		/* space optimized hashTable, operation not supported */
 		Assert_hashTable_unreachable();
 	}
 
+	if (NULL != table->concurrentData) {
+		hashTableConcurrentQuiesce(table);
+	}
+
 	if (J9HASH_TABLE_COLLISION_RESILIENT == (table->flags & J9HASH_TABLE_COLLISION_RESILIENT)) {
 		/* Not currently supported.
 		 *
@@ -870,6 +904,8 @@ hashTableRehash(J9HashTable *table)
 		Assert_hashTable_unreachable();
 	}
 
+	tableSize = table->tableSize;
+
 	/* connect all the node-chains into one big chain */
 	for (i = 0; i < tableSize; i++) {
 		if (table->nodes[i]) {
@@ -1002,9 +1038,14 @@ void *
 hashTableStartDo(J9HashTable *table,  J9HashTableState *handle)
 {
 	void *result = NULL;
-	uint32_t numberOfListNodes = table->numberOfNodes - table->numberOfTreeNodes;
+	uint32_t numberOfListNodes = 0;
 	HASHTABLE_DEBUG_PORT(table->portLibrary);
 
+	if (NULL != table->concurrentData) {
+		hashTableConcurrentQuiesce(table);
+	}
+	numberOfListNodes = table->numberOfNodes - table->numberOfTreeNodes;
+
 	memset(handle, 0, sizeof(J9HashTableState));
 	handle->table = table;
 	handle->bucketIndex = 0;
@@ -1204,6 +1245,9 @@ hashTableDoRemove(J9HashTableState *handle)
 uint32_t
 hashTableGetCount(J9HashTable *table)
 {
+	if (NULL != table->concurrentData) {
+		return hashTableConcurrentGetCount(table);
+	}
 	return table->numberOfNodes;
 }
 
@@ -34,11 +34,135 @@
 
 #include "omrcomp.h"
 #include "hashtable_api.h"
+#include "thread_api.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Node macros
+ */
+#define NEXT(p) *((void **)((uint8_t *)p + table->listNodeSize - sizeof(uintptr_t)))
+
+#define AVL_TREE_TAG_BIT ((uintptr_t)J9HASH_TABLE_AVL_TREE_TAG_BIT)
+#define AVL_TREE_TAGGED(p) (((uintptr_t)(p)) & AVL_TREE_TAG_BIT)
+#define AVL_TREE_TAG(p) ((J9AVLTree *)(((uintptr_t)(p)) | AVL_TREE_TAG_BIT))
+#define AVL_TREE_UNTAG(p) ((J9AVLTree *)(((uintptr_t)(p)) & (~AVL_TREE_TAG_BIT)))
+
+#define HASH_TABLE_SIZE_MIN 17
+#define HASH_TABLE_SIZE_MAX 2200103
+
+#define HASH_TABLE_STRIPE_COUNT 32
+#define HASH_TABLE_CACHE_LINE_SIZE 64
+
+/**
+ * A bucket array of a J9HASH_TABLE_CONCURRENT table. While the table grows, the buckets are split one
+ * at a time into next, which is twice as large: bucket i is split into buckets i and i + size of next.
+ */
+typedef struct J9HashTableBuckets {
+	uintptr_t size; /**< Number of buckets */
+	void **nodes; /**< Bucket heads, allocated after the structure */
+	struct J9HashTableBuckets *next; /**< Buckets this array is being split into, NULL if it is not */
+	volatile uintptr_t splitClaimed; /**< Number of buckets claimed by splitting threads, may exceed size */
+	volatile uintptr_t splitCompleted; /**< Number of buckets split */
+	uintptr_t retiredEpoch; /**< Epoch the array was replaced in */
+	struct J9HashTableBuckets *retiredNext; /**< Next array waiting to be freed */
+} J9HashTableBuckets;
+
+/**
+ * Per-thread-group state of a J9HASH_TABLE_CONCURRENT table, one cache line each.
+ */
+typedef struct J9HashTableStripe {
+	volatile uintptr_t activeOperations[2]; /**< Operations in progress which started in an even or an odd epoch */
+	volatile uintptr_t addedNodes; /**< Nodes added less nodes removed through this stripe, may wrap */
+	volatile uintptr_t addedTreeNodes; /**< Tree nodes added less tree nodes removed through this stripe, may wrap */
+	uint8_t padding[HASH_TABLE_CACHE_LINE_SIZE - (4 * sizeof(uintptr_t))];
+} J9HashTableStripe;
+
+/**
+ * A list node removed from a J9HASH_TABLE_CONCURRENT table, which lookups may still be reading.
+ */
+typedef struct J9HashTableRetiredNode {
+	void *node;
+	uintptr_t retiredEpoch; /**< Epoch the node was removed in */
+	struct J9HashTableRetiredNode *next;
+} J9HashTableRetiredNode;
+
+typedef struct J9HashTableConcurrentData {
+	J9HashTableBuckets * volatile buckets; /**< Current bucket array */
+	volatile uintptr_t epoch; /**< Advanced only while poolMutex is held */
+	omrthread_monitor_t poolMutex; /**< Protects the pools of the table and the retired lists */
+	struct J9Pool *retiredNodePool;
+	J9HashTableRetiredNode *retiredNodes; /**< Most recently retired first */
+	J9HashTableBuckets *retiredBuckets; /**< Most recently retired first */
+	uintptr_t retiredSinceReclaim; /**< Nodes and arrays retired since the last reclaim attempt */
+	J9HashTableStripe *stripes; /**< HASH_TABLE_STRIPE_COUNT stripes, cache line aligned */
+	void *stripesMemory;
+} J9HashTableConcurrentData;
+
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief Allocate the concurrent state and the first bucket array of a J9HASH_TABLE_CONCURRENT table
+* @param *table
+* @return uintptr_t 0 on success
+*/
+uintptr_t
+hashTableConcurrentInitialize(J9HashTable *table);
+
+/**
+* @brief Free the concurrent state and every bucket array of a J9HASH_TABLE_CONCURRENT table
+* @param *table
+* @return void
+*/
+void
+hashTableConcurrentTearDown(J9HashTable *table);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+hashTableConcurrentFind(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return void *
+*/
+void *
+hashTableConcurrentAdd(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @param *entry
+* @return uint32_t
+*/
+uint32_t
+hashTableConcurrentRemove(J9HashTable *table, void *entry);
+
+/**
+* @brief
+* @param *table
+* @return uint32_t
+*/
+uint32_t
+hashTableConcurrentGetCount(J9HashTable *table);
+
+/**
+* @brief Finish any split in progress, free the retired nodes and bring the fields of the table up to date,
+* so the single threaded functions can be used. No other operation may be in progress on the table.
+* @param *table
+* @return void
+*/
+void
+hashTableConcurrentQuiesce(J9HashTable *table);
+
 
 #ifdef __cplusplus
 }